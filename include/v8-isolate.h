@@ -1355,6 +1355,17 @@ class V8_EXPORT Isolate {
    */
   void DisableMemorySavingsMode();
 
+  /**
+   * Sets a budget for the memory committed by the V8 heap of this isolate,
+   * e.g. the share of a per-process RSS limit that the embedder assigns to
+   * it. V8 then schedules memory reducing garbage collections and releases
+   * pooled pages to stay below the budget. Idle periods reported with
+   * IdleNotificationDeadline are preferred for this work. Staying below the
+   * budget is not guaranteed. A budget of 0 disables this mode, which is the
+   * default.
+   */
+  void SetMemoryBudget(size_t budget_in_bytes);
+
   /**
    * Optional notification to tell V8 the current performance requirements
    * of the embedder based on RAIL.
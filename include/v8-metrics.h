@@ -80,6 +80,14 @@ struct GarbageCollectionYoungCycle {
   double collection_rate_in_percent;
   double efficiency_in_bytes_per_us;
   double main_thread_efficiency_in_bytes_per_us;
+  // Populated when the C++ heap ran a minor collection along with the cycle.
+  GarbageCollectionPhases total_cpp;
+  GarbageCollectionPhases main_thread_cpp;
+  GarbageCollectionSizes objects_cpp;
+  GarbageCollectionSizes memory_cpp;
+  double collection_rate_cpp_in_percent = -1.0;
+  double efficiency_cpp_in_bytes_per_us = -1.0;
+  double main_thread_efficiency_cpp_in_bytes_per_us = -1.0;
 };
 
 struct WasmModuleDecoded {
@@ -544,7 +544,8 @@ class V8_EXPORT OutputStream {
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // See format description near 'Serialize' method.
   };
 
   /** Returns the root node of the heap graph. */
@@ -594,6 +595,13 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * kBinary is a compact encoding of the same graph. It starts with the
+   * bytes "V8HS" and a format version, followed by the nodes, edges,
+   * locations and strings, with all numbers stored as unsigned LEB128
+   * varints. The chunks passed to WriteAsciiChunk are not ASCII text in this
+   * format. Allocation traces and samples are not included.
+   * tools/heap-snapshot-binary.py converts it to the JSON format.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
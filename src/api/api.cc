@@ -65,6 +65,7 @@
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
+#include "src/heap/memory-reducer.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
@@ -9248,6 +9249,11 @@ void Isolate::DisableMemorySavingsMode() {
   isolate->DisableMemorySavingsMode();
 }
 
+void Isolate::SetMemoryBudget(size_t budget_in_bytes) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->memory_reducer()->SetMemoryBudget(budget_in_bytes);
+}
+
 void Isolate::SetRAILMode(RAILMode rail_mode) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   return isolate->SetRAILMode(rail_mode);
@@ -10125,10 +10131,16 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::HeapSnapshot::Serialize",
+  Utils::ApiCheck(format == kJSON || format == kBinary,
+                  "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
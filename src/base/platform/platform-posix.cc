@@ -606,6 +606,17 @@ bool OS::HasLazyCommits() {
 }
 #endif  // !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
+  DCHECK_EQ(0, size % CommitPageSize());
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
 const char* OS::GetGCFakeMMapFile() {
   return g_gc_fake_mmap;
 }
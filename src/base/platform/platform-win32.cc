@@ -979,6 +979,13 @@ bool OS::SetPermissions(void* address, size_t size, MemoryPermission access) {
   return VirtualAllocWrapper(address, size, MEM_COMMIT, protect) != nullptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Large pages on Windows need to be allocated up front with
+  // MEM_LARGE_PAGES.
+  return false;
+}
+
 // static
 bool OS::DiscardSystemPages(void* address, size_t size) {
   // On Windows, discarded pages are not returned to the system immediately and
@@ -311,6 +311,11 @@ class V8_BASE_EXPORT OS {
       Address boundary_start, Address boundary_end, size_t minimum_size,
       size_t alignment);
 
+  // Advises the OS to back [address, address + size) with transparent huge
+  // pages. Only effective for 2MB-aligned subranges. Returns false if the
+  // platform does not support huge pages.
+  static bool AdviseHugePages(void* address, size_t size);
+
   [[noreturn]] static void ExitProcess(int exit_code);
 
  private:
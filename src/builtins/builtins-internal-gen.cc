@@ -669,6 +669,10 @@ class DeletePropertyBaseAssembler : public AccessorAssembler {
     GotoIf(IsSetWord32(details, PropertyDetails::kAttributesDontDeleteMask),
            dont_delete);
 
+    // Only lookups in NameDictionaries are cached.
+    if (std::is_same<Dictionary, NameDictionary>::value) {
+      InvalidateDictionaryLookupCache(LoadMap(receiver), name);
+    }
     DictionarySpecificDelete(receiver, properties, key_index, context);
 
     Return(TrueConstant());
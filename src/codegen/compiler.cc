@@ -65,6 +65,7 @@
 #include "src/zone/zone-list-inl.h"  // crbug.com/v8/8816
 
 #ifdef V8_ENABLE_MAGLEV
+#include "src/maglev/maglev-concurrent-dispatcher.h"
 #include "src/maglev/maglev.h"
 #endif  // V8_ENABLE_MAGLEV
 
@@ -955,7 +956,8 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
                            Isolate* isolate,
                            OptimizedCompilationInfo* compilation_info,
                            CodeKind code_kind, Handle<JSFunction> function) {
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  if (!isolate->optimizing_compile_dispatcher()->EnsureQueueAvailable(
+          *function, compilation_info->is_osr())) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       compilation_info->closure()->ShortPrint();
@@ -992,7 +994,10 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
     PrintF(" for concurrent optimization.\n");
   }
 
-  if (CodeKindIsStoredInOptimizedCodeCache(code_kind)) {
+  if (!compilation_info->osr_offset().IsNone()) {
+    // OSR jobs don't affect the regular tiering of the function.
+    function->feedback_vector().set_osr_compilation_in_progress(true);
+  } else if (CodeKindIsStoredInOptimizedCodeCache(code_kind)) {
     function->SetOptimizationMarker(OptimizationMarker::kInOptimizationQueue);
   }
 
@@ -1068,6 +1073,9 @@ MaybeHandle<CodeT> CompileTurbofan(
   if (mode == ConcurrencyMode::kConcurrent) {
     if (GetOptimizedCodeLater(std::move(job), isolate, compilation_info,
                               kCodeKind, function)) {
+      // The OSR'ing frame keeps running unoptimized code until the job is
+      // finalized, and then enters through the OSR code cache.
+      if (!osr_offset.IsNone()) return {};
       return ContinuationForConcurrentOptimization(isolate, function);
     }
   } else {
@@ -1081,12 +1089,49 @@ MaybeHandle<CodeT> CompileTurbofan(
   return {};
 }
 
+#ifdef V8_ENABLE_MAGLEV
+bool GetMaglevCodeLater(Isolate* isolate, Handle<JSFunction> function) {
+  if (isolate->heap()->HighMemoryPressure()) {
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** High memory pressure, will retry maglev compiling ");
+      function->ShortPrint();
+      PrintF(" later.\n");
+    }
+    return false;
+  }
+
+  TimerEventScope<TimerEventRecompileSynchronous> timer(isolate);
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kMaglevConcurrentPrepare);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.MaglevConcurrentPrepare");
+
+  std::unique_ptr<maglev::MaglevCompilationJob> job =
+      maglev::MaglevCompilationJob::New(isolate, function);
+  if (!PrepareJobWithHandleScope(job.get(), isolate,
+                                 job->compilation_info())) {
+    return false;
+  }
+
+  // The dispatcher owns the job from now on.
+  isolate->maglev_concurrent_dispatcher()->EnqueueJob(std::move(job));
+
+  if (FLAG_trace_concurrent_recompilation) {
+    PrintF("  ** Queued ");
+    function->ShortPrint();
+    PrintF(" for concurrent maglev compilation.\n");
+  }
+
+  // Keeps the function from being queued again until the job is finalized.
+  function->SetOptimizationMarker(OptimizationMarker::kInOptimizationQueue);
+  return true;
+}
+#endif  // V8_ENABLE_MAGLEV
+
 MaybeHandle<CodeT> CompileMaglev(
     Isolate* isolate, Handle<JSFunction> function, ConcurrencyMode mode,
     BytecodeOffset osr_offset, JavaScriptFrame* osr_frame,
     GetOptimizedCodeResultHandling result_handling) {
   // TODO(v8:7700): Add missing support.
-  CHECK(mode == ConcurrencyMode::kNotConcurrent);
   CHECK(osr_offset.IsNone());
   CHECK(osr_frame == nullptr);
   CHECK(result_handling == GetOptimizedCodeResultHandling::kDefault);
@@ -1097,6 +1142,13 @@ MaybeHandle<CodeT> CompileMaglev(
   PostponeInterruptsScope postpone(isolate);
 
 #ifdef V8_ENABLE_MAGLEV
+  if (mode == ConcurrencyMode::kConcurrent &&
+      isolate->maglev_concurrent_dispatcher()->is_enabled()) {
+    if (GetMaglevCodeLater(isolate, function)) {
+      return ContinuationForConcurrentOptimization(isolate, function);
+    }
+    return {};
+  }
   return Maglev::Compile(isolate, function);
 #else
   return {};
@@ -3292,11 +3344,17 @@ template Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
 // static
 MaybeHandle<CodeT> Compiler::GetOptimizedCodeForOSR(
     Isolate* isolate, Handle<JSFunction> function, BytecodeOffset osr_offset,
-    JavaScriptFrame* osr_frame) {
+    JavaScriptFrame* osr_frame, ConcurrencyMode mode) {
   DCHECK(!osr_offset.IsNone());
   DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(isolate, function, ConcurrencyMode::kNotConcurrent,
-                          CodeKindForOSR(), osr_offset, osr_frame);
+  if (mode == ConcurrencyMode::kConcurrent) {
+    // Wait for the running job, rather than queueing one per back edge.
+    if (function->feedback_vector().osr_compilation_in_progress()) return {};
+    // The frame may be gone by the time the job runs.
+    osr_frame = nullptr;
+  }
+  return GetOptimizedCode(isolate, function, mode, CodeKindForOSR(),
+                          osr_offset, osr_frame);
 }
 
 // static
@@ -3313,11 +3371,16 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
                "V8.OptimizeConcurrentFinalize");
 
   Handle<SharedFunctionInfo> shared = compilation_info->shared_info();
+  Handle<JSFunction> function = compilation_info->closure();
+  const bool is_osr = !compilation_info->osr_offset().IsNone();
 
   const bool use_result = !compilation_info->discard_result_for_testing();
   if (V8_LIKELY(use_result)) {
     // Reset profiler ticks, function is no longer considered hot.
-    compilation_info->closure()->feedback_vector().set_profiler_ticks(0);
+    function->feedback_vector().set_profiler_ticks(0);
+  }
+  if (is_osr) {
+    function->feedback_vector().set_osr_compilation_in_progress(false);
   }
 
   DCHECK(!shared->HasBreakInfo());
@@ -3338,8 +3401,15 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
       if (V8_LIKELY(use_result)) {
         InsertCodeIntoOptimizedCodeCache(compilation_info);
         CompilerTracer::TraceCompletedJob(isolate, compilation_info);
-        compilation_info->closure()->set_code(*compilation_info->code(),
-                                              kReleaseStore);
+        if (is_osr) {
+          // OSR code can't be entered through a call. Arm all back edges
+          // instead, so that the next one picks it up from the OSR code
+          // cache.
+          shared->GetBytecodeArray(isolate).set_osr_loop_nesting_level(
+              AbstractCode::kMaxLoopNestingMarker);
+        } else {
+          function->set_code(*compilation_info->code(), kReleaseStore);
+        }
       }
       return CompilationJob::SUCCEEDED;
     }
@@ -3347,16 +3417,72 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
 
   DCHECK_EQ(job->state(), CompilationJob::State::kFailed);
   CompilerTracer::TraceAbortedJob(isolate, compilation_info);
-  if (V8_LIKELY(use_result)) {
-    compilation_info->closure()->set_code(shared->GetCode(), kReleaseStore);
+  if (V8_LIKELY(use_result) && !is_osr) {
+    function->set_code(shared->GetCode(), kReleaseStore);
     // Clear the InOptimizationQueue marker, if it exists.
-    if (compilation_info->closure()->IsInOptimizationQueue()) {
-      compilation_info->closure()->ClearOptimizationMarker();
+    if (function->IsInOptimizationQueue()) {
+      function->ClearOptimizationMarker();
     }
   }
   return CompilationJob::FAILED;
 }
 
+// static
+void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
+                                            Isolate* isolate) {
+#ifdef V8_ENABLE_MAGLEV
+  VMState<COMPILER> state(isolate);
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kMaglevConcurrentFinalize);
+  TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                         "V8.MaglevConcurrentFinalize", job,
+                         TRACE_EVENT_FLAG_FLOW_IN);
+
+  OptimizedCompilationInfo* compilation_info = job->compilation_info();
+  Handle<JSFunction> function = compilation_info->closure();
+  Handle<SharedFunctionInfo> shared = compilation_info->shared_info();
+
+  if (base::TimeTicks::IsHighResolution()) {
+    Counters* const counters = isolate->counters();
+    counters->maglev_concurrent_queue_wait()->AddSample(
+        static_cast<int>(job->queue_wait_time().InMicroseconds()));
+    counters->maglev_concurrent_execute()->AddSample(
+        static_cast<int>(job->compile_time().InMicroseconds()));
+  }
+
+  // 1) Compilation on the background thread may have failed.
+  // 2) The function may have tiered up, or the debugger may need to hook into
+  //    it, while the job was in flight.
+  // 3) The code may have been invalidated due to dependency changes.
+  bool installed = false;
+  if (job->state() == CompilationJob::State::kReadyToFinalize) {
+    if (shared->optimization_disabled() || shared->HasBreakInfo() ||
+        isolate->debug()->needs_check_on_function_call() ||
+        function->ActiveTierIsTurbofan() || function->ActiveTierIsMaglev()) {
+      job->RetryOptimization(BailoutReason::kOptimizationDisabled);
+    } else if (job->FinalizeJob(isolate) == CompilationJob::SUCCEEDED) {
+      job->RecordFunctionCompilation(CodeEventListener::LAZY_COMPILE_TAG,
+                                     isolate);
+      function->set_code(ToCodeT(*compilation_info->code()), kReleaseStore);
+      installed = true;
+    }
+  }
+
+  if (FLAG_trace_concurrent_recompilation) {
+    PrintF("  ** %s maglev compilation for ",
+           installed ? "Finalized" : "Aborted");
+    function->ShortPrint();
+    PrintF(" (queued %.3f ms, compiled %.3f ms).\n",
+           job->queue_wait_time().InMillisecondsF(),
+           job->compile_time().InMillisecondsF());
+  }
+
+  // Clear the InOptimizationQueue marker, if it exists.
+  if (function->IsInOptimizationQueue()) function->ClearOptimizationMarker();
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_MAGLEV
+}
+
 // static
 void Compiler::PostInstantiation(Handle<JSFunction> function) {
   Isolate* isolate = function->GetIsolate();
@@ -46,6 +46,10 @@ class WorkerThreadRuntimeCallStats;
 struct ScriptDetails;
 struct ScriptStreamingData;
 
+namespace maglev {
+class MaglevCompilationJob;
+}  // namespace maglev
+
 using UnoptimizedCompilationJobList =
     std::forward_list<std::unique_ptr<UnoptimizedCompilationJob>>;
 
@@ -115,6 +119,10 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   static bool FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
                                               Isolate* isolate);
 
+  // Finalize and install Maglev code from a previously run concurrent job.
+  static void FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
+                                           Isolate* isolate);
+
   // Give the compiler a chance to perform low-latency initialization tasks of
   // the given {function} on its instantiation. Note that only the runtime will
   // offer this chance, optimized closure instantiation will not call this.
@@ -233,9 +241,12 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   // instead of generating JIT code for a function at all.
 
   // Generate and return optimized code for OSR, or empty handle on failure.
+  // In concurrent mode, code is only returned if it is already in the OSR code
+  // cache. Otherwise a background job is queued (unless one is running
+  // already) whose result is added to the cache once finalized.
   V8_WARN_UNUSED_RESULT static MaybeHandle<CodeT> GetOptimizedCodeForOSR(
       Isolate* isolate, Handle<JSFunction> function, BytecodeOffset osr_offset,
-      JavaScriptFrame* osr_frame);
+      JavaScriptFrame* osr_frame, ConcurrencyMode mode);
 };
 
 // A base class for compilation jobs intended to run concurrent to the main
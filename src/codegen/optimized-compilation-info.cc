@@ -97,9 +97,9 @@ void OptimizedCompilationInfo::ConfigureFlags() {
     case CodeKind::JS_TO_JS_FUNCTION:
     case CodeKind::JS_TO_WASM_FUNCTION:
     case CodeKind::WASM_TO_JS_FUNCTION:
+    case CodeKind::MAGLEV:
       break;
     case CodeKind::BASELINE:
-    case CodeKind::MAGLEV:
     case CodeKind::INTERPRETED_FUNCTION:
     case CodeKind::REGEXP:
       UNREACHABLE();
@@ -4,6 +4,10 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "include/v8-platform.h"
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -15,8 +19,8 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/objects-inl.h"
-#include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
 namespace v8 {
@@ -27,10 +31,16 @@ namespace {
 void DisposeCompilationJob(OptimizedCompilationJob* job,
                            bool restore_function_code) {
   if (restore_function_code) {
-    Handle<JSFunction> function = job->compilation_info()->closure();
-    function->set_code(function->shared().GetCode(), kReleaseStore);
-    if (function->IsInOptimizationQueue()) {
-      function->ClearOptimizationMarker();
+    OptimizedCompilationInfo* info = job->compilation_info();
+    Handle<JSFunction> function = info->closure();
+    if (!info->osr_offset().IsNone()) {
+      // OSR jobs never replaced the function's code.
+      function->feedback_vector().set_osr_compilation_in_progress(false);
+    } else {
+      function->set_code(function->shared().GetCode(), kReleaseStore);
+      if (function->IsInOptimizationQueue()) {
+        function->ClearOptimizationMarker();
+      }
     }
   }
   delete job;
@@ -38,30 +48,26 @@ void DisposeCompilationJob(OptimizedCompilationJob* job,
 
 }  // namespace
 
-class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
+class OptimizingCompileDispatcher::CompileTask : public v8::JobTask {
  public:
   explicit CompileTask(Isolate* isolate,
                        OptimizingCompileDispatcher* dispatcher)
-      : CancelableTask(isolate),
-        isolate_(isolate),
-        worker_thread_runtime_call_stats_(
-            isolate->counters()->worker_thread_runtime_call_stats()),
-        dispatcher_(dispatcher) {
-    ++dispatcher_->ref_count_;
-  }
+      : isolate_(isolate), dispatcher_(dispatcher) {}
 
   CompileTask(const CompileTask&) = delete;
   CompileTask& operator=(const CompileTask&) = delete;
 
   ~CompileTask() override = default;
 
- private:
-  // v8::Task overrides.
-  void RunInternal() override {
+  // v8::JobTask overrides.
+  void Run(JobDelegate* delegate) override {
     LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
     DCHECK(local_isolate.heap()->IsParked());
 
-    {
+    while (!delegate->ShouldYield()) {
+      OptimizedCompilationJob* job = dispatcher_->NextInput(&local_isolate);
+      if (job == nullptr) break;
+
       RCS_SCOPE(&local_isolate,
                 RuntimeCallCounterId::kOptimizeBackgroundDispatcherJob);
 
@@ -74,42 +80,83 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
             dispatcher_->recompilation_delay_));
       }
 
-      dispatcher_->CompileNext(dispatcher_->NextInput(&local_isolate),
-                               &local_isolate);
-    }
-    {
-      base::MutexGuard lock_guard(&dispatcher_->ref_count_mutex_);
-      if (--dispatcher_->ref_count_ == 0) {
-        dispatcher_->ref_count_zero_.NotifyOne();
-      }
+      dispatcher_->CompileNext(job, &local_isolate);
     }
   }
 
+  // Scales the number of workers with the number of queued jobs, up to the
+  // number of worker threads of the platform.
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t queued_jobs = dispatcher_->InputQueueLength();
+    size_t max_threads = FLAG_concurrent_recompilation_max_threads;
+    if (max_threads > 0) return std::min(max_threads, queued_jobs);
+    return queued_jobs;
+  }
+
+ private:
   Isolate* isolate_;
-  WorkerThreadRuntimeCallStats* worker_thread_runtime_call_stats_;
   OptimizingCompileDispatcher* dispatcher_;
 };
 
+OptimizingCompileDispatcher::OptimizingCompileDispatcher(Isolate* isolate)
+    : isolate_(isolate),
+      input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
+      ref_count_(0),
+      recompilation_delay_(FLAG_concurrent_recompilation_delay) {
+  input_queue_.reserve(input_queue_capacity_);
+  job_handle_ = PostJob();
+}
+
 OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
+  // Wait for the workers to return, so that they no longer access the queues.
+  if (job_handle_->IsValid()) job_handle_->Cancel();
   DCHECK_EQ(0, ref_count_);
-  DCHECK_EQ(0, input_queue_length_);
-  DeleteArray(input_queue_);
+  DCHECK(input_queue_.empty());
+}
+
+std::unique_ptr<JobHandle> OptimizingCompileDispatcher::PostJob() {
+  return V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<CompileTask>(isolate_, this));
+}
+
+int64_t OptimizingCompileDispatcher::ComputePriority(JSFunction function,
+                                                     bool is_osr) const {
+  if (is_osr) return std::numeric_limits<int64_t>::max();
+  SharedFunctionInfo shared = function.shared();
+  // Functions without bytecode or feedback only show up in tests.
+  if (!shared.HasBytecodeArray() || !function.has_feedback_vector()) return 0;
+  // Weigh the invocations by the bytecode that has to be compiled for them,
+  // so that a hot function doesn't wait behind a huge lukewarm one.
+  static constexpr int64_t kInvocationsPerBytecodeScale = 1024;
+  int64_t invocations =
+      function.feedback_vector().invocation_count(kRelaxedLoad);
+  int64_t bytecode_length = shared.GetBytecodeArray(isolate_).length();
+  return invocations * kInvocationsPerBytecodeScale / (bytecode_length + 1);
 }
 
 OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  if (input_queue_.empty()) return nullptr;
+  auto next = std::max_element(input_queue_.begin(), input_queue_.end());
+  OptimizedCompilationJob* job = next->job;
   DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
+  input_queue_.erase(next);
+  // Counted while the input queue mutex is held, so that the job is always
+  // accounted for by either the queue or the ref count.
+  ++ref_count_;
   return job;
 }
 
+size_t OptimizingCompileDispatcher::InputQueueLength() {
+  base::MutexGuard access_input_queue_(&input_queue_mutex_);
+  return input_queue_.size();
+}
+
 void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
                                               LocalIsolate* local_isolate) {
-  if (!job) return;
+  DCHECK_NOT_NULL(job);
 
   // The function may have already been optimized by OSR.  Simply continue.
   CompilationJob::Status status =
@@ -125,6 +172,11 @@ void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
   }
 
   if (finalize()) isolate_->stack_guard()->RequestInstallCode();
+
+  {
+    base::MutexGuard lock_guard(&ref_count_mutex_);
+    if (--ref_count_ == 0) ref_count_zero_.NotifyOne();
+  }
 }
 
 void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
@@ -143,24 +195,27 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
 
 void OptimizingCompileDispatcher::FlushInputQueue() {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  while (input_queue_length_ > 0) {
-    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-    DCHECK_NOT_NULL(job);
-    input_queue_shift_ = InputQueueIndex(1);
-    input_queue_length_--;
-    DisposeCompilationJob(job, true);
+  for (const QueuedJob& queued_job : input_queue_) {
+    DisposeCompilationJob(queued_job.job, true);
   }
+  input_queue_.clear();
 }
 
 void OptimizingCompileDispatcher::AwaitCompileTasks() {
   {
-    base::MutexGuard lock_guard(&ref_count_mutex_);
-    while (ref_count_ > 0) ref_count_zero_.Wait(&ref_count_mutex_);
+    // Join contributes this thread to the job and returns once the input
+    // queue has been drained. Park meanwhile so that we don't block
+    // safepoints.
+    ParkedScope parked_scope(isolate_->main_thread_local_isolate());
+    job_handle_->Join();
   }
+  // Join invalidates the job handle, post a new job for later work.
+  job_handle_ = PostJob();
+  DCHECK_EQ(0, ref_count_);
 
 #ifdef DEBUG
   base::MutexGuard access_input_queue(&input_queue_mutex_);
-  CHECK_EQ(input_queue_length_, 0);
+  CHECK(input_queue_.empty());
 #endif  // DEBUG
 }
 
@@ -186,15 +241,24 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
 
 void OptimizingCompileDispatcher::Stop() {
   HandleScope handle_scope(isolate_);
+  FlushInputQueue();
+  // Cancel waits for the workers to return, which finish their current job
+  // first.
+  if (job_handle_->IsValid()) job_handle_->Cancel();
   FlushQueues(BlockingBehavior::kBlock, false);
   // At this point the optimizing compiler thread's event loop has stopped.
-  // There is no need for a mutex when reading input_queue_length_.
-  DCHECK_EQ(input_queue_length_, 0);
+  // There is no need for a mutex when reading input_queue_.
+  DCHECK(input_queue_.empty());
 }
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
 
+  // Don't spend background threads on jobs whose result would be dropped,
+  // and let jobs of functions that got hotter in the meantime go first.
+  CancelStaleJobs();
+  UpdatePriorities();
+
   for (;;) {
     OptimizedCompilationJob* job = nullptr;
     {
@@ -205,7 +269,10 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
     }
     OptimizedCompilationInfo* info = job->compilation_info();
     Handle<JSFunction> function(*info->closure(), isolate_);
-    if (function->HasAvailableCodeKind(info->code_kind())) {
+    // The frame waiting for an OSR job needs its code even if the function
+    // has been optimized in the meantime.
+    if (!info->is_osr() &&
+        function->HasAvailableCodeKind(info->code_kind())) {
       if (FLAG_trace_concurrent_recompilation) {
         PrintF("  ** Aborting compilation for ");
         function->ShortPrint();
@@ -218,26 +285,87 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   }
 }
 
+void OptimizingCompileDispatcher::CancelStaleJobs() {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  size_t length_before = input_queue_.size();
+  auto kept = input_queue_.begin();
+  for (const QueuedJob& queued_job : input_queue_) {
+    OptimizedCompilationInfo* info = queued_job.job->compilation_info();
+    if (info->shared_info()->optimization_disabled()) {
+      DisposeCompilationJob(queued_job.job, true);
+    } else if (!info->is_osr() &&
+               info->closure()->HasAvailableCodeKind(info->code_kind())) {
+      DisposeCompilationJob(queued_job.job, false);
+    } else {
+      *kept++ = queued_job;
+    }
+  }
+  input_queue_.erase(kept, input_queue_.end());
+  if (FLAG_trace_concurrent_recompilation &&
+      input_queue_.size() != length_before) {
+    PrintF("  ** Cancelled %zu stale jobs.\n",
+           length_before - input_queue_.size());
+  }
+}
+
+void OptimizingCompileDispatcher::UpdatePriorities() {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  for (QueuedJob& queued_job : input_queue_) {
+    OptimizedCompilationInfo* info = queued_job.job->compilation_info();
+    queued_job.priority = ComputePriority(*info->closure(), info->is_osr());
+  }
+}
+
+bool OptimizingCompileDispatcher::EnsureQueueAvailable(JSFunction function,
+                                                       bool is_osr) {
+  if (IsQueueAvailable()) return true;
+  CancelStaleJobs();
+  if (IsQueueAvailable()) return true;
+  UpdatePriorities();
+
+  int64_t priority = ComputePriority(function, is_osr);
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  // The queue may have been drained by the workers in the meantime.
+  if (input_queue_.size() < input_queue_capacity_) return true;
+  auto least_important =
+      std::min_element(input_queue_.begin(), input_queue_.end());
+  if (least_important->priority >= priority) return false;
+
+  OptimizedCompilationJob* evicted = least_important->job;
+  input_queue_.erase(least_important);
+  if (FLAG_trace_concurrent_recompilation) {
+    PrintF("  ** Evicting ");
+    evicted->compilation_info()->closure()->ShortPrint();
+    PrintF(" from the compilation queue for ");
+    function.ShortPrint();
+    PrintF(".\n");
+  }
+  DisposeCompilationJob(evicted, true);
+  return true;
+}
+
 bool OptimizingCompileDispatcher::HasJobs() {
   DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
   // Note: This relies on {output_queue_} being mutated by a background thread
-  // only when {ref_count_} is not zero. Also, {ref_count_} is never incremented
-  // by a background thread.
-  return ref_count_ != 0 || !output_queue_.empty();
+  // only when {ref_count_} is not zero. Also, a job is always accounted for by
+  // either {input_queue_} or {ref_count_}.
+  return InputQueueLength() != 0 || ref_count_ != 0 || !output_queue_.empty();
 }
 
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  OptimizedCompilationInfo* info = job->compilation_info();
+  int64_t priority = ComputePriority(*info->closure(), info->is_osr());
   {
-    // Add job to the back of the input queue.
+    // Add job to the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
-    input_queue_length_++;
+    DCHECK_LT(input_queue_.size(), input_queue_capacity_);
+    input_queue_.push_back({job, priority, next_sequence_number_++});
   }
-  V8::GetCurrentPlatform()->CallOnWorkerThread(
-      std::make_unique<CompileTask>(isolate_, this));
+  job_handle_->NotifyConcurrencyIncrease();
 }
 
 }  // namespace internal
@@ -6,7 +6,9 @@
 #define V8_COMPILER_DISPATCHER_OPTIMIZING_COMPILE_DISPATCHER_H_
 
 #include <atomic>
+#include <memory>
 #include <queue>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
@@ -16,8 +18,12 @@
 #include "src/utils/allocation.h"
 
 namespace v8 {
+
+class JobHandle;
+
 namespace internal {
 
+class JSFunction;
 class LocalHeap;
 class OptimizedCompilationJob;
 class RuntimeCallStats;
@@ -25,15 +31,7 @@ class SharedFunctionInfo;
 
 class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
  public:
-  explicit OptimizingCompileDispatcher(Isolate* isolate)
-      : isolate_(isolate),
-        input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
-        input_queue_length_(0),
-        input_queue_shift_(0),
-        ref_count_(0),
-        recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
-  }
+  explicit OptimizingCompileDispatcher(Isolate* isolate);
 
   ~OptimizingCompileDispatcher();
 
@@ -46,9 +44,25 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
+    return input_queue_.size() < input_queue_capacity_;
   }
 
+  // Makes room in the input queue for a job for the given function, if the
+  // queue is full. Stale jobs are cancelled first, then the least important
+  // job is evicted if it is less important than the new one. Returns whether
+  // the job can be queued. This method must be called on the main thread.
+  bool EnsureQueueAvailable(JSFunction function, bool is_osr);
+
+  // Cancels queued jobs whose result would be thrown away, e.g. because their
+  // function has been optimized in the meantime. This method must be called
+  // on the main thread.
+  void CancelStaleJobs();
+
+  // Recomputes the priorities of queued jobs, since their functions may have
+  // been invoked many more times while they waited. This method must be
+  // called on the main thread.
+  void UpdatePriorities();
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
   // This method must be called on the main thread.
@@ -66,7 +80,26 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
  private:
   class CompileTask;
 
-  enum ModeFlag { COMPILE, FLUSH };
+  // A queued job, together with its priority as of the last update. Jobs
+  // with higher priority are compiled first, and jobs of equal priority in
+  // the order they were queued.
+  struct QueuedJob {
+    OptimizedCompilationJob* job;
+    int64_t priority;
+    uint64_t sequence_number;
+
+    bool operator<(const QueuedJob& other) const {
+      if (priority != other.priority) return priority < other.priority;
+      return sequence_number > other.sequence_number;
+    }
+  };
+
+  // Jobs are prioritized by the accumulated hotness of their function, per
+  // bytecode to compile, such that hot and small functions go first. OSR jobs
+  // go before all others, since an unoptimized frame is waiting for them.
+  int64_t ComputePriority(JSFunction function, bool is_osr) const;
+
+  std::unique_ptr<JobHandle> PostJob();
 
   void FlushQueues(BlockingBehavior blocking_behavior,
                    bool restore_function_code);
@@ -74,21 +107,16 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(OptimizedCompilationJob* job, LocalIsolate* local_isolate);
   OptimizedCompilationJob* NextInput(LocalIsolate* local_isolate);
-
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
+  size_t InputQueueLength();
 
   Isolate* isolate_;
+  std::unique_ptr<JobHandle> job_handle_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
-  int input_queue_capacity_;
-  int input_queue_length_;
-  int input_queue_shift_;
+  // Incoming recompilation tasks (including OSR), ordered by priority. The
+  // capacity is small, so a vector that is searched linearly is good enough.
+  std::vector<QueuedJob> input_queue_;
+  size_t input_queue_capacity_;
+  uint64_t next_sequence_number_ = 0;
   base::Mutex input_queue_mutex_;
 
   // Queue of recompilation tasks ready to be installed (excluding OSR).
@@ -97,6 +125,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // different threads.
   base::Mutex output_queue_mutex_;
 
+  // Number of jobs taken from the input queue that are still compiling.
   std::atomic<int> ref_count_;
   base::Mutex ref_count_mutex_;
   base::ConditionVariable ref_count_zero_;
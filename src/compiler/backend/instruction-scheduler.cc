@@ -81,7 +81,8 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
       pending_loads_(zone),
       last_live_in_reg_marker_(nullptr),
       last_deopt_or_trap_(nullptr),
-      operands_map_(zone) {
+      operands_map_(zone),
+      schedule_block_(true) {
   if (FLAG_turbo_stress_instruction_scheduling) {
     random_number_generator_ =
         base::Optional<base::RandomNumberGenerator>(FLAG_random_seed);
@@ -95,11 +96,14 @@ void InstructionScheduler::StartBlock(RpoNumber rpo) {
   DCHECK_NULL(last_live_in_reg_marker_);
   DCHECK_NULL(last_deopt_or_trap_);
   DCHECK(operands_map_.empty());
+  schedule_block_ = ShouldScheduleBlock(rpo);
   sequence()->StartBlock(rpo);
 }
 
 void InstructionScheduler::EndBlock(RpoNumber rpo) {
-  if (FLAG_turbo_stress_instruction_scheduling) {
+  if (!schedule_block_) {
+    DCHECK(graph_.empty());
+  } else if (FLAG_turbo_stress_instruction_scheduling) {
     Schedule<StressSchedulerQueue>();
   } else {
     Schedule<CriticalPathFirstQueue>();
@@ -107,7 +111,23 @@ void InstructionScheduler::EndBlock(RpoNumber rpo) {
   sequence()->EndBlock(rpo);
 }
 
+bool InstructionScheduler::ShouldScheduleBlock(RpoNumber rpo) const {
+  if (FLAG_turbo_instruction_scheduling ||
+      !FLAG_turbo_loop_instruction_scheduling) {
+    return true;
+  }
+  // Only spend compile time on blocks which are likely to be executed
+  // repeatedly, i.e. blocks in loops which are not deferred.
+  const InstructionBlock* block = sequence_->InstructionBlockAt(rpo);
+  if (block->IsDeferred()) return false;
+  return block->IsLoopHeader() || block->loop_header().IsValid();
+}
+
 void InstructionScheduler::AddTerminator(Instruction* instr) {
+  if (!schedule_block_) {
+    sequence()->AddInstruction(instr);
+    return;
+  }
   ScheduleGraphNode* new_node = zone()->New<ScheduleGraphNode>(zone(), instr);
   // Make sure that basic block terminators are not moved by adding them
   // as successor of every instruction.
@@ -118,6 +138,11 @@ void InstructionScheduler::AddTerminator(Instruction* instr) {
 }
 
 void InstructionScheduler::AddInstruction(Instruction* instr) {
+  if (!schedule_block_) {
+    sequence()->AddInstruction(instr);
+    return;
+  }
+
   if (IsBarrier(instr)) {
     if (FLAG_turbo_stress_instruction_scheduling) {
       Schedule<StressSchedulerQueue>();
@@ -145,6 +145,10 @@ class InstructionScheduler final : public ZoneObject {
     }
   };
 
+  // Whether the instructions of the block {rpo} should be reordered, or just
+  // be emitted in their original order.
+  bool ShouldScheduleBlock(RpoNumber rpo) const;
+
   // Perform scheduling for the current block specifying the queue type to
   // use to determine the next best candidate.
   template <typename QueueType>
@@ -244,6 +248,9 @@ class InstructionScheduler final : public ZoneObject {
   ZoneMap<int32_t, ScheduleGraphNode*> operands_map_;
 
   base::Optional<base::RandomNumberGenerator> random_number_generator_;
+
+  // Whether the instructions of the current block are reordered.
+  bool schedule_block_;
 };
 
 }  // namespace compiler
@@ -308,9 +308,11 @@ class V8_EXPORT_PRIVATE InstructionSelector final {
       size_t* max_pushed_argument_count,
       SourcePositionMode source_position_mode = kCallSourcePositions,
       Features features = SupportedFeatures(),
-      EnableScheduling enable_scheduling = FLAG_turbo_instruction_scheduling
-                                               ? kEnableScheduling
-                                               : kDisableScheduling,
+      EnableScheduling enable_scheduling =
+          FLAG_turbo_instruction_scheduling ||
+                  FLAG_turbo_loop_instruction_scheduling
+              ? kEnableScheduling
+              : kDisableScheduling,
       EnableRootsRelativeAddressing enable_roots_relative_addressing =
           kDisableRootsRelativeAddressing,
       EnableTraceTurboJson trace_turbo = kDisableTraceTurboJson);
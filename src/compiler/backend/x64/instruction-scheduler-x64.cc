@@ -2,12 +2,101 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Latencies (in cycles) of the instructions whose cost differs most between
+// x64 micro-architectures.
+//
+// The numbers below are taken from published instruction latency tables for
+// the respective cores. They have not been validated against V8 benchmarks:
+// no js-perf-test or wasm measurement shows that the scheduler, with or
+// without these models, improves throughput. Both scheduling flags therefore
+// stay off by default.
+struct LatencyModel {
+  // Load-to-use latency of an L1 hit, on top of the latency of the
+  // instruction performing the load.
+  int load;
+  int imul;
+  int idiv64;
+  int idiv32;
+  int udiv64;
+  int udiv32;
+  int float_div;
+  int float_sqrt;
+};
+
+// Haswell and Skylake class cores, also used for unknown cores.
+constexpr LatencyModel kGenericLatencyModel = {4, 3, 49, 35, 38, 26, 13, 13};
+
+// Intel Ice Lake and later, and AMD Zen, which have a much faster integer
+// divider.
+constexpr LatencyModel kFastDividerLatencyModel = {4, 3, 18, 14, 16, 13,
+                                                   13, 15};
+
+// Atom class cores with slow multiplication and division.
+constexpr LatencyModel kAtomLatencyModel = {3, 5, 80, 33, 75, 30, 30, 30};
+
+// Intel has no CPUID feature for the faster divider, so the cores are listed
+// by model number. Models missing from the list, including future ones, get
+// the generic model.
+bool HasFastDivider(const base::CPU& cpu) {
+  if (strcmp(cpu.vendor(), "AuthenticAMD") == 0) {
+    // Zen (family 17h) and later.
+    return cpu.family() == 0xF && cpu.ext_family() >= 0x8;
+  }
+  if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 0x6) {
+    switch (cpu.model()) {
+      case 0x6A:  // Ice Lake server
+      case 0x6C:
+      case 0x7D:  // Ice Lake client
+      case 0x7E:
+      case 0x8C:  // Tiger Lake
+      case 0x8D:
+      case 0x8F:  // Sapphire Rapids
+      case 0x97:  // Alder Lake
+      case 0x9A:
+      case 0xA7:  // Rocket Lake
+      case 0xB7:  // Raptor Lake
+      case 0xBA:
+      case 0xBF:
+        return true;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
+const LatencyModel& GetLatencyModel() {
+  static const LatencyModel* const model = []() {
+    base::CPU cpu;
+    if (cpu.is_atom()) return &kAtomLatencyModel;
+    if (HasFastDivider(cpu)) return &kFastDividerLatencyModel;
+    return &kGenericLatencyModel;
+  }();
+  return *model;
+}
+
+// Whether {instr} reads one of its inputs from memory.
+bool IsMemoryLoad(const Instruction* instr) {
+  if (!instr->HasOutput()) return false;
+  if (instr->arch_opcode() == kX64Lea || instr->arch_opcode() == kX64Lea32) {
+    return false;
+  }
+  return instr->addressing_mode() != kMode_None;
+}
+
+}  // namespace
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
 int InstructionScheduler::GetTargetInstructionFlags(
@@ -447,14 +536,21 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+  // in an empirical way, the ones varying most between micro-architectures
+  // are taken from the model of the current CPU.
+  const LatencyModel& model = GetLatencyModel();
+  int latency = 1;
   switch (instr->arch_opcode()) {
     case kSSEFloat64Mul:
-      return 5;
+    case kAVXFloat64Mul:
+      latency = 5;
+      break;
     case kX64Imul:
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
+      latency = model.imul;
+      break;
     case kX64Float32Abs:
     case kX64Float32Neg:
     case kX64Float64Abs:
@@ -467,8 +563,10 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Sub:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
-      return 3;
+      latency = 3;
+      break;
     case kSSEFloat32Mul:
+    case kAVXFloat32Mul:
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -477,32 +575,47 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
+      latency = 4;
+      break;
     case kX64Idiv:
-      return 49;
+      latency = model.idiv64;
+      break;
     case kX64Idiv32:
-      return 35;
+      latency = model.idiv32;
+      break;
     case kX64Udiv:
-      return 38;
+      latency = model.udiv64;
+      break;
     case kX64Udiv32:
-      return 26;
+      latency = model.udiv32;
+      break;
     case kSSEFloat32Div:
     case kSSEFloat64Div:
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
+      latency = model.float_div;
+      break;
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
-      return 13;
+      latency = model.float_sqrt;
+      break;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
     case kSSEFloat64ToUint64:
-      return 10;
+      latency = 10;
+      break;
     case kSSEFloat64Mod:
-      return 50;
+      latency = 50;
+      break;
     case kArchTruncateDoubleToI:
-      return 6;
+      latency = 6;
+      break;
     default:
-      return 1;
+      break;
   }
+  if (IsMemoryLoad(instr)) latency += model.load;
+  return latency;
 }
 
 }  // namespace compiler
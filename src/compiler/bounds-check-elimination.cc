@@ -0,0 +1,58 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/bounds-check-elimination.h"
+
+#include "src/compiler/all-nodes.h"
+#include "src/compiler/common-operator.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/loop-variable-optimizer.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_loop) PrintF(__VA_ARGS__); \
+  } while (false)
+
+void BoundsCheckElimination::Run() {
+  LoopVariableOptimizer induction_vars(graph_, common_, temp_zone_);
+  induction_vars.Run();
+  if (induction_vars.induction_variables().empty()) return;
+
+  // CheckBounds only passes non-negative integral indices.
+  Type const index_range = Type::Range(0.0, kMaxSafeInteger, graph_->zone());
+  AllNodes all(temp_zone_, graph_);
+  for (Node* node : all.reachable) {
+    if (node->opcode() != IrOpcode::kCheckBounds) continue;
+    Node* index = NodeProperties::GetValueInput(node, 0);
+    Node* length = NodeProperties::GetValueInput(node, 1);
+    if (!NodeProperties::IsTyped(index) ||
+        !NodeProperties::GetType(index).Is(index_range)) {
+      continue;
+    }
+    Node* control = NodeProperties::GetControlInput(node);
+    if (!induction_vars.HasConstraint(control, index,
+                                      InductionVariable::kStrict, length)) {
+      continue;
+    }
+    TRACE("Eliminating bounds check #%d on index #%d and length #%d\n",
+          node->id(), index->id(), length->id());
+    // Keep the narrowed type of the check, which the representation
+    // selection relies on to pick the index representation.
+    node->RemoveInput(1);
+    NodeProperties::ChangeOp(node,
+                             common_->TypeGuard(NodeProperties::GetType(node)));
+  }
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
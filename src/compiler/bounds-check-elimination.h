@@ -0,0 +1,50 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+#define V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class CommonOperatorBuilder;
+class Graph;
+class Node;
+
+// Removes CheckBounds nodes whose index is an induction variable that is
+// known to be below the length on every path reaching the check, e.g. by the
+// condition of a loop like
+//
+//   for (let i = 0; i < a.length; i++) a[i] ...
+//
+// The typer can't prove this, as the length is only known to be some
+// array length. The lower bound of the index is taken from its type, and the
+// upper bound from the comparisons the LoopVariableOptimizer collects along
+// the control flow. Checks that are redundant with a dominating CheckBounds
+// on the same length are already removed by RedundancyElimination. This
+// relies on load elimination to have unified the loads of the length in the
+// loop condition and the element access.
+class V8_EXPORT_PRIVATE BoundsCheckElimination final {
+ public:
+  BoundsCheckElimination(Graph* graph, CommonOperatorBuilder* common,
+                         Zone* temp_zone)
+      : graph_(graph), common_(common), temp_zone_(temp_zone) {}
+
+  void Run();
+
+ private:
+  Graph* const graph_;
+  CommonOperatorBuilder* const common_;
+  Zone* const temp_zone_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
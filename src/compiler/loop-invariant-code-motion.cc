@@ -0,0 +1,388 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include <algorithm>
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/operator-properties.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_loop) PrintF(__VA_ARGS__); \
+  } while (false)
+
+void LoopInvariantCodeMotion::Run() {
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    VisitLoop(loop);
+  }
+}
+
+void LoopInvariantCodeMotion::VisitLoop(LoopTree::Loop* loop) {
+  for (LoopTree::Loop* inner_loop : loop->children()) {
+    VisitLoop(inner_loop);
+  }
+  HoistFromLoop(loop);
+}
+
+bool LoopInvariantCodeMotion::IsReadOnly(LoopTree::Loop* loop) {
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    if (node->op()->EffectOutputCount() == 0) continue;
+    switch (node->opcode()) {
+      case IrOpcode::kLoopExitEffect:
+        continue;
+      case IrOpcode::kCheckMaps:
+        // Migrating an instance changes its map and backing store.
+        if (CheckMapsParametersOf(node->op()).flags() &
+            CheckMapsFlag::kTryMigrateInstance) {
+          return false;
+        }
+        continue;
+      default:
+        if (!node->op()->HasProperty(Operator::kNoWrite)) return false;
+        continue;
+    }
+  }
+  return true;
+}
+
+bool LoopInvariantCodeMotion::IsInvariant(LoopTree::Loop* loop, Node* node) {
+  if (hoisted_.count(node) != 0) return true;
+  // Nodes created for the entries of inner loops are still in this loop.
+  if (node->id() >= first_new_node_id_) return false;
+  return !loop_tree_->Contains(loop, node);
+}
+
+bool LoopInvariantCodeMotion::IsHoistable(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kCheckMaps:
+      return !(CheckMapsParametersOf(node->op()).flags() &
+               CheckMapsFlag::kTryMigrateInstance);
+    case IrOpcode::kCheckBounds:
+    case IrOpcode::kCheckHeapObject:
+    case IrOpcode::kCheckInternalizedString:
+    case IrOpcode::kCheckNumber:
+    case IrOpcode::kCheckReceiver:
+    case IrOpcode::kCheckSmi:
+    case IrOpcode::kCheckString:
+    case IrOpcode::kCheckSymbol:
+    case IrOpcode::kLoadField:
+      return true;
+    default:
+      return false;
+  }
+}
+
+Node* LoopInvariantCodeMotion::BodyControl(Node* loop_node, Node** branch) {
+  *branch = nullptr;
+  for (Node* use : loop_node->uses()) {
+    if (use->op()->ControlOutputCount() == 0 ||
+        use->opcode() == IrOpcode::kLoopExit ||
+        use->opcode() == IrOpcode::kTerminate) {
+      continue;
+    }
+    if (*branch != nullptr || use->opcode() != IrOpcode::kBranch) {
+      return nullptr;
+    }
+    *branch = use;
+  }
+  if (*branch == nullptr) return nullptr;
+
+  Node* body_control = nullptr;
+  Node* exit_control = nullptr;
+  for (Node* projection : (*branch)->uses()) {
+    bool exits = false;
+    for (Node* use : projection->uses()) {
+      if (use->opcode() == IrOpcode::kLoopExit &&
+          use->InputAt(1) == loop_node) {
+        exits = true;
+      }
+    }
+    Node** control = exits ? &exit_control : &body_control;
+    if (*control != nullptr) return nullptr;
+    *control = projection;
+  }
+  if (exit_control == nullptr) return nullptr;
+  return body_control;
+}
+
+Node* LoopInvariantCodeMotion::PlaceholderFor(Node* node) {
+  Type type = NodeProperties::GetType(node);
+  for (Node* candidate :
+       {jsgraph_->ZeroConstant(), jsgraph_->UndefinedConstant(),
+        jsgraph_->EmptyStringConstant()}) {
+    if (NodeProperties::GetType(candidate).Is(type)) return candidate;
+  }
+  return nullptr;
+}
+
+Node* LoopInvariantCodeMotion::StateOnEntry(LoopTree::Loop* loop,
+                                            Node* loop_node, Node* state) {
+  if (IsInvariant(loop, state)) return state;
+  if (state->opcode() == IrOpcode::kPhi &&
+      NodeProperties::GetControlInput(state) == loop_node) {
+    return state->InputAt(0);
+  }
+  if (state->opcode() != IrOpcode::kFrameState &&
+      state->opcode() != IrOpcode::kStateValues &&
+      state->opcode() != IrOpcode::kTypedStateValues) {
+    return nullptr;
+  }
+  Node* copy = nullptr;
+  for (int i = 0; i < state->InputCount(); ++i) {
+    Node* input = state->InputAt(i);
+    Node* entry_input = StateOnEntry(loop, loop_node, input);
+    if (entry_input == nullptr) return nullptr;
+    if (entry_input == input) continue;
+    if (copy == nullptr) copy = graph_->CloneNode(state);
+    copy->ReplaceInput(i, entry_input);
+  }
+  return copy == nullptr ? state : copy;
+}
+
+namespace {
+
+// Bounds the size of the expressions that are recomputed on entry to a loop
+// to guard the nodes hoisted from its body.
+constexpr int kMaxEntryValueDepth = 8;
+
+bool IsLoopPhi(Node* node, Node* loop_node) {
+  return node->opcode() == IrOpcode::kPhi &&
+         NodeProperties::GetControlInput(node) == loop_node;
+}
+
+}  // namespace
+
+bool LoopInvariantCodeMotion::IsAvailableOnEntry(LoopEntry* entry, Node* node,
+                                                 int depth,
+                                                 bool* needs_checkpoint) {
+  if (IsInvariant(entry->loop, node) || IsLoopPhi(node, entry->loop_node)) {
+    return true;
+  }
+  if (depth == kMaxEntryValueDepth) return false;
+  const Operator* op = node->op();
+  if (op->ValueOutputCount() != 1 || op->ControlOutputCount() != 0 ||
+      OperatorProperties::HasContextInput(op) ||
+      OperatorProperties::HasFrameStateInput(op)) {
+    return false;
+  }
+  if (op->EffectInputCount() != 0 || op->ControlInputCount() != 0) {
+    // Copies of effectful nodes are placed on the entry's effect chain, so
+    // they have to come from the header and must neither read nor write.
+    if (!op->HasProperty(Operator::kFoldable) ||
+        op->ControlInputCount() != 1 ||
+        NodeProperties::GetControlInput(node) != entry->loop_node) {
+      return false;
+    }
+    if (!op->HasProperty(Operator::kNoDeopt)) *needs_checkpoint = true;
+  }
+  for (int i = 0; i < op->ValueInputCount(); ++i) {
+    if (!IsAvailableOnEntry(entry, NodeProperties::GetValueInput(node, i),
+                            depth + 1, needs_checkpoint)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Node* LoopInvariantCodeMotion::ValueOnEntry(LoopEntry* entry, Node* node) {
+  if (IsInvariant(entry->loop, node)) return node;
+  if (IsLoopPhi(node, entry->loop_node)) return node->InputAt(0);
+  Node* copy = graph_->CloneNode(node);
+  for (int i = 0; i < node->op()->ValueInputCount(); ++i) {
+    copy->ReplaceInput(
+        i, ValueOnEntry(entry, NodeProperties::GetValueInput(node, i)));
+  }
+  if (copy->op()->ControlInputCount() != 0) {
+    NodeProperties::ReplaceControlInput(copy, entry->control);
+  }
+  if (copy->op()->EffectInputCount() != 0) {
+    NodeProperties::ReplaceEffectInput(copy, entry->effect);
+    entry->effect = copy;
+  }
+  return copy;
+}
+
+bool LoopInvariantCodeMotion::EnsureEntryCheckpoint(LoopEntry* entry) {
+  if (entry->entry_checkpoint != nullptr) return true;
+  if (entry->checkpoint == nullptr) return false;
+  Node* frame_state =
+      StateOnEntry(entry->loop, entry->loop_node,
+                   NodeProperties::GetFrameStateInput(entry->checkpoint));
+  if (frame_state == nullptr) return false;
+  entry->entry_checkpoint = graph_->NewNode(
+      common_->Checkpoint(), frame_state, entry->effect, entry->control);
+  entry->effect = entry->entry_checkpoint;
+  return true;
+}
+
+bool LoopInvariantCodeMotion::InsertGuard(LoopEntry* entry, Node* branch,
+                                          Node* body_control) {
+  Node* condition = NodeProperties::GetValueInput(branch, 0);
+  bool needs_checkpoint = false;
+  if (!IsAvailableOnEntry(entry, condition, 0, &needs_checkpoint)) {
+    return false;
+  }
+  if (needs_checkpoint && !EnsureEntryCheckpoint(entry)) return false;
+  Node* guard = graph_->NewNode(branch->op(), ValueOnEntry(entry, condition),
+                                entry->control);
+  const Operator* skip_op = body_control->opcode() == IrOpcode::kIfTrue
+                                ? common_->IfFalse()
+                                : common_->IfTrue();
+  entry->skip_control = graph_->NewNode(skip_op, guard);
+  entry->skip_effect = entry->effect;
+  entry->control = graph_->NewNode(body_control->op(), guard);
+  TRACE("Guarding nodes hoisted out of loop #%d with #%d:%s\n",
+        entry->loop_node->id(), guard->id(), guard->op()->mnemonic());
+  return true;
+}
+
+void LoopInvariantCodeMotion::Hoist(LoopEntry* entry, Node* node) {
+  TRACE("Hoisting #%d:%s out of loop #%d\n", node->id(), node->op()->mnemonic(),
+        entry->loop_node->id());
+  Node* effect = NodeProperties::GetEffectInput(node);
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(effect);
+  }
+  NodeProperties::ReplaceEffectInput(node, entry->effect);
+  NodeProperties::ReplaceControlInput(node, entry->control);
+  entry->effect = node;
+  hoisted_.insert(node);
+}
+
+void LoopInvariantCodeMotion::FinishEntry(LoopEntry* entry, Node* effect_phi) {
+  if (entry->skip_control != nullptr) {
+    Node* merge = graph_->NewNode(common_->Merge(2), entry->control,
+                                  entry->skip_control);
+    entry->effect = graph_->NewNode(common_->EffectPhi(2), entry->effect,
+                                    entry->skip_effect, merge);
+    entry->control = merge;
+    // The body doesn't run if the guard is skipped, so the placeholders are
+    // never used.
+    for (Node* node : guarded_) {
+      if (node->op()->ValueOutputCount() == 0) continue;
+      Node* phi =
+          graph_->NewNode(common_->Phi(MachineRepresentation::kTagged, 2),
+                          node, PlaceholderFor(node), merge);
+      for (Edge edge : node->use_edges()) {
+        Node* use = edge.from();
+        if (use == phi || !NodeProperties::IsValueEdge(edge) ||
+            std::find(guarded_.begin(), guarded_.end(), use) !=
+                guarded_.end()) {
+          continue;
+        }
+        edge.UpdateTo(phi);
+      }
+    }
+  }
+  entry->loop_node->ReplaceInput(0, entry->control);
+  effect_phi->ReplaceInput(0, entry->effect);
+}
+
+void LoopInvariantCodeMotion::HoistFromLoop(LoopTree::Loop* loop) {
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  Node* effect_phi = nullptr;
+  for (Node* use : loop_node->uses()) {
+    if (use->opcode() == IrOpcode::kEffectPhi) {
+      effect_phi = use;
+      break;
+    }
+  }
+  if (effect_phi == nullptr) return;
+  if (!IsReadOnly(loop)) return;
+
+  hoisted_.clear();
+  guarded_.clear();
+  LoopEntry entry{loop, loop_node, loop_node->InputAt(0),
+                  effect_phi->InputAt(0)};
+  // The Branch that leaves the loop at the end of the header, once the walk
+  // has reached the body.
+  Node* exit_branch = nullptr;
+
+  // Walk the effect chain of the loop header, i.e. the effectful nodes that
+  // are controlled by the loop node itself, and then that of the first block
+  // of the body.
+  Node* effect = effect_phi;
+  Node* control = loop_node;
+  while (true) {
+    Node* next = nullptr;
+    bool forked = false;
+    for (Edge edge : effect->use_edges()) {
+      Node* use = edge.from();
+      if (use == effect_phi || !NodeProperties::IsEffectEdge(edge)) continue;
+      if (use->op()->ControlInputCount() == 0 ||
+          NodeProperties::GetControlInput(use) != control) {
+        continue;
+      }
+      if (next != nullptr) forked = true;
+      next = use;
+    }
+    if (forked) break;
+    if (next == nullptr) {
+      if (control != loop_node) break;
+      control = BodyControl(loop_node, &exit_branch);
+      if (control == nullptr) break;
+      continue;
+    }
+    bool in_body = control != loop_node;
+
+    if (next->opcode() == IrOpcode::kCheckpoint) {
+      // Nodes hoisted from the body deoptimize to the header as well, which
+      // is then evaluated again by the interpreter.
+      if (!in_body) {
+        entry.checkpoint = next;
+        entry.entry_checkpoint = nullptr;
+      }
+      effect = next;
+      continue;
+    }
+
+    bool invariant = IsHoistable(next);
+    for (int i = 0; invariant && i < next->op()->ValueInputCount(); ++i) {
+      invariant = IsInvariant(loop, NodeProperties::GetValueInput(next, i));
+    }
+    if (invariant && in_body && next->op()->ValueOutputCount() != 0) {
+      invariant = PlaceholderFor(next) != nullptr;
+    }
+    if (!invariant) {
+      // Other nodes may guard the ones behind them, so we can only move past
+      // nodes that can't write, and that either can't deoptimize or don't
+      // read either, i.e. only guard their own uses, which stay in the loop.
+      if (!next->op()->HasProperty(Operator::kNoWrite) ||
+          !(next->op()->HasProperty(Operator::kNoDeopt) ||
+            next->op()->HasProperty(Operator::kFoldable))) {
+        break;
+      }
+      effect = next;
+      continue;
+    }
+
+    if (!next->op()->HasProperty(Operator::kNoDeopt) &&
+        !EnsureEntryCheckpoint(&entry)) {
+      break;
+    }
+    if (in_body && entry.skip_control == nullptr &&
+        !InsertGuard(&entry, exit_branch, control)) {
+      break;
+    }
+    Hoist(&entry, next);
+    if (in_body) guarded_.push_back(next);
+  }
+  FinishEntry(&entry, effect_phi);
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
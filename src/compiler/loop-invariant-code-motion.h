@@ -0,0 +1,126 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+#define V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/common/globals.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Hoists loop-invariant checks and field loads out of loops.
+//
+// Pure nodes float in the graph and are already placed outside of loops by
+// the scheduler. This pass handles the nodes that are pinned to the loop by
+// their effect and control inputs, e.g. CheckMaps on an invariant receiver or
+// the load of an invariant array's length. Loops that may write to the heap
+// are skipped entirely, and checks that may deoptimize are given a copy of the
+// header's Checkpoint, with the loop phis replaced by their values on entry.
+//
+// Nodes on the effect chain of the loop header run at least once per loop
+// entry, so they are hoisted unconditionally. Nodes in the first block of the
+// body, which dominates the back edge, only run if the loop is entered at
+// all. They are hoisted behind a guard that evaluates the header's condition
+// on the values on entry, so loops that run zero iterations don't execute
+// speculation that the original program wouldn't have:
+//
+//          if (condition on entry) { hoisted body nodes }
+//          loop { header; if (!condition) break; body }
+//
+// Values of hoisted body nodes are merged with a placeholder of a compatible
+// type for the path that skips the guard, on which the loop body never runs.
+class V8_EXPORT_PRIVATE LoopInvariantCodeMotion {
+ public:
+  LoopInvariantCodeMotion(JSGraph* jsgraph, LoopTree* loop_tree,
+                          Zone* tmp_zone)
+      : jsgraph_(jsgraph),
+        graph_(jsgraph->graph()),
+        common_(jsgraph->common()),
+        loop_tree_(loop_tree),
+        first_new_node_id_(static_cast<NodeId>(graph_->NodeCount())),
+        hoisted_(tmp_zone),
+        guarded_(tmp_zone) {}
+
+  // Hoists invariant nodes out of all loops of the tree, innermost loops
+  // first.
+  void Run();
+
+ private:
+  // Where hoisted nodes are placed, i.e. the end of the control and effect
+  // chains that enter a loop.
+  struct LoopEntry {
+    LoopTree::Loop* loop;
+    Node* loop_node;
+    Node* control;
+    Node* effect;
+    // The last Checkpoint on the header's effect chain and its copy on entry
+    // to the loop, if one was needed already.
+    Node* checkpoint = nullptr;
+    Node* entry_checkpoint = nullptr;
+    // The control and effect on the path that skips the guard for nodes
+    // hoisted from the body, if one was inserted already.
+    Node* skip_control = nullptr;
+    Node* skip_effect = nullptr;
+  };
+
+  void VisitLoop(LoopTree::Loop* loop);
+  void HoistFromLoop(LoopTree::Loop* loop);
+
+  // Whether no node in the {loop} may write to the heap.
+  bool IsReadOnly(LoopTree::Loop* loop);
+  // Whether {node} is computed outside of the {loop} or has been hoisted.
+  bool IsInvariant(LoopTree::Loop* loop, Node* node);
+  // Whether {node} is an operation this pass knows how to hoist.
+  bool IsHoistable(Node* node);
+  // Returns the projection of the loop header's Branch that stays in the
+  // loop and thus dominates the back edge, or nullptr if the header doesn't
+  // end in such a Branch. The Branch is returned in {branch}.
+  Node* BodyControl(Node* loop_node, Node** branch);
+  // Returns a constant whose type is a subtype of {node}'s, or nullptr.
+  Node* PlaceholderFor(Node* node);
+
+  // Returns {state}, a frame state or state values node, as seen on entry to
+  // the {loop}, or nullptr if it depends on values computed in the loop other
+  // than the loop phis.
+  Node* StateOnEntry(LoopTree::Loop* loop, Node* loop_node, Node* state);
+  // Whether the value {node} can be recomputed on {entry}, see ValueOnEntry.
+  // Sets {needs_checkpoint} if that may deoptimize.
+  bool IsAvailableOnEntry(LoopEntry* entry, Node* node, int depth,
+                          bool* needs_checkpoint);
+  // Returns the value {node} as computed on {entry}. Nodes in the loop are
+  // copied, with the loop phis replaced by their values on entry.
+  Node* ValueOnEntry(LoopEntry* entry, Node* node);
+
+  // Makes sure that nodes that may deoptimize can be placed on {entry}.
+  bool EnsureEntryCheckpoint(LoopEntry* entry);
+  // Starts the guard for nodes hoisted from the body on {entry}.
+  bool InsertGuard(LoopEntry* entry, Node* branch, Node* body_control);
+  // Moves {node} to {entry}.
+  void Hoist(LoopEntry* entry, Node* node);
+  // Merges the guard, if any, and connects {entry} to the loop.
+  void FinishEntry(LoopEntry* entry, Node* effect_phi);
+
+  JSGraph* const jsgraph_;
+  Graph* const graph_;
+  CommonOperatorBuilder* const common_;
+  LoopTree* const loop_tree_;
+  // Nodes created by this pass aren't part of the {loop_tree_}.
+  NodeId const first_new_node_id_;
+  // The nodes hoisted out of the current loop, and those of them that are
+  // behind the guard.
+  ZoneUnorderedSet<Node*> hoisted_;
+  ZoneVector<Node*> guarded_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
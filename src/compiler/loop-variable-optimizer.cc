@@ -226,6 +226,9 @@ InductionVariable* LoopVariableOptimizer::TryGetInductionVariable(Node* phi) {
   DCHECK_EQ(IrOpcode::kLoop, loop->opcode());
   Node* initial = phi->InputAt(0);
   Node* arith = phi->InputAt(1);
+  // Look through the guards inserted by ChangeToPhisAndInsertGuards, such
+  // that induction variables are still found after typing.
+  if (arith->opcode() == IrOpcode::kTypeGuard) arith = arith->InputAt(0);
   InductionVariable::ArithmeticType arithmeticType;
   if (arith->opcode() == IrOpcode::kJSAdd ||
       arith->opcode() == IrOpcode::kNumberAdd ||
@@ -281,6 +284,20 @@ void LoopVariableOptimizer::DetectInductionVariables(Node* loop) {
   TRACE("\n");
 }
 
+bool LoopVariableOptimizer::HasConstraint(
+    Node* control, Node* left, InductionVariable::ConstraintKind kind,
+    Node* right) {
+  for (Constraint constraint : limits_.Get(control)) {
+    if (constraint.left != left || constraint.right != right) continue;
+    // A strict constraint implies the non-strict one.
+    if (constraint.kind == InductionVariable::kStrict ||
+        kind == InductionVariable::kNonStrict) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void LoopVariableOptimizer::ChangeToInductionVariablePhis() {
   for (auto entry : induction_vars_) {
     // It only make sense to analyze the induction variables if
@@ -81,6 +81,12 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Whether the comparison {left} < {right} (or {left} <= {right} for
+  // kNonStrict) is known to hold whenever {control} is reached. Only
+  // comparisons involving an induction variable are tracked.
+  bool HasConstraint(Node* control, Node* left,
+                     InductionVariable::ConstraintKind kind, Node* right);
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
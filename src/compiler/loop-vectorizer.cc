@@ -0,0 +1,707 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorizer.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "src/codegen/cpu-features.h"
+#include "src/compiler/common-operator.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/numbers/conversions.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_loop) PrintF(__VA_ARGS__); \
+  } while (false)
+
+namespace {
+
+// Returns log2 of the element size of the typed array element types we
+// vectorize, or -1 for the others.
+int ElementSizeLog2(ExternalArrayType type) {
+  switch (type) {
+    case kExternalInt32Array:
+    case kExternalUint32Array:
+    case kExternalFloat32Array:
+      return 2;
+    case kExternalFloat64Array:
+      return 3;
+    default:
+      return -1;
+  }
+}
+
+int LaneCount(ExternalArrayType type) {
+  return kSimd128Size >> ElementSizeLog2(type);
+}
+
+}  // namespace
+
+struct LoopVectorizer::Candidate {
+  explicit Candidate(Zone* zone) : chain(zone), loads(zone) {}
+
+  bool is_word64() const {
+    return PhiRepresentationOf(phi->op()) == MachineRepresentation::kWord64;
+  }
+  bool IsLoad(Node* node) const {
+    return std::find(loads.begin(), loads.end(), node) != loads.end();
+  }
+
+  const LoopTree::Loop* tree_loop = nullptr;
+  Node* loop = nullptr;
+  // The induction variable, its increment by one, and the value flowing into
+  // the induction variable on the backedge, which is the increment behind
+  // an optional TypeGuard.
+  Node* phi = nullptr;
+  Node* increment = nullptr;
+  Node* backedge_value = nullptr;
+  Node* effect_phi = nullptr;
+  // The loop is left once {phi} < {limit} fails.
+  Node* condition = nullptr;
+  Node* limit = nullptr;
+  Node* if_true = nullptr;
+  // The effectful nodes of the loop body in effect order, and the typed
+  // array accesses among them.
+  ZoneVector<Node*> chain;
+  ZoneVector<Node*> loads;
+  Node* store = nullptr;
+  ExternalArrayType array_type = kExternalInt8Array;
+};
+
+LoopVectorizer::LoopVectorizer(JSGraph* jsgraph, LoopTree* loop_tree,
+                               Zone* temp_zone)
+    : jsgraph_(jsgraph),
+      loop_tree_(loop_tree),
+      temp_zone_(temp_zone),
+      vectors_(temp_zone) {}
+
+Graph* LoopVectorizer::graph() const { return jsgraph_->graph(); }
+
+CommonOperatorBuilder* LoopVectorizer::common() const {
+  return jsgraph_->common();
+}
+
+MachineOperatorBuilder* LoopVectorizer::machine() const {
+  return jsgraph_->machine();
+}
+
+void LoopVectorizer::Run() {
+  if (!CpuFeatures::SupportsWasmSimd128()) return;
+  for (const LoopTree::Loop* loop : loop_tree_->inner_loops()) {
+    Candidate candidate(temp_zone_);
+    if (!Analyze(loop, &candidate)) continue;
+    TRACE("Vectorizing loop #%d\n", candidate.loop->id());
+    Vectorize(candidate);
+  }
+}
+
+bool LoopVectorizer::Analyze(const LoopTree::Loop* loop, Candidate* c) {
+  c->tree_loop = loop;
+  c->loop = loop_tree_->GetLoopControl(loop);
+  if (c->loop->op()->ControlInputCount() != 2) return false;
+
+  // The loop must have a single induction variable and be exited through a
+  // single branch.
+  Node* branch = nullptr;
+  Node* if_false = nullptr;
+  for (Node* use : c->loop->uses()) {
+    switch (use->opcode()) {
+      case IrOpcode::kPhi:
+        if (c->phi != nullptr) return false;
+        c->phi = use;
+        break;
+      case IrOpcode::kEffectPhi:
+        c->effect_phi = use;
+        break;
+      case IrOpcode::kBranch:
+        if (branch != nullptr) return false;
+        branch = use;
+        break;
+      default:
+        break;
+    }
+  }
+  if (c->phi == nullptr || c->effect_phi == nullptr || branch == nullptr) {
+    return false;
+  }
+  switch (PhiRepresentationOf(c->phi->op())) {
+    case MachineRepresentation::kWord32:
+      break;
+    case MachineRepresentation::kWord64:
+      if (!machine()->Is64()) return false;
+      break;
+    default:
+      return false;
+  }
+
+  // The induction variable counts up by one ...
+  c->backedge_value = c->phi->InputAt(1);
+  c->increment = c->backedge_value;
+  if (c->increment->opcode() == IrOpcode::kTypeGuard) {
+    c->increment = c->increment->InputAt(0);
+  }
+  if (c->is_word64()) {
+    Int64BinopMatcher m(c->increment);
+    if (!m.IsInt64Add() || m.left().node() != c->phi || !m.right().Is(1)) {
+      return false;
+    }
+  } else {
+    Int32BinopMatcher m(c->increment);
+    if (!m.IsInt32Add() || m.left().node() != c->phi || !m.right().Is(1)) {
+      return false;
+    }
+  }
+
+  // ... while it's below the loop-invariant limit.
+  c->condition = branch->InputAt(0);
+  switch (c->condition->opcode()) {
+    case IrOpcode::kInt32LessThan:
+    case IrOpcode::kUint32LessThan:
+      if (c->is_word64()) return false;
+      break;
+    case IrOpcode::kInt64LessThan:
+    case IrOpcode::kUint64LessThan:
+      if (!c->is_word64()) return false;
+      break;
+    default:
+      return false;
+  }
+  if (c->condition->InputAt(0) != c->phi) return false;
+  c->limit = c->condition->InputAt(1);
+  if (loop_tree_->Contains(loop, c->limit)) return false;
+  for (Node* use : branch->uses()) {
+    if (use->opcode() == IrOpcode::kIfTrue) c->if_true = use;
+    if (use->opcode() == IrOpcode::kIfFalse) if_false = use;
+  }
+  if (c->if_true == nullptr) return false;
+
+  // The body is straight-line code, only interrupted by stack checks.
+  for (Node* control = c->loop->InputAt(1); control != c->if_true;
+       control = NodeProperties::GetControlInput(control)) {
+    if (control->opcode() != IrOpcode::kJSStackCheck ||
+        NodeProperties::IsExceptionalCall(control)) {
+      return false;
+    }
+  }
+
+  // Collect the effect chain of the loop.
+  ZoneUnorderedSet<Node*> in_chain(temp_zone_);
+  Node* const last_effect = c->effect_phi->InputAt(1);
+  for (Node* effect = c->effect_phi; effect != last_effect;) {
+    Node* next = nullptr;
+    for (Edge edge : effect->use_edges()) {
+      Node* use = edge.from();
+      if (!NodeProperties::IsEffectEdge(edge) || use == c->effect_phi ||
+          use->opcode() == IrOpcode::kTerminate ||
+          !loop_tree_->Contains(loop, use)) {
+        continue;
+      }
+      if (next != nullptr) return false;
+      next = use;
+    }
+    if (next == nullptr) return false;
+    c->chain.push_back(next);
+    in_chain.insert(next);
+    effect = next;
+  }
+
+  // Besides the loop structure and the effect chain, only pure nodes may be
+  // part of the loop.
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    if (node == c->loop || node == c->phi || node == c->effect_phi ||
+        node == branch || node == c->if_true || node == if_false ||
+        in_chain.count(node) || node->opcode() == IrOpcode::kTerminate) {
+      continue;
+    }
+    const Operator* op = node->op();
+    if (IrOpcode::IsPhiOpcode(node->opcode()) || op->EffectInputCount() > 0 ||
+        op->ControlInputCount() > 0 || op->EffectOutputCount() > 0 ||
+        op->ControlOutputCount() > 0) {
+      return false;
+    }
+  }
+
+  // Check the nodes on the effect chain. Deoptimizations before the store
+  // resume at the start of the vector's first iteration, and lazy
+  // deoptimizations after the store right after its last iteration. No
+  // eager deoptimizations may follow the store, so Checkpoints behind it are
+  // dropped.
+  for (Node* node : c->chain) {
+    const bool after_store = c->store != nullptr;
+    switch (node->opcode()) {
+      case IrOpcode::kCheckpoint:
+        if (!after_store &&
+            !IsSubstitutable(*c, NodeProperties::GetFrameStateInput(node),
+                             false)) {
+          return false;
+        }
+        break;
+      case IrOpcode::kJSStackCheck:
+        if (!IsSubstitutable(*c, NodeProperties::GetFrameStateInput(node),
+                             after_store) ||
+            loop_tree_->Contains(loop, NodeProperties::GetContextInput(node))) {
+          return false;
+        }
+        break;
+      case IrOpcode::kTypeGuard:
+        break;
+      case IrOpcode::kCheckedUint32Bounds:
+      case IrOpcode::kCheckedUint64Bounds:
+        // Checks behind the store would deoptimize to before the store.
+        if (after_store || !IsIndex(*c, node->InputAt(0)) ||
+            loop_tree_->Contains(loop, node->InputAt(1))) {
+          return false;
+        }
+        break;
+      case IrOpcode::kLoadTypedElement:
+      case IrOpcode::kStoreTypedElement: {
+        if (after_store) return false;
+        ExternalArrayType type = ExternalArrayTypeOf(node->op());
+        if (ElementSizeLog2(type) < 0) return false;
+        if (!c->loads.empty() && type != c->array_type) return false;
+        c->array_type = type;
+        // The buffer, base and external pointer of the array.
+        for (int i = 0; i < 3; ++i) {
+          if (loop_tree_->Contains(loop, node->InputAt(i))) return false;
+        }
+        if (!IsIndex(*c, node->InputAt(3))) return false;
+        if (node->opcode() == IrOpcode::kLoadTypedElement) {
+          c->loads.push_back(node);
+        } else {
+          c->store = node;
+        }
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+  if (c->store == nullptr) return false;
+  return IsVectorizable(*c, c->store->InputAt(4));
+}
+
+bool LoopVectorizer::IsIndex(const Candidate& c, Node* node) {
+  while (node != c.phi) {
+    switch (node->opcode()) {
+      case IrOpcode::kChangeInt32ToInt64:
+      case IrOpcode::kChangeUint32ToUint64:
+      case IrOpcode::kCheckedUint32Bounds:
+      case IrOpcode::kCheckedUint64Bounds:
+      case IrOpcode::kTypeGuard:
+        node = node->InputAt(0);
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+bool LoopVectorizer::IsSubstitutable(const Candidate& c, Node* state,
+                                     bool after_store) {
+  if (!loop_tree_->Contains(c.tree_loop, state)) return true;
+  if (state == c.phi) return !after_store;
+  if (state == c.increment || state == c.backedge_value) return after_store;
+  switch (state->opcode()) {
+    case IrOpcode::kFrameState:
+    case IrOpcode::kStateValues:
+    case IrOpcode::kTypedStateValues:
+      break;
+    default:
+      return false;
+  }
+  for (Node* input : state->inputs()) {
+    if (!IsSubstitutable(c, input, after_store)) return false;
+  }
+  return true;
+}
+
+bool LoopVectorizer::IsVectorizable(const Candidate& c, Node* value) {
+  if (c.IsLoad(value)) return true;
+  if (c.array_type == kExternalFloat32Array) {
+    // The arithmetic happens on float64 values, which matches float32
+    // arithmetic for a single operation only.
+    if (value->opcode() != IrOpcode::kTruncateFloat64ToFloat32) return false;
+    value = value->InputAt(0);
+    if (value->opcode() == IrOpcode::kChangeFloat32ToFloat64) {
+      return c.IsLoad(value->InputAt(0));
+    }
+    return VectorOperatorFor(c, value->op()) != nullptr &&
+           IsFloat32Operand(c, value->InputAt(0)) &&
+           IsFloat32Operand(c, value->InputAt(1));
+  }
+  // Loop-invariant values are splatted to all lanes.
+  if (!loop_tree_->Contains(c.tree_loop, value)) return true;
+  return VectorOperatorFor(c, value->op()) != nullptr &&
+         IsVectorizable(c, value->InputAt(0)) &&
+         IsVectorizable(c, value->InputAt(1));
+}
+
+bool LoopVectorizer::IsFloat32Operand(const Candidate& c, Node* node) {
+  if (node->opcode() == IrOpcode::kChangeFloat32ToFloat64) {
+    return c.IsLoad(node->InputAt(0));
+  }
+  Float64Matcher m(node);
+  return m.HasResolvedValue() &&
+         DoubleToFloat32(m.ResolvedValue()) == m.ResolvedValue();
+}
+
+const Operator* LoopVectorizer::VectorOperatorFor(const Candidate& c,
+                                                  const Operator* op) {
+  switch (c.array_type) {
+    case kExternalFloat32Array:
+      switch (op->opcode()) {
+        case IrOpcode::kFloat64Add:
+          return machine()->F32x4Add();
+        case IrOpcode::kFloat64Sub:
+          return machine()->F32x4Sub();
+        case IrOpcode::kFloat64Mul:
+          return machine()->F32x4Mul();
+        case IrOpcode::kFloat64Div:
+          return machine()->F32x4Div();
+        default:
+          return nullptr;
+      }
+    case kExternalFloat64Array:
+      switch (op->opcode()) {
+        case IrOpcode::kFloat64Add:
+          return machine()->F64x2Add();
+        case IrOpcode::kFloat64Sub:
+          return machine()->F64x2Sub();
+        case IrOpcode::kFloat64Mul:
+          return machine()->F64x2Mul();
+        case IrOpcode::kFloat64Div:
+          return machine()->F64x2Div();
+        default:
+          return nullptr;
+      }
+    case kExternalInt32Array:
+    case kExternalUint32Array:
+      switch (op->opcode()) {
+        case IrOpcode::kInt32Add:
+          return machine()->I32x4Add();
+        case IrOpcode::kInt32Sub:
+          return machine()->I32x4Sub();
+        case IrOpcode::kInt32Mul:
+          return machine()->I32x4Mul();
+        case IrOpcode::kWord32And:
+          return machine()->S128And();
+        case IrOpcode::kWord32Or:
+          return machine()->S128Or();
+        case IrOpcode::kWord32Xor:
+          return machine()->S128Xor();
+        default:
+          return nullptr;
+      }
+    default:
+      return nullptr;
+  }
+}
+
+Node* LoopVectorizer::BuildIndex(const Candidate& c, Node* node,
+                                 Node* index) {
+  if (node == c.phi) return index;
+  switch (node->opcode()) {
+    case IrOpcode::kChangeInt32ToInt64:
+    case IrOpcode::kChangeUint32ToUint64:
+      return graph()->NewNode(node->op(),
+                              BuildIndex(c, node->InputAt(0), index));
+    default:
+      return BuildIndex(c, node->InputAt(0), index);
+  }
+}
+
+Node* LoopVectorizer::BuildFrameState(const Candidate& c, Node* state,
+                                      Node* vector_index,
+                                      Node* next_vector_index) {
+  if (!loop_tree_->Contains(c.tree_loop, state)) return state;
+  if (state == c.phi) return vector_index;
+  if (state == c.increment || state == c.backedge_value) {
+    return next_vector_index;
+  }
+  Node* copy = nullptr;
+  for (int i = 0; i < state->InputCount(); ++i) {
+    Node* input = state->InputAt(i);
+    Node* vector_input =
+        BuildFrameState(c, input, vector_index, next_vector_index);
+    if (vector_input == input) continue;
+    if (copy == nullptr) copy = graph()->CloneNode(state);
+    copy->ReplaceInput(i, vector_input);
+  }
+  return copy == nullptr ? state : copy;
+}
+
+Node* LoopVectorizer::BuildOffset(const Candidate& c, Node* vector_index) {
+  Node* index = vector_index;
+  if (!c.is_word64() && machine()->Is64()) {
+    index = graph()->NewNode(machine()->ChangeUint32ToUint64(), index);
+  }
+  return graph()->NewNode(
+      machine()->WordShl(), index,
+      jsgraph_->IntPtrConstant(ElementSizeLog2(c.array_type)));
+}
+
+// Mirrors EffectControlLinearizer::BuildTypedArrayDataPointer.
+Node* LoopVectorizer::BuildDataPointer(Node* base, Node* external,
+                                       Node** effect, Node* control) {
+  if (IntPtrMatcher(base).Is(0)) return external;
+  base = graph()->NewNode(machine()->BitcastTaggedToWord(), base);
+  if (COMPRESS_POINTERS_BOOL) {
+    base = graph()->NewNode(machine()->ChangeUint32ToUint64(), base);
+  }
+  return *effect = graph()->NewNode(machine()->UnsafePointerAdd(), base,
+                                    external, *effect, control);
+}
+
+// Returns a word32 that is non-zero if {load} may read an element that the
+// store of the loop writes for another index. Arrays in different objects
+// can't overlap, nor can arrays that start at the same address.
+//
+// The ends of the arrays are computed from the limit, which isn't bounded by
+// the array length. If computing them wraps around, which can happen for
+// large limits on 32-bit targets, the arrays are assumed to overlap.
+Node* LoopVectorizer::BuildOverlapCheck(const Candidate& c, Node* load) {
+  Node* store = c.store;
+  Node* limit = c.limit;
+  if (!c.is_word64() && machine()->Is64()) {
+    limit = graph()->NewNode(machine()->ChangeUint32ToUint64(), limit);
+  }
+  const int shift = ElementSizeLog2(c.array_type);
+  Node* size = graph()->NewNode(machine()->WordShl(), limit,
+                                jsgraph_->IntPtrConstant(shift));
+  Node* load_start = load->InputAt(2);
+  Node* store_start = store->InputAt(2);
+  Node* load_end = graph()->NewNode(machine()->IntAdd(), load_start, size);
+  Node* store_end = graph()->NewNode(machine()->IntAdd(), store_start, size);
+  Node* wraps = graph()->NewNode(
+      machine()->Word32Or(),
+      graph()->NewNode(
+          machine()->UintLessThan(),
+          jsgraph_->UintPtrConstant(std::numeric_limits<uintptr_t>::max() >>
+                                    shift),
+          limit),
+      graph()->NewNode(
+          machine()->Word32Or(),
+          graph()->NewNode(machine()->UintLessThan(), load_end, load_start),
+          graph()->NewNode(machine()->UintLessThan(), store_end,
+                           store_start)));
+  Node* overlap = graph()->NewNode(
+      machine()->Word32Or(), wraps,
+      graph()->NewNode(
+          machine()->Word32And(),
+          graph()->NewNode(machine()->UintLessThan(), load_start, store_end),
+          graph()->NewNode(machine()->UintLessThan(), store_start,
+                           load_end)));
+  Node* same_base = graph()->NewNode(COMPRESS_POINTERS_BOOL
+                                         ? machine()->Word32Equal()
+                                         : machine()->WordEqual(),
+                                     load->InputAt(1), store->InputAt(1));
+  Node* other_start = graph()->NewNode(
+      machine()->Word32Equal(),
+      graph()->NewNode(machine()->WordEqual(), load_start, store_start),
+      jsgraph_->Int32Constant(0));
+  return graph()->NewNode(
+      machine()->Word32And(), same_base,
+      graph()->NewNode(machine()->Word32And(), other_start, overlap));
+}
+
+Node* LoopVectorizer::BuildVectorValue(const Candidate& c, Node* value) {
+  auto it = vectors_.find(value);
+  if (it != vectors_.end()) return it->second;
+  Node* result;
+  if (c.array_type == kExternalFloat32Array) {
+    value = value->InputAt(0);
+    if (value->opcode() == IrOpcode::kChangeFloat32ToFloat64) {
+      return vectors_.at(value->InputAt(0));
+    }
+    result = graph()->NewNode(VectorOperatorFor(c, value->op()),
+                              BuildFloat32Operand(c, value->InputAt(0)),
+                              BuildFloat32Operand(c, value->InputAt(1)));
+  } else if (!loop_tree_->Contains(c.tree_loop, value)) {
+    result = graph()->NewNode(c.array_type == kExternalFloat64Array
+                                  ? machine()->F64x2Splat()
+                                  : machine()->I32x4Splat(),
+                              value);
+  } else {
+    result = graph()->NewNode(VectorOperatorFor(c, value->op()),
+                              BuildVectorValue(c, value->InputAt(0)),
+                              BuildVectorValue(c, value->InputAt(1)));
+  }
+  vectors_[value] = result;
+  return result;
+}
+
+Node* LoopVectorizer::BuildFloat32Operand(const Candidate& c, Node* node) {
+  if (node->opcode() == IrOpcode::kChangeFloat32ToFloat64) {
+    return vectors_.at(node->InputAt(0));
+  }
+  float value = DoubleToFloat32(Float64Matcher(node).ResolvedValue());
+  return graph()->NewNode(machine()->F32x4Splat(),
+                          jsgraph_->Float32Constant(value));
+}
+
+void LoopVectorizer::Vectorize(const Candidate& c) {
+  vectors_.clear();
+  const MachineRepresentation rep = PhiRepresentationOf(c.phi->op());
+  const Operator* const add =
+      c.is_word64() ? machine()->Int64Add() : machine()->Int32Add();
+  auto constant = [&](int value) {
+    return c.is_word64() ? jsgraph_->Int64Constant(value)
+                         : jsgraph_->Int32Constant(value);
+  };
+  const int lanes = LaneCount(c.array_type);
+  Node* const entry_control = c.loop->InputAt(0);
+  Node* const entry_effect = c.effect_phi->InputAt(0);
+  Node* const init = c.phi->InputAt(0);
+
+  // Skip the vector loop if the store may overwrite elements before they
+  // are loaded.
+  Node* overlap = nullptr;
+  for (Node* load : c.loads) {
+    if (load->InputAt(1) == c.store->InputAt(1) &&
+        load->InputAt(2) == c.store->InputAt(2)) {
+      continue;
+    }
+    Node* check = BuildOverlapCheck(c, load);
+    overlap = overlap == nullptr
+                  ? check
+                  : graph()->NewNode(machine()->Word32Or(), overlap, check);
+  }
+  Node* overlap_branch = nullptr;
+  Node* vector_entry = entry_control;
+  if (overlap != nullptr) {
+    overlap_branch = graph()->NewNode(common()->Branch(BranchHint::kFalse),
+                                      overlap, entry_control);
+    vector_entry = graph()->NewNode(common()->IfFalse(), overlap_branch);
+  }
+
+  // Build the header of the vector loop, which runs while all lanes of the
+  // next vector are below the limit.
+  Node* vector_loop =
+      graph()->NewNode(common()->Loop(2), vector_entry, vector_entry);
+  Node* vector_index =
+      graph()->NewNode(common()->Phi(rep, 2), init, init, vector_loop);
+  Node* vector_effect_phi = graph()->NewNode(
+      common()->EffectPhi(2), entry_effect, entry_effect, vector_loop);
+  Node* terminate =
+      graph()->NewNode(common()->Terminate(), vector_effect_phi, vector_loop);
+  NodeProperties::MergeControlToEnd(graph(), common(), terminate);
+  Node* last_index =
+      graph()->NewNode(add, vector_index, constant(lanes - 1));
+  Node* next_vector_index =
+      graph()->NewNode(add, vector_index, constant(lanes));
+  // The second comparison guards against {last_index} overflowing.
+  Node* condition = graph()->NewNode(
+      machine()->Word32And(),
+      graph()->NewNode(c.condition->op(), last_index, c.limit),
+      graph()->NewNode(c.condition->op(), vector_index, last_index));
+  Node* vector_branch = graph()->NewNode(common()->Branch(BranchHint::kTrue),
+                                         condition, vector_loop);
+  Node* control = graph()->NewNode(common()->IfTrue(), vector_branch);
+  Node* vector_exit = graph()->NewNode(common()->IfFalse(), vector_branch);
+  Node* effect = vector_effect_phi;
+
+  // Build the body of the vector loop along the effect chain of the scalar
+  // loop.
+  Node* const offset = BuildOffset(c, vector_index);
+  bool after_store = false;
+  for (Node* node : c.chain) {
+    switch (node->opcode()) {
+      case IrOpcode::kCheckpoint: {
+        if (after_store) break;
+        Node* frame_state =
+            BuildFrameState(c, NodeProperties::GetFrameStateInput(node),
+                            vector_index, next_vector_index);
+        effect = graph()->NewNode(common()->Checkpoint(), frame_state, effect,
+                                  control);
+        break;
+      }
+      case IrOpcode::kJSStackCheck: {
+        Node* stack_check = graph()->CloneNode(node);
+        NodeProperties::ReplaceFrameStateInput(
+            stack_check,
+            BuildFrameState(c, NodeProperties::GetFrameStateInput(node),
+                            vector_index, next_vector_index));
+        NodeProperties::ReplaceEffectInput(stack_check, effect);
+        NodeProperties::ReplaceControlInput(stack_check, control);
+        effect = control = stack_check;
+        break;
+      }
+      case IrOpcode::kTypeGuard:
+        break;
+      case IrOpcode::kCheckedUint32Bounds:
+      case IrOpcode::kCheckedUint64Bounds:
+        // The lanes are in bounds if the first and the last lane are.
+        for (Node* index : {vector_index, last_index}) {
+          effect = graph()->NewNode(node->op(),
+                                    BuildIndex(c, node->InputAt(0), index),
+                                    node->InputAt(1), effect, control);
+        }
+        break;
+      case IrOpcode::kLoadTypedElement: {
+        // Keep the buffer alive like EffectControlLinearizer does.
+        effect = graph()->NewNode(common()->Retain(), node->InputAt(0), effect);
+        Node* data_pointer = BuildDataPointer(node->InputAt(1),
+                                              node->InputAt(2), &effect,
+                                              control);
+        effect = graph()->NewNode(machine()->Load(MachineType::Simd128()),
+                                  data_pointer, offset, effect, control);
+        vectors_[node] = effect;
+        break;
+      }
+      case IrOpcode::kStoreTypedElement: {
+        Node* value = BuildVectorValue(c, node->InputAt(4));
+        effect = graph()->NewNode(common()->Retain(), node->InputAt(0), effect);
+        Node* data_pointer = BuildDataPointer(node->InputAt(1),
+                                              node->InputAt(2), &effect,
+                                              control);
+        effect = graph()->NewNode(
+            machine()->Store(StoreRepresentation(
+                MachineRepresentation::kSimd128, kNoWriteBarrier)),
+            data_pointer, offset, value, effect, control);
+        after_store = true;
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+  }
+  vector_loop->ReplaceInput(1, control);
+  vector_index->ReplaceInput(1, next_vector_index);
+  vector_effect_phi->ReplaceInput(1, effect);
+
+  // The scalar loop runs the remaining iterations, or all of them if the
+  // vector loop was skipped.
+  Node* scalar_entry = vector_exit;
+  Node* scalar_init = vector_index;
+  Node* scalar_effect = vector_effect_phi;
+  if (overlap_branch != nullptr) {
+    Node* skip = graph()->NewNode(common()->IfTrue(), overlap_branch);
+    scalar_entry = graph()->NewNode(common()->Merge(2), vector_exit, skip);
+    scalar_init = graph()->NewNode(common()->Phi(rep, 2), vector_index, init,
+                                   scalar_entry);
+    scalar_effect = graph()->NewNode(common()->EffectPhi(2), vector_effect_phi,
+                                     entry_effect, scalar_entry);
+  }
+  c.loop->ReplaceInput(0, scalar_entry);
+  c.phi->ReplaceInput(0, scalar_init);
+  c.effect_phi->ReplaceInput(0, scalar_effect);
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,90 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_VECTORIZER_H_
+#define V8_COMPILER_LOOP_VECTORIZER_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/common/globals.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class JSGraph;
+class MachineOperatorBuilder;
+
+// Vectorizes simple counted loops over typed arrays, e.g.
+//
+//   for (let i = 0; i < n; i++) c[i] = a[i] + b[i];
+//
+// using the Simd128 machine operators. This runs after representation
+// selection, so that the element values and the induction variable already
+// have machine representations, but before the typed array accesses are
+// lowered to machine loads and stores.
+//
+// A vector loop is inserted in front of the original loop, which processes
+// as many full vectors as possible and then leaves the remaining iterations
+// to the original loop. Only innermost loops whose body is straight-line
+// code consisting of typed array loads and a single typed array store of
+// the same element type are vectorized. Bounds checks are performed on the
+// first and last lane of each vector, and deoptimizations in the vector loop
+// resume the interpreter at the start of the vector's first iteration. If
+// the stored array may overlap with a loaded array at a different offset,
+// the vector loop is skipped at runtime.
+class V8_EXPORT_PRIVATE LoopVectorizer final {
+ public:
+  LoopVectorizer(JSGraph* jsgraph, LoopTree* loop_tree, Zone* temp_zone);
+
+  void Run();
+
+ private:
+  struct Candidate;
+
+  bool Analyze(const LoopTree::Loop* loop, Candidate* candidate);
+  void Vectorize(const Candidate& candidate);
+
+  // Whether {node} is the induction variable, possibly converted or passed
+  // through a bounds check.
+  bool IsIndex(const Candidate& candidate, Node* node);
+  // Whether the frame {state} only depends on values computed outside of
+  // the loop and on the induction variable, or its incremented value if
+  // {after_store} is true.
+  bool IsSubstitutable(const Candidate& candidate, Node* state,
+                       bool after_store);
+  bool IsVectorizable(const Candidate& candidate, Node* value);
+  bool IsFloat32Operand(const Candidate& candidate, Node* node);
+
+  Node* BuildIndex(const Candidate& candidate, Node* node, Node* index);
+  Node* BuildFrameState(const Candidate& candidate, Node* state,
+                        Node* vector_index, Node* next_vector_index);
+  Node* BuildOffset(const Candidate& candidate, Node* vector_index);
+  Node* BuildDataPointer(Node* base, Node* external, Node** effect,
+                         Node* control);
+  Node* BuildOverlapCheck(const Candidate& candidate, Node* load);
+  Node* BuildVectorValue(const Candidate& candidate, Node* value);
+  Node* BuildFloat32Operand(const Candidate& candidate, Node* node);
+
+  const Operator* VectorOperatorFor(const Candidate& candidate,
+                                    const Operator* op);
+
+  Graph* graph() const;
+  CommonOperatorBuilder* common() const;
+  MachineOperatorBuilder* machine() const;
+
+  JSGraph* const jsgraph_;
+  LoopTree* const loop_tree_;
+  Zone* const temp_zone_;
+  // Maps the scalar loads and values of the loop being vectorized to their
+  // vector counterparts.
+  ZoneUnorderedMap<Node*, Node*> vectors_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_VECTORIZER_H_
@@ -43,6 +43,8 @@ void PipelineStatistics::CommonStats::End(
       diff->max_allocated_bytes_ + allocated_bytes_at_start_;
   diff->total_allocated_bytes_ =
       outer_zone_diff + scope_->GetTotalAllocatedBytes();
+  diff->segment_pool_hits_ = scope_->GetSegmentPoolHits();
+  diff->segment_pool_misses_ = scope_->GetSegmentPoolMisses();
   scope_.reset();
   timer_.Stop();
 }
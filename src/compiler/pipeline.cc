@@ -28,6 +28,7 @@
 #include "src/compiler/backend/register-allocator-verifier.h"
 #include "src/compiler/backend/register-allocator.h"
 #include "src/compiler/basic-block-instrumentor.h"
+#include "src/compiler/bounds-check-elimination.h"
 #include "src/compiler/branch-elimination.h"
 #include "src/compiler/bytecode-graph-builder.h"
 #include "src/compiler/checkpoint-elimination.h"
@@ -55,9 +56,11 @@
 #include "src/compiler/js-typed-lowering.h"
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-invariant-code-motion.h"
 #include "src/compiler/loop-peeling.h"
 #include "src/compiler/loop-unrolling.h"
 #include "src/compiler/loop-variable-optimizer.h"
+#include "src/compiler/loop-vectorizer.h"
 #include "src/compiler/machine-graph-verifier.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/memory-optimizer.h"
@@ -1701,6 +1704,28 @@ struct WasmLoopPeelingPhase {
 };
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+struct LoopInvariantCodeMotionPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopInvariantCodeMotion)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
+        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    // The typer is still running and types the nodes we create.
+    UnparkedScopeIfNeeded scope(data->broker());
+    LoopInvariantCodeMotion(data->jsgraph(), loop_tree, temp_zone).Run();
+  }
+};
+
+struct LoopVectorizationPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopVectorization)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
+        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    LoopVectorizer(data->jsgraph(), loop_tree, temp_zone).Run();
+  }
+};
+
 struct LoopExitEliminationPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(LoopExitElimination)
 
@@ -1838,6 +1863,16 @@ struct StoreStoreEliminationPhase {
   }
 };
 
+struct BoundsCheckEliminationPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(BoundsCheckElimination)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    BoundsCheckElimination bounds_check_elimination(data->graph(),
+                                                    data->common(), temp_zone);
+    bounds_check_elimination.Run();
+  }
+};
+
 struct LoadEliminationPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(LoadElimination)
 
@@ -2179,7 +2214,8 @@ struct InstructionSelectionPhase {
             ? InstructionSelector::kAllSourcePositions
             : InstructionSelector::kCallSourcePositions,
         InstructionSelector::SupportedFeatures(),
-        FLAG_turbo_instruction_scheduling
+        FLAG_turbo_instruction_scheduling ||
+                FLAG_turbo_loop_instruction_scheduling
             ? InstructionSelector::kEnableScheduling
             : InstructionSelector::kDisableScheduling,
         data->assembler_options().enable_root_relative_access
@@ -2682,6 +2718,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<TypedLoweringPhase>();
   RunPrintAndVerify(TypedLoweringPhase::phase_name());
 
+  if (FLAG_turbo_loop_invariant_code_motion) {
+    Run<LoopInvariantCodeMotionPhase>();
+    RunPrintAndVerify(LoopInvariantCodeMotionPhase::phase_name(), true);
+  }
+
   if (data->info()->loop_peeling()) {
     Run<LoopPeelingPhase>();
     RunPrintAndVerify(LoopPeelingPhase::phase_name(), true);
@@ -2694,6 +2735,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
+
+  if (FLAG_turbo_bounds_check_elimination) {
+    Run<BoundsCheckEliminationPhase>();
+    RunPrintAndVerify(BoundsCheckEliminationPhase::phase_name());
+  }
   data->DeleteTyper();
 
   if (FLAG_turbo_escape) {
@@ -2726,6 +2772,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+  if (FLAG_turbo_loop_vectorization) {
+    Run<LoopVectorizationPhase>();
+    RunPrintAndVerify(LoopVectorizationPhase::phase_name(), true);
+  }
+
   // From now on it is invalid to look at types on the nodes, because the types
   // on the nodes might not make sense after representation selection due to the
   // way we handle truncations; if we'd want to look at types afterwards we'd
@@ -3449,18 +3500,19 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
 
   // Allocate registers.
 
-  // This limit is chosen somewhat arbitrarily, by looking at a few bigger
-  // WebAssembly programs, and chosing the limit such that functions that take
-  // >100ms in register allocation are switched to mid-tier.
-  static int kTopTierVirtualRegistersLimit = 8192;
-
+  // The default of --turbo-mid-tier-regalloc-threshold is chosen somewhat
+  // arbitrarily, by looking at a few bigger WebAssembly programs, and chosing
+  // the limit such that functions that take >100ms in register allocation are
+  // switched to mid-tier. It applies to JavaScript as well, but hasn't been
+  // tuned for it; the RegisterAllocation js-perf-test suite compares both
+  // allocators on JavaScript code.
   const RegisterConfiguration* config = RegisterConfiguration::Default();
   std::unique_ptr<const RegisterConfiguration> restricted_config;
   bool use_mid_tier_register_allocator =
       FLAG_turbo_force_mid_tier_regalloc ||
       (FLAG_turbo_use_mid_tier_regalloc_for_huge_functions &&
        data->sequence()->VirtualRegisterCount() >
-           kTopTierVirtualRegistersLimit);
+           FLAG_turbo_mid_tier_regalloc_threshold);
 
   if (call_descriptor->HasRestrictedAllocatableRegisters()) {
     RegList registers = call_descriptor->AllocatableRegisters();
@@ -3470,6 +3522,16 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
     config = restricted_config.get();
     use_mid_tier_register_allocator = false;
   }
+  if (info()->trace_turbo_allocation()) {
+    CodeTracer::StreamScope tracing_scope(data->GetCodeTracer());
+    tracing_scope.stream()
+        << "Allocating registers for " << info()->GetDebugName().get()
+        << " (" << data->sequence()->VirtualRegisterCount()
+        << " virtual registers, " << data->sequence()->instructions().size()
+        << " instructions) using the "
+        << (use_mid_tier_register_allocator ? "mid-tier" : "top-tier")
+        << " register allocator" << std::endl;
+  }
   if (use_mid_tier_register_allocator) {
     AllocateRegistersForMidTier(config, call_descriptor, run_verifier);
   } else {
@@ -6,6 +6,8 @@
 
 #include "src/compiler/zone-stats.h"
 
+#include "src/zone/accounting-allocator.h"
+
 namespace v8 {
 namespace internal {
 namespace compiler {
@@ -13,7 +15,11 @@ namespace compiler {
 ZoneStats::StatsScope::StatsScope(ZoneStats* zone_stats)
     : zone_stats_(zone_stats),
       total_allocated_bytes_at_start_(zone_stats->GetTotalAllocatedBytes()),
-      max_allocated_bytes_(0) {
+      max_allocated_bytes_(0),
+      segment_pool_hits_at_start_(
+          zone_stats->allocator_->GetSegmentPoolHits()),
+      segment_pool_misses_at_start_(
+          zone_stats->allocator_->GetSegmentPoolMisses()) {
   zone_stats_->stats_.push_back(this);
   for (Zone* zone : zone_stats_->zones_) {
     size_t size = static_cast<size_t>(zone->allocation_size());
@@ -51,6 +57,16 @@ size_t ZoneStats::StatsScope::GetTotalAllocatedBytes() {
          total_allocated_bytes_at_start_;
 }
 
+size_t ZoneStats::StatsScope::GetSegmentPoolHits() {
+  return zone_stats_->allocator_->GetSegmentPoolHits() -
+         segment_pool_hits_at_start_;
+}
+
+size_t ZoneStats::StatsScope::GetSegmentPoolMisses() {
+  return zone_stats_->allocator_->GetSegmentPoolMisses() -
+         segment_pool_misses_at_start_;
+}
+
 void ZoneStats::StatsScope::ZoneReturned(Zone* zone) {
   size_t current_total = GetCurrentAllocatedBytes();
   // Update max.
@@ -61,6 +61,12 @@ class V8_EXPORT_PRIVATE ZoneStats final {
     size_t GetCurrentAllocatedBytes();
     size_t GetTotalAllocatedBytes();
 
+    // Segment allocations during this scope that were served from the
+    // allocator's segment pool, or missed it. The pool is shared with
+    // concurrent compilations, whose allocations are included.
+    size_t GetSegmentPoolHits();
+    size_t GetSegmentPoolMisses();
+
    private:
     friend class ZoneStats;
     void ZoneReturned(Zone* zone);
@@ -71,6 +77,8 @@ class V8_EXPORT_PRIVATE ZoneStats final {
     InitialValues initial_values_;
     size_t total_allocated_bytes_at_start_;
     size_t max_allocated_bytes_;
+    size_t segment_pool_hits_at_start_;
+    size_t segment_pool_misses_at_start_;
   };
 
   explicit ZoneStats(AccountingAllocator* allocator);
@@ -49,6 +49,8 @@ void CompilationStatistics::RecordTotalStats(const BasicStats& stats) {
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
+  segment_pool_hits_ += stats.segment_pool_hits_;
+  segment_pool_misses_ += stats.segment_pool_misses_;
   if (stats.absolute_max_allocated_bytes_ > absolute_max_allocated_bytes_) {
     absolute_max_allocated_bytes_ = stats.absolute_max_allocated_bytes_;
     max_allocated_bytes_ = stats.max_allocated_bytes_;
@@ -171,6 +173,15 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
 
+  size_t segment_allocations =
+      s.total_stats_.segment_pool_hits_ + s.total_stats_.segment_pool_misses_;
+  if (!ps.machine_output && segment_allocations > 0) {
+    os << "Zone segment pool hit rate: "
+       << (s.total_stats_.segment_pool_hits_ * 100 / segment_allocations)
+       << "% of " << segment_allocations << " segment allocations"
+       << std::endl;
+  }
+
   return os;
 }
 
@@ -101,6 +101,7 @@ class Counters;
 class Debug;
 class Deoptimizer;
 class DescriptorLookupCache;
+class DictionaryLookupCache;
 class EmbeddedFileWriterInterface;
 class EternalHandles;
 class HandleScopeImplementer;
@@ -150,6 +151,10 @@ class NodeObserver;
 class PerIsolateCompilerCache;
 }  // namespace compiler
 
+namespace maglev {
+class MaglevConcurrentDispatcher;
+}  // namespace maglev
+
 namespace win64_unwindinfo {
 class BuiltinUnwindInfo;
 }  // namespace win64_unwindinfo
@@ -1238,6 +1243,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return descriptor_lookup_cache_;
   }
 
+  DictionaryLookupCache* dictionary_lookup_cache() const {
+    return dictionary_lookup_cache_;
+  }
+
   V8_INLINE HandleScopeData* handle_scope_data() { return &handle_scope_data_; }
 
   HandleScopeImplementer* handle_scope_implementer() const {
@@ -1479,6 +1488,13 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     DCHECK_NOT_NULL(optimizing_compile_dispatcher_);
     return optimizing_compile_dispatcher_;
   }
+
+#ifdef V8_ENABLE_MAGLEV
+  maglev::MaglevConcurrentDispatcher* maglev_concurrent_dispatcher() {
+    DCHECK_NOT_NULL(maglev_concurrent_dispatcher_);
+    return maglev_concurrent_dispatcher_;
+  }
+#endif  // V8_ENABLE_MAGLEV
   // Flushes all pending concurrent optimzation jobs from the optimizing
   // compile dispatcher's queue.
   void AbortConcurrentOptimization(BlockingBehavior blocking_behavior);
@@ -2093,6 +2109,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
       StackTrace::kOverview;
   DescriptorLookupCache* descriptor_lookup_cache_ = nullptr;
+  DictionaryLookupCache* dictionary_lookup_cache_ = nullptr;
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_ = nullptr;
   UnicodeCache* unicode_cache_ = nullptr;
@@ -2244,6 +2261,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   bool detailed_source_positions_for_profiling_;
 
   OptimizingCompileDispatcher* optimizing_compile_dispatcher_ = nullptr;
+#ifdef V8_ENABLE_MAGLEV
+  maglev::MaglevConcurrentDispatcher* maglev_concurrent_dispatcher_ = nullptr;
+#endif  // V8_ENABLE_MAGLEV
 
   std::unique_ptr<PersistentHandlesList> persistent_handles_list_;
 
@@ -14,6 +14,7 @@
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
+#include "src/execution/tiering-profile.h"
 #include "src/handles/global-handles.h"
 #include "src/init/bootstrapper.h"
 #include "src/interpreter/interpreter.h"
@@ -178,6 +179,11 @@ bool ShouldOptimizeAsSmallFunction(int bytecode_size, bool any_ic_changed) {
          bytecode_size < FLAG_max_bytecode_size_for_early_opt;
 }
 
+int TicksForOptimization(BytecodeArray bytecode) {
+  return FLAG_ticks_before_optimization +
+         (bytecode.length() / FLAG_bytecode_size_allowance_per_tick);
+}
+
 }  // namespace
 
 OptimizationReason TieringManager::ShouldOptimize(JSFunction function,
@@ -212,9 +218,7 @@ OptimizationReason TieringManager::ShouldOptimize(JSFunction function,
     }
   }
   const int ticks = function.feedback_vector().profiler_ticks();
-  const int ticks_for_optimization =
-      FLAG_ticks_before_optimization +
-      (bytecode.length() / FLAG_bytecode_size_allowance_per_tick);
+  const int ticks_for_optimization = TicksForOptimization(bytecode);
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
   } else if (ShouldOptimizeAsSmallFunction(bytecode.length(),
@@ -236,6 +240,29 @@ OptimizationReason TieringManager::ShouldOptimize(JSFunction function,
   return OptimizationReason::kDoNotOptimize;
 }
 
+void TieringManager::ApplyTieringProfile(
+    JSFunction function, const TieringProfileFromFile& profile) {
+  // Optimizing right away would miss the feedback of this run. Instead, give
+  // the function a head start so that it needs fewer ticks to get hot again,
+  // or a single one if it was optimized with stable feedback before.
+  const int max_ticks =
+      TicksForOptimization(function.shared().GetBytecodeArray(isolate_)) - 1;
+  int ticks = profile.profiler_ticks();
+  if (profile.tier() == CodeKind::TURBOFAN && profile.has_stable_feedback()) {
+    ticks = max_ticks;
+  }
+  ticks = std::min(ticks, max_ticks);
+  if (ticks <= 0) return;
+
+  if (FLAG_trace_opt_verbose) {
+    PrintF("[function ");
+    function.PrintName();
+    PrintF(" starts with %d/%d ticks from the tiering profile]\n", ticks,
+           max_ticks + 1);
+  }
+  function.feedback_vector().set_profiler_ticks(ticks);
+}
+
 TieringManager::OnInterruptTickScope::OnInterruptTickScope(
     TieringManager* profiler)
     : profiler_(profiler) {
@@ -257,6 +284,15 @@ void TieringManager::OnInterruptTick(Handle<JSFunction> function) {
   // Sparkplug only when reaching this point *with* a feedback vector.
   const bool had_feedback_vector = function->has_feedback_vector();
 
+  // Functions that tiered up in an earlier run are looked up when they get
+  // their feedback vector, i.e. on their first tick.
+  const TieringProfileFromFile* profile = nullptr;
+  if (V8_UNLIKELY(FLAG_tiering_profile_input != nullptr) &&
+      !had_feedback_vector) {
+    profile = TieringProfileFromFile::TryRead(
+        isolate_, handle(function->shared(), isolate_));
+  }
+
   // Ensure that the feedback vector has been allocated, and reset the
   // interrupt budget in preparation for the next tick.
   if (had_feedback_vector) {
@@ -284,7 +320,10 @@ void TieringManager::OnInterruptTick(Handle<JSFunction> function) {
   // tiering.
   if (CanCompileWithBaseline(isolate_, function->shared()) &&
       !function->ActiveTierIsBaseline()) {
-    if (FLAG_baseline_batch_compilation) {
+    // Functions that reached Sparkplug before skip the batching delay.
+    const bool compile_now =
+        profile != nullptr && profile->tier() >= CodeKind::BASELINE;
+    if (FLAG_baseline_batch_compilation && !compile_now) {
       isolate_->baseline_batch_compiler()->EnqueueFunction(function);
     } else {
       IsCompiledScope is_compiled_scope(
@@ -295,7 +334,10 @@ void TieringManager::OnInterruptTick(Handle<JSFunction> function) {
   }
 
   // We only tier up beyond sparkplug if we already had a feedback vector.
-  if (!had_feedback_vector) return;
+  if (!had_feedback_vector) {
+    if (profile != nullptr) ApplyTieringProfile(*function, *profile);
+    return;
+  }
 
   // Don't tier up if Turbofan is disabled.
   // TODO(jgruber): Update this for a multi-tier world.
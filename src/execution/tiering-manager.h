@@ -17,6 +17,7 @@ class Isolate;
 class UnoptimizedFrame;
 class JavaScriptFrame;
 class JSFunction;
+class TieringProfileFromFile;
 enum class CodeKind;
 enum class OptimizationReason : uint8_t;
 
@@ -46,6 +47,9 @@ class TieringManager {
   void Optimize(JSFunction function, OptimizationReason reason,
                 CodeKind code_kind);
   void Baseline(JSFunction function, OptimizationReason reason);
+  // Gives a function that tiered up in an earlier run a head start.
+  void ApplyTieringProfile(JSFunction function,
+                           const TieringProfileFromFile& profile);
 
   class V8_NODISCARD OnInterruptTickScope final {
    public:
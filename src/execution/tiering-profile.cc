@@ -0,0 +1,329 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/strings/string-hasher-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Any line in a tiering profile beginning with this string is the profile of
+// a function. The format is:
+//   literal kFunctionMarker , start_position , end_position , source_hash ,
+//   tier , profiler_ticks , has_stable_feedback , quoted_script_name
+// The script name comes last and is quoted, with backslashes, quotes and line
+// breaks escaped, since it may contain any character.
+constexpr char kFunctionMarker[] = "function";
+
+// Functions are keyed by their script name and start position.
+using FunctionKey = std::pair<std::string, int>;
+
+class TieringProfileFromFileInternal : public TieringProfileFromFile {
+ public:
+  bool has_source_hash() const { return has_source_hash_; }
+  int end_position() const { return end_position_; }
+  uint32_t source_hash() const { return source_hash_; }
+
+  void set_source_range_and_hash(int end_position, uint32_t source_hash) {
+    end_position_ = end_position;
+    source_hash_ = source_hash;
+    has_source_hash_ = true;
+  }
+
+  // Several closures, or several runs that were concatenated, may record the
+  // same function. Keep the most optimistic tier and hotness, but only keep
+  // the feedback stable if it was stable everywhere.
+  void Merge(CodeKind tier, int profiler_ticks, bool has_stable_feedback) {
+    tier_ = std::max(tier_, tier);
+    profiler_ticks_ = std::max(profiler_ticks_, profiler_ticks);
+    has_stable_feedback_ &= has_stable_feedback;
+  }
+
+ private:
+  bool has_source_hash_ = false;
+  int end_position_ = 0;
+  uint32_t source_hash_ = 0;
+};
+
+using TieringProfileMap = std::map<FunctionKey, TieringProfileFromFileInternal>;
+
+// Computes the key and source hash of the given function. Returns false for
+// functions that can't be identified across processes, e.g. because their
+// script has no name.
+bool GetFunctionKey(Isolate* isolate, Handle<SharedFunctionInfo> shared,
+                    FunctionKey* key, int* end_position,
+                    uint32_t* source_hash) {
+  if (!shared->script().IsScript()) return false;
+  Handle<Script> script(Script::cast(shared->script()), isolate);
+  if (!script->name().IsString() || !script->source().IsString()) return false;
+
+  const int start = shared->StartPosition();
+  const int end = shared->EndPosition();
+  // Sources are flattened when they are parsed. Profiles are written during
+  // isolate teardown, where we can't allocate to flatten them.
+  String source = String::cast(script->source());
+  if (!source.IsFlat()) return false;
+  if (start < 0 || end < start || end > source.length()) return false;
+
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source.GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    *source_hash = StringHasher::HashSequentialString(
+        content.ToOneByteVector().begin() + start, end - start, kZeroHashSeed);
+  } else {
+    *source_hash = StringHasher::HashSequentialString(
+        content.ToUC16Vector().begin() + start, end - start, kZeroHashSeed);
+  }
+  *key = {String::cast(script->name()).ToCString().get(), start};
+  *end_position = end;
+  return true;
+}
+
+bool ParseTier(const std::string& token, CodeKind* tier) {
+  for (CodeKind kind : {CodeKind::INTERPRETED_FUNCTION, CodeKind::BASELINE,
+                        CodeKind::MAGLEV, CodeKind::TURBOFAN}) {
+    if (token == CodeKindToString(kind)) {
+      *tier = kind;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Reads the next comma separated field of the line as an integer.
+bool ParseNextInteger(std::istringstream& line_stream, int64_t* value) {
+  std::string token;
+  if (!std::getline(line_stream, token, ',')) return false;
+  char* end = nullptr;
+  errno = 0;
+  *value = strtoll(token.c_str(), &end, 0);
+  return errno == 0 && end != token.c_str() && *end == '\0';
+}
+
+void WriteQuoted(std::ostream& out, const std::string& value) {
+  out << '"';
+  for (char c : value) {
+    switch (c) {
+      case '"':
+      case '\\':
+        out << '\\' << c;
+        break;
+      case '\n':
+        out << "\\n";
+        break;
+      case '\r':
+        out << "\\r";
+        break;
+      default:
+        out << c;
+    }
+  }
+  out << '"';
+}
+
+// Reads the rest of the line as a string written by WriteQuoted.
+bool ParseQuoted(std::istringstream& line_stream, std::string* value) {
+  std::string token;
+  std::getline(line_stream, token);
+  if (token.size() < 2 || token.front() != '"' || token.back() != '"') {
+    return false;
+  }
+  value->clear();
+  for (size_t i = 1; i < token.size() - 1; ++i) {
+    char c = token[i];
+    if (c == '"') return false;
+    if (c != '\\') {
+      value->push_back(c);
+      continue;
+    }
+    if (++i == token.size() - 1) return false;
+    switch (token[i]) {
+      case '"':
+      case '\\':
+        value->push_back(token[i]);
+        break;
+      case 'n':
+        value->push_back('\n');
+        break;
+      case 'r':
+        value->push_back('\r');
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+void TraceSkippedLine(int line_number, const char* reason) {
+  if (!FLAG_trace_opt_verbose) return;
+  PrintF("[skipping line %d of tiering profile %s: %s]\n", line_number,
+         FLAG_tiering_profile_input, reason);
+}
+
+// Profiles may be stale or truncated, so lines that can't be parsed or that
+// contradict earlier lines are skipped rather than treated as fatal.
+void ReadTieringProfile(const char* filename, TieringProfileMap* data) {
+  std::ifstream file(filename);
+  CHECK_WITH_MSG(file.good(), "Can't read tiering profile");
+  int line_number = 0;
+  for (std::string line; std::getline(file, line);) {
+    line_number++;
+    std::string token;
+    std::istringstream line_stream(line);
+    if (!std::getline(line_stream, token, ',')) continue;
+    if (token != kFunctionMarker) continue;
+
+    int64_t start_position, end_position, source_hash, profiler_ticks,
+        has_stable_feedback;
+    CodeKind tier;
+    std::string script_name;
+    if (!ParseNextInteger(line_stream, &start_position) ||
+        !ParseNextInteger(line_stream, &end_position) ||
+        !ParseNextInteger(line_stream, &source_hash) ||
+        !std::getline(line_stream, token, ',') || !ParseTier(token, &tier) ||
+        !ParseNextInteger(line_stream, &profiler_ticks) ||
+        !ParseNextInteger(line_stream, &has_stable_feedback) ||
+        !ParseQuoted(line_stream, &script_name)) {
+      TraceSkippedLine(line_number, "malformed");
+      continue;
+    }
+
+    TieringProfileFromFileInternal& profile =
+        (*data)[{script_name, static_cast<int>(start_position)}];
+    // We allow concatenating profiles of several runs, but expect them all to
+    // run the same sources. Lines for a changed function don't describe the
+    // function we know about.
+    if (profile.has_source_hash() &&
+        (profile.end_position() != end_position ||
+         profile.source_hash() != static_cast<uint32_t>(source_hash))) {
+      TraceSkippedLine(line_number, "source hash mismatch");
+      continue;
+    }
+    profile.set_source_range_and_hash(static_cast<int>(end_position),
+                                      static_cast<uint32_t>(source_hash));
+    profile.Merge(tier, static_cast<int>(profiler_ticks),
+                  has_stable_feedback != 0);
+  }
+}
+
+struct ReadTieringProfileTrait {
+  static void Construct(void* allocated_ptr) {
+    TieringProfileMap* data = new (allocated_ptr) TieringProfileMap();
+    if (FLAG_tiering_profile_input != nullptr) {
+      ReadTieringProfile(FLAG_tiering_profile_input, data);
+    }
+  }
+};
+
+// Read on first use, which may happen concurrently in several isolates.
+base::LazyInstance<TieringProfileMap, ReadTieringProfileTrait>::type
+    tiering_profile_data = LAZY_INSTANCE_INITIALIZER;
+
+CodeKind HighestAvailableTier(JSFunction function) {
+  for (CodeKind kind : {CodeKind::TURBOFAN, CodeKind::MAGLEV}) {
+    if (function.HasAvailableCodeKind(kind)) return kind;
+  }
+  if (function.shared().HasBaselineCode()) return CodeKind::BASELINE;
+  return CodeKind::INTERPRETED_FUNCTION;
+}
+
+bool HasStableFeedback(FeedbackVector vector) {
+  FeedbackMetadataIterator iter(vector.metadata());
+  while (iter.HasNext()) {
+    FeedbackNexus nexus(vector, iter.Next());
+    if (nexus.IsMegamorphic()) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+// static
+const TieringProfileFromFile* TieringProfileFromFile::TryRead(
+    Isolate* isolate, Handle<SharedFunctionInfo> shared) {
+  const TieringProfileMap& data = tiering_profile_data.Get();
+  if (data.empty()) return nullptr;
+
+  FunctionKey key;
+  int end_position;
+  uint32_t source_hash;
+  if (!GetFunctionKey(isolate, shared, &key, &end_position, &source_hash)) {
+    return nullptr;
+  }
+  auto it = data.find(key);
+  if (it == data.end() || it->second.end_position() != end_position ||
+      it->second.source_hash() != source_hash) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+// static
+void TieringProfileFromFile::Write(Isolate* isolate, const char* filename) {
+  HandleScope scope(isolate);
+  std::vector<Handle<JSFunction>> functions;
+  {
+    HeapObjectIterator iterator(isolate->heap());
+    for (HeapObject obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!obj.IsJSFunction()) continue;
+      JSFunction function = JSFunction::cast(obj);
+      if (!function.has_feedback_vector()) continue;
+      if (!function.shared().IsUserJavaScript()) continue;
+      functions.push_back(handle(function, isolate));
+    }
+  }
+
+  TieringProfileMap data;
+  for (Handle<JSFunction> function : functions) {
+    FunctionKey key;
+    int end_position;
+    uint32_t source_hash;
+    if (!GetFunctionKey(isolate, handle(function->shared(), isolate), &key,
+                        &end_position, &source_hash)) {
+      continue;
+    }
+    FeedbackVector vector = function->feedback_vector();
+    TieringProfileFromFileInternal& profile = data[key];
+    profile.set_source_range_and_hash(end_position, source_hash);
+    profile.Merge(HighestAvailableTier(*function), vector.profiler_ticks(),
+                  HasStableFeedback(vector));
+  }
+
+  std::ofstream file(filename);
+  CHECK_WITH_MSG(file.good(), "Can't write tiering profile");
+  for (const auto& pair : data) {
+    const TieringProfileFromFileInternal& profile = pair.second;
+    file << kFunctionMarker << "," << pair.first.second << ","
+         << profile.end_position() << "," << profile.source_hash() << ","
+         << CodeKindToString(profile.tier()) << "," << profile.profiler_ticks()
+         << "," << profile.has_stable_feedback() << ",";
+    WriteQuoted(file, pair.first.first);
+    file << "\n";
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,56 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_TIERING_PROFILE_H_
+#define V8_EXECUTION_TIERING_PROFILE_H_
+
+#include "src/handles/handles.h"
+#include "src/objects/code-kind.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class SharedFunctionInfo;
+
+// A summary of how far a function tiered up in an earlier run of the
+// process. Profiles are written with --tiering-profile-output and read back
+// with --tiering-profile-input, so that functions that were hot before tier up
+// early instead of re-warming from scratch.
+//
+// Functions are identified by the name of their script and their source
+// range, and a hash of their source guards against using the profile of a
+// function that has been changed since.
+class TieringProfileFromFile {
+ public:
+  // The highest tier any closure of the function reached.
+  CodeKind tier() const { return tier_; }
+
+  // The highest number of profiler ticks any closure of the function had
+  // collected towards its next tier up.
+  int profiler_ticks() const { return profiler_ticks_; }
+
+  // Whether none of the function's ICs went megamorphic, which makes the
+  // early optimization unlikely to deopt.
+  bool has_stable_feedback() const { return has_stable_feedback_; }
+
+  // Returns the profile of the given function from the file given by
+  // --tiering-profile-input, if it contains one.
+  static const TieringProfileFromFile* TryRead(
+      Isolate* isolate, Handle<SharedFunctionInfo> shared);
+
+  // Writes the profiles of all functions with a feedback vector in the
+  // isolate's heap to the given file.
+  static void Write(Isolate* isolate, const char* filename);
+
+ protected:
+  CodeKind tier_ = CodeKind::INTERPRETED_FUNCTION;
+  int profiler_ticks_ = 0;
+  bool has_stable_feedback_ = true;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_TIERING_PROFILE_H_
@@ -526,6 +526,8 @@ DEFINE_BOOL(maglev_break_on_entry, false, "insert an int3 on maglev entries")
 DEFINE_BOOL(print_maglev_graph, false, "print maglev graph")
 DEFINE_BOOL(print_maglev_code, false, "print maglev code")
 DEFINE_BOOL(trace_maglev_regalloc, false, "trace maglev register allocation")
+DEFINE_BOOL(trace_maglev_bailouts, false,
+            "trace functions maglev bails out on, and why")
 
 #if ENABLE_SPARKPLUG
 DEFINE_WEAK_IMPLICATION(future, sparkplug)
@@ -596,6 +598,12 @@ DEFINE_BOOL(trace_pretenuring, false,
             "trace pretenuring decisions of HAllocate instructions")
 DEFINE_BOOL(trace_pretenuring_statistics, false,
             "trace allocation site pretenuring statistics")
+DEFINE_BOOL(lifetime_sampling_pretenuring, false,
+            "pretenure runtime allocation sites without allocation mementos "
+            "based on the sampled lifetime of their objects")
+DEFINE_INT(lifetime_sampling_pretenuring_rate, 16 * KB,
+           "number of young generation bytes allocated between lifetime "
+           "samples")
 DEFINE_BOOL(track_field_types, true, "track field types")
 DEFINE_BOOL(trace_block_coverage, false,
             "trace collected block coverage information")
@@ -638,9 +646,29 @@ DEFINE_INT(
     max_bytecode_size_for_early_opt, 81,
     "Maximum bytecode length for a function to be optimized on the first tick")
 
+// Tiering: profiles persisted across runs.
+DEFINE_STRING(tiering_profile_output, nullptr,
+              "write how far functions tiered up to the given file when the "
+              "isolate is disposed")
+DEFINE_STRING(tiering_profile_input, nullptr,
+              "tier up functions early that reached Sparkplug or Turbofan in "
+              "the profile written by --tiering-profile-output")
+
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
 DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
+DEFINE_INT(stub_cache_primary_table_bits, 11,
+           "log2 of the initial number of entries in the primary tables of "
+           "the megamorphic stub caches")
+DEFINE_INT(stub_cache_secondary_table_bits, 9,
+           "log2 of the initial number of entries in the secondary tables of "
+           "the megamorphic stub caches")
+DEFINE_BOOL(adaptive_stub_cache, false,
+            "grow the megamorphic stub caches when many of their entries are "
+            "evicted between two mark-compact collections")
+DEFINE_INT(stub_cache_max_primary_table_bits, 15,
+           "log2 of the maximum number of entries in the primary tables of "
+           "the megamorphic stub caches with --adaptive-stub-cache")
 
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
@@ -721,6 +749,11 @@ DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
 #endif
 DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
+DEFINE_BOOL(cache_baseline_code, false,
+            "include Sparkplug code in the code cache, so that isolates "
+            "consuming the cache don't have to compile it again. Consumed "
+            "caches are executed as machine code, so only use caches from "
+            "trusted sources")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "only enable Sparkplug baseline compiler when "
             "--short-builtin-calls are also enabled")
@@ -756,6 +789,9 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_UINT(concurrent_recompilation_max_threads, 0,
+            "max number of threads that concurrent Turbofan can use "
+            "(0 for unbounded)")
 DEFINE_BOOL(
     stress_concurrent_inlining, false,
     "create additional concurrent optimization jobs but throw away result")
@@ -874,12 +910,17 @@ DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile for on-stack replacement on a background thread and keep "
+            "running unoptimized code until the result is ready")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
 DEFINE_BOOL(trace_environment_liveness, false,
             "trace liveness of local variable slots")
 DEFINE_BOOL(turbo_load_elimination, true, "enable load elimination in TurboFan")
+DEFINE_BOOL(turbo_bounds_check_elimination, false,
+            "eliminate bounds checks of induction variables in TurboFan")
 DEFINE_BOOL(trace_turbo_load_elimination, false,
             "trace TurboFan load elimination")
 DEFINE_BOOL(turbo_profiling, false, "enable basic block profiling in TurboFan")
@@ -895,13 +936,20 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
+DEFINE_BOOL(turbo_loop_invariant_code_motion, false,
+            "hoist loop-invariant checks and loads in TurboFan")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
+DEFINE_BOOL(turbo_loop_vectorization, false,
+            "vectorize simple loops over typed arrays in TurboFan")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
+DEFINE_BOOL(turbo_loop_instruction_scheduling, false,
+            "enable instruction scheduling in TurboFan for non-deferred blocks "
+            "in loops only (experimental, no measured speedup yet)")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
@@ -921,6 +969,10 @@ DEFINE_WEAK_IMPLICATION(future, turbo_inline_js_wasm_calls)
 DEFINE_BOOL(turbo_inline_js_wasm_calls, false, "inline JS->Wasm calls")
 DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, true,
             "fall back to the mid-tier register allocator for huge functions")
+DEFINE_INT(turbo_mid_tier_regalloc_threshold, 8192,
+           "number of virtual registers above which a function is considered "
+           "huge and uses the mid-tier register allocator (the default was "
+           "picked for WebAssembly and is used for JavaScript as is)")
 DEFINE_BOOL(turbo_force_mid_tier_regalloc, false,
             "always use the mid-tier register allocator (for testing)")
 
@@ -1162,6 +1214,12 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_BOOL(adaptive_semi_space_sizing, false,
+            "size the semi-spaces based on the recent young generation GC "
+            "cost, survival ratio and allocation throughput")
+DEFINE_BOOL(trace_semi_space_sizing, false,
+            "trace semi-space sizing decisions of the adaptive controller")
+DEFINE_IMPLICATION(trace_semi_space_sizing, adaptive_semi_space_sizing)
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1232,6 +1290,9 @@ DEFINE_BOOL(trace_mutator_utilization, false,
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
+DEFINE_BOOL(cppgc_young_generation, true,
+            "run minor collections of the C++ heap along with young generation "
+            "GCs (requires building with cppgc_enable_young_generation)")
 DEFINE_BOOL(incremental_marking_task, true, "use tasks for incremental marking")
 DEFINE_INT(incremental_marking_soft_trigger, 0,
            "threshold for starting incremental marking via a task in percent "
@@ -1292,6 +1353,9 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_SIZE_T(zone_segment_pool_size, 8 * MB,
+              "max memory of unused zone segments kept for reuse by later "
+              "zones (0 to disable pooling)")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -1330,6 +1394,9 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(huge_pages_for_old_and_code_space, false,
+            "back old space and code space with transparent huge pages and "
+            "keep their freed pages committed in a pool (Linux only)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -1347,6 +1414,12 @@ DEFINE_BOOL(compact_with_stack, true,
 DEFINE_BOOL(
     compact_code_space_with_stack, true,
     "Perform code space compaction when finalizing a full GC with stack")
+DEFINE_FLOAT(compaction_pause_budget_ms, 0,
+             "Defer evacuation candidates to later GCs when evacuating them "
+             "would exceed this many ms of the atomic pause, estimated from "
+             "the traced compaction speed (0 means no limit). Deferred pages "
+             "are evacuated first by the next GC that selects them. Not "
+             "applied until a compaction speed sample exists")
 DEFINE_BOOL(stress_compaction, false,
             "Stress GC compaction to flush out bugs (implies "
             "--force_marking_deque_overflows)")
@@ -1632,6 +1705,9 @@ DEFINE_INT(heap_snapshot_string_limit, 1024,
            "truncate strings to this length in the heap snapshot")
 DEFINE_BOOL(heap_profiler_show_hidden_objects, false,
             "use 'native' rather than 'hidden' node type in snapshot")
+DEFINE_BOOL(heap_snapshot_parallel_serialization, true,
+            "format heap snapshot nodes and edges as JSON text on background "
+            "threads (snapshot generation stays on the main thread)")
 #ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
 DEFINE_BOOL(heap_snapshot_verify, false,
             "verify that heap snapshot matches marking visitor behavior")
@@ -1874,6 +1950,15 @@ DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
 DEFINE_BOOL(minor_mc_sweeping, false,
             "perform sweeping in young generation mark compact GCs")
+DEFINE_BOOL(minor_mc_incremental_marking, false,
+            "mark the young generation incrementally before the minor mark "
+            "compact pause")
+DEFINE_IMPLICATION(minor_mc_incremental_marking, minor_mc)
+DEFINE_INT(minor_mc_incremental_marking_trigger, 50,
+           "start incremental young generation marking in percent of the "
+           "current new space capacity")
+DEFINE_BOOL(trace_minor_mc_incremental_marking, false,
+            "trace incremental marking for the young generation")
 
 //
 // Dev shell flags
@@ -2198,6 +2283,7 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, heap_snapshot_parallel_serialization)
 
 //
 // Parallel and concurrent GC (Orinoco) related flags.
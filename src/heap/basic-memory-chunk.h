@@ -100,6 +100,14 @@ class BasicMemoryChunk {
 
     // This page belongs to a shared heap.
     IN_SHARED_HEAP = 1u << 22,
+
+    // |POOLED_COMMITTED|: Like |POOLED| but the chunk is not even uncommitted,
+    // which keeps the huge page backing it intact.
+    POOLED_COMMITTED = 1u << 23,
+
+    // |EVACUATION_DEFERRED|: The page was an evacuation candidate that did not
+    // fit into --compaction-pause-budget-ms. Later GCs evacuate it first.
+    EVACUATION_DEFERRED = 1u << 24,
   };
 
   using MainThreadFlags = base::Flags<Flag, uintptr_t>;
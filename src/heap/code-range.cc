@@ -9,6 +9,7 @@
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/memory-allocator.h"
 #include "src/utils/allocation.h"
 
 namespace v8 {
@@ -29,6 +30,9 @@ base::LazyInstance<std::weak_ptr<CodeRange>>::type process_wide_code_range_ =
 DEFINE_LAZY_LEAKY_OBJECT_GETTER(CodeRangeAddressHint, GetCodeRangeAddressHint)
 
 void FunctionInStaticBinaryForAddressHint() {}
+
+// Size of a transparent huge page on x64 and arm64 Linux.
+constexpr size_t kHugePageAlignment = size_t{2} * MB;
 }  // anonymous namespace
 
 Address CodeRangeAddressHint::GetAddressHint(size_t code_range_size,
@@ -127,10 +131,17 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
       V8_EXTERNAL_CODE_SPACE_BOOL
           ? base::bits::RoundUpToPowerOfTwo(requested)
           : VirtualMemoryCage::ReservationParams::kAnyBaseAlignment;
+  size_t hint_alignment = allocate_page_size;
+  if (MemoryAllocator::UsesHugePages(CODE_SPACE)) {
+    // Code pages can only be backed by huge pages if the range containing
+    // them is huge page aligned.
+    hint_alignment = std::max(hint_alignment, kHugePageAlignment);
+    params.base_alignment = std::max(params.base_alignment, hint_alignment);
+  }
   params.base_bias_size = RoundUp(reserved_area, allocate_page_size);
   params.page_size = MemoryChunk::kPageSize;
   params.requested_start_hint =
-      GetCodeRangeAddressHint()->GetAddressHint(requested, allocate_page_size);
+      GetCodeRangeAddressHint()->GetAddressHint(requested, hint_alignment);
 
   if (!VirtualMemoryCage::InitReservation(params)) return false;
 
@@ -299,6 +299,13 @@ void UnifiedHeapMarker::AddObject(void* object) {
 
 void CppHeap::MetricRecorderAdapter::AddMainThreadEvent(
     const FullCycle& cppgc_event) {
+  if (cppgc_event.type == FullCycle::Type::kMinor) {
+    // Sweeping of a minor cycle may finish after the V8 young generation cycle
+    // that triggered it has already been reported. Keep the latest event until
+    // the next young generation cycle is reported.
+    last_young_gc_event_ = cppgc_event;
+    return;
+  }
   DCHECK(!last_full_gc_event_.has_value());
   last_full_gc_event_ = cppgc_event;
 }
@@ -374,6 +381,13 @@ CppHeap::MetricRecorderAdapter::ExtractLastFullGcEvent() {
   return res;
 }
 
+const base::Optional<cppgc::internal::MetricRecorder::FullCycle>
+CppHeap::MetricRecorderAdapter::ExtractLastYoungGcEvent() {
+  auto res = std::move(last_young_gc_event_);
+  last_young_gc_event_.reset();
+  return res;
+}
+
 const base::Optional<cppgc::internal::MetricRecorder::MainThreadIncrementalMark>
 CppHeap::MetricRecorderAdapter::ExtractLastIncrementalMarkEvent() {
   auto res = std::move(last_incremental_mark_event_);
@@ -386,6 +400,7 @@ void CppHeap::MetricRecorderAdapter::ClearCachedEvents() {
   incremental_sweep_batched_events_.events.clear();
   last_incremental_mark_event_.reset();
   last_full_gc_event_.reset();
+  last_young_gc_event_.reset();
 }
 
 Isolate* CppHeap::MetricRecorderAdapter::GetIsolate() const {
@@ -420,6 +435,9 @@ CppHeap::CppHeap(
   // garbage collections.
   no_gc_scope_++;
   stats_collector()->RegisterObserver(this);
+#if defined(CPPGC_YOUNG_GENERATION)
+  if (!FLAG_cppgc_young_generation) DisableGenerationalGC();
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 }
 
 CppHeap::~CppHeap() {
@@ -504,18 +522,23 @@ void CppHeap::InitializeTracing(
 
   DCHECK(!collection_type_);
   collection_type_ = collection_type;
+  const bool is_minor_gc =
+      *collection_type_ ==
+      cppgc::internal::GarbageCollector::Config::CollectionType::kMinor;
 
 #if defined(CPPGC_YOUNG_GENERATION)
-  if (*collection_type_ ==
-      cppgc::internal::GarbageCollector::Config::CollectionType::kMajor)
-    cppgc::internal::SequentialUnmarker unmarker(raw_heap());
+  DCHECK_IMPLIES(is_minor_gc, generational_gc_enabled());
+  if (!is_minor_gc) cppgc::internal::SequentialUnmarker unmarker(raw_heap());
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 
   current_gc_flags_ = gc_flags;
 
+  // Minor collections are always finished within the V8 young generation
+  // pause that triggered them.
   const UnifiedHeapMarker::MarkingConfig marking_config{
       *collection_type_, cppgc::Heap::StackState::kNoHeapPointers,
-      (IsForceGC(current_gc_flags_) && !force_incremental_marking_for_testing_)
+      ((IsForceGC(current_gc_flags_) || is_minor_gc) &&
+       !force_incremental_marking_for_testing_)
           ? UnifiedHeapMarker::MarkingConfig::MarkingType::kAtomic
           : UnifiedHeapMarker::MarkingConfig::MarkingType::
                 kIncrementalAndConcurrent,
@@ -525,7 +548,7 @@ void CppHeap::InitializeTracing(
   DCHECK_IMPLIES(!isolate_, (cppgc::Heap::MarkingType::kAtomic ==
                              marking_config.marking_type) ||
                                 force_incremental_marking_for_testing_);
-  if (ShouldReduceMemory(current_gc_flags_)) {
+  if (!is_minor_gc && ShouldReduceMemory(current_gc_flags_)) {
     // Only enable compaction when in a memory reduction garbage collection as
     // it may significantly increase the final garbage collection pause.
     compactor_.InitializeIfShouldCompact(marking_config.marking_type,
@@ -591,16 +614,21 @@ void CppHeap::TraceEpilogue() {
     marker_->LeaveAtomicPause();
   }
   marker_.reset();
-  if (isolate_) {
+  // With sticky mark bits a minor collection only accounts for the objects it
+  // newly marked, which is not the live size of the whole heap. Keep V8's view
+  // of the C++ heap untouched in that case.
+  if (isolate_ &&
+      *collection_type_ ==
+          cppgc::internal::GarbageCollector::Config::CollectionType::kMajor) {
     auto* tracer = isolate_->heap()->local_embedder_heap_tracer();
     DCHECK_NOT_NULL(tracer);
     tracer->UpdateRemoteStats(
         stats_collector_->marked_bytes(),
         stats_collector_->marking_time().InMillisecondsF());
+    // The allocated bytes counter in v8 was reset to the current marked bytes,
+    // so any pending allocated bytes updates should be discarded.
+    buffered_allocated_bytes_ = 0;
   }
-  // The allocated bytes counter in v8 was reset to the current marked bytes, so
-  // any pending allocated bytes updates should be discarded.
-  buffered_allocated_bytes_ = 0;
   const size_t bytes_allocated_in_prefinalizers = ExecutePreFinalizers();
 #if CPPGC_VERIFY_HEAP
   UnifiedHeapMarkingVerifier verifier(*this, *collection_type_);
@@ -702,6 +730,32 @@ void CppHeap::CollectGarbageForTesting(
   }
 }
 
+void CppHeap::RunMinorGCIfNeeded() {
+#if defined(CPPGC_YOUNG_GENERATION)
+  DCHECK_NOT_NULL(isolate_);
+  if (!generational_gc_enabled()) return;
+  if (in_no_gc_scope()) return;
+  // Minor collections cannot be nested in a major cycle. Sticky mark bits would
+  // otherwise be mixed up with the marking state of the major cycle.
+  if (IsMarking()) return;
+
+  // Finish sweeping in case it is still running.
+  sweeper().FinishIfRunning();
+
+  SetStackEndOfCurrentGC(v8::base::Stack::GetCurrentStackPosition());
+
+  InitializeTracing(
+      cppgc::internal::GarbageCollector::Config::CollectionType::kMinor,
+      GarbageCollectionFlagValues::kNoFlags);
+  StartTracing();
+  EnterFinalPause(isolate_->heap()
+                      ->local_embedder_heap_tracer()
+                      ->embedder_stack_state());
+  AdvanceTracing(std::numeric_limits<double>::infinity());
+  TraceEpilogue();
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+}
+
 void CppHeap::EnableDetachedGarbageCollectionsForTesting() {
   CHECK(!in_detached_testing_mode_);
   CHECK_NULL(isolate_);
@@ -55,7 +55,7 @@ class V8_EXPORT_PRIVATE CppHeap final
 
     void FlushBatchedIncrementalEvents();
 
-    // The following 3 methods are only used for reporting nested cpp events
+    // The following 4 methods are only used for reporting nested cpp events
     // through V8. Standalone events are reported directly.
     bool MetricsReportPending() const;
 
@@ -64,6 +64,8 @@ class V8_EXPORT_PRIVATE CppHeap final
     const base::Optional<
         cppgc::internal::MetricRecorder::MainThreadIncrementalMark>
     ExtractLastIncrementalMarkEvent();
+    const base::Optional<cppgc::internal::MetricRecorder::FullCycle>
+    ExtractLastYoungGcEvent();
 
     void ClearCachedEvents();
 
@@ -81,6 +83,8 @@ class V8_EXPORT_PRIVATE CppHeap final
         last_full_gc_event_;
     base::Optional<cppgc::internal::MetricRecorder::MainThreadIncrementalMark>
         last_incremental_mark_event_;
+    base::Optional<cppgc::internal::MetricRecorder::FullCycle>
+        last_young_gc_event_;
   };
 
   static CppHeap* From(v8::CppHeap* heap) {
@@ -119,6 +123,11 @@ class V8_EXPORT_PRIVATE CppHeap final
 
   void FinishSweepingIfRunning();
 
+  // Runs an atomic minor collection of the C++ heap unless generational
+  // collections are disabled or a major cycle is in progress. Invoked at the
+  // end of V8 young generation GCs.
+  void RunMinorGCIfNeeded();
+
   void InitializeTracing(
       cppgc::internal::GarbageCollector::Config::CollectionType,
       GarbageCollectionFlags);
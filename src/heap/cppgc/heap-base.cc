@@ -141,6 +141,11 @@ void HeapBase::ResetRememberedSet() {
   caged_heap().local_data().age_table.Reset(&caged_heap().allocator());
   remembered_set_.Reset();
 }
+
+void HeapBase::DisableGenerationalGC() {
+  generational_gc_enabled_ = false;
+  remembered_set_.Reset();
+}
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 
 void HeapBase::Terminate() {
@@ -168,6 +168,11 @@ class V8_EXPORT_PRIVATE HeapBase : public cppgc::HeapHandle {
 
 #if defined(CPPGC_YOUNG_GENERATION)
   OldToNewRememberedSet& remembered_set() { return remembered_set_; }
+
+  // Generational collections can be turned off for heaps that never run minor
+  // collections, in which case the generational barrier records nothing.
+  bool generational_gc_enabled() const { return generational_gc_enabled_; }
+  void DisableGenerationalGC();
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 
   size_t ObjectPayloadSize() const;
@@ -265,6 +270,7 @@ class V8_EXPORT_PRIVATE HeapBase : public cppgc::HeapHandle {
       allocation_observer_for_PROCESS_HEAP_STATISTICS_;
 #if defined(CPPGC_YOUNG_GENERATION)
   OldToNewRememberedSet remembered_set_;
+  bool generational_gc_enabled_ = true;
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 
   size_t no_gc_scope_ = 0;
@@ -20,7 +20,10 @@ class StatsCollector;
  */
 class MetricRecorder {
  public:
+  // Reported at the end of every cycle. Minor cycles of the young generation
+  // use the same event, distinguished by |type|.
   struct FullCycle {
+    enum class Type { kMinor, kMajor };
     struct IncrementalPhases {
       int64_t mark_duration_us = -1;
       int64_t sweep_duration_us = -1;
@@ -35,6 +38,7 @@ class MetricRecorder {
       int64_t freed_bytes = -1;
     };
 
+    Type type = Type::kMajor;
     Phases total;
     Phases main_thread;
     Phases main_thread_atomic;
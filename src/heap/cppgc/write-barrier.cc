@@ -135,6 +135,9 @@ void WriteBarrier::GenerationalBarrierSlow(const CagedHeapLocalData& local_data,
   // results in applying the generational barrier.
   if (local_data.heap_base.in_atomic_pause()) return;
 
+  // Nothing needs to be recorded when minor collections never run.
+  if (!local_data.heap_base.generational_gc_enabled()) return;
+
   if (value_offset > 0 && age_table[value_offset] == AgeTable::Age::kOld)
     return;
 
@@ -147,6 +150,8 @@ void WriteBarrier::GenerationalBarrierForSourceObjectSlow(
     const CagedHeapLocalData& local_data, const void* inner_pointer) {
   DCHECK(inner_pointer);
 
+  if (!local_data.heap_base.generational_gc_enabled()) return;
+
   auto& object_header =
       BasePage::FromInnerAddress(&local_data.heap_base, inner_pointer)
           ->ObjectHeaderFromInnerAddress(inner_pointer);
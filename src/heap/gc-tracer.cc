@@ -277,6 +277,9 @@ void GCTracer::ResetForTesting() {
   start_of_observable_pause_ = 0.0;
   young_gc_while_full_gc_ = false;
   ResetIncrementalMarkingCounters();
+  for (int i = 0; i < Scope::NUMBER_OF_MINOR_INCREMENTAL_SCOPES; i++) {
+    minor_incremental_marking_scopes_[i].ResetCurrentCycle();
+  }
   allocation_time_ms_ = 0.0;
   new_space_allocation_counter_bytes_ = 0.0;
   old_generation_allocation_counter_bytes_ = 0.0;
@@ -460,6 +463,15 @@ void GCTracer::UpdateStatistics(GarbageCollector collector) {
     recorded_minor_gcs_survived_.Push(
         MakeBytesAndDuration(current_.survived_young_object_size, duration));
     FetchBackgroundMinorGCCounters();
+    if (current_.type == Event::MINOR_MARK_COMPACTOR) {
+      for (int i = 0; i < Scope::NUMBER_OF_MINOR_INCREMENTAL_SCOPES; i++) {
+        current_.minor_incremental_marking_scopes[i] =
+            minor_incremental_marking_scopes_[i];
+        current_.scopes[Scope::FIRST_MINOR_INCREMENTAL_SCOPE + i] =
+            minor_incremental_marking_scopes_[i].duration;
+        minor_incremental_marking_scopes_[i].ResetCurrentCycle();
+      }
+    }
     long_task_stats->gc_young_wall_clock_duration_us += duration_us;
   } else {
     if (current_.type == Event::INCREMENTAL_MARK_COMPACTOR) {
@@ -710,6 +722,10 @@ void GCTracer::PrintNVP() const {
         current_.end_time - incremental_marking_start_time_;
   }
 
+  const IncrementalMarkingInfos& minor_incremental_marking =
+      current_.minor_incremental_marking_scopes
+          [Scope::MINOR_MC_INCREMENTAL - Scope::FIRST_MINOR_INCREMENTAL_SCOPE];
+
   switch (current_.type) {
     case Event::SCAVENGER:
       heap_->isolate()->PrintWithTimestamp(
@@ -806,10 +822,16 @@ void GCTracer::PrintNVP() const {
           "finish_sweeping=%.2f "
           "time_to_safepoint=%.2f "
           "mark=%.2f "
+          "mark.finish_incremental=%.2f "
           "mark.seed=%.2f "
           "mark.roots=%.2f "
           "mark.weak=%.2f "
           "mark.global_handles=%.2f "
+          "incremental=%.2f "
+          "incremental.start=%.2f "
+          "incremental.steps_count=%d "
+          "incremental.steps_took=%.1f "
+          "incremental.longest_step=%.1f "
           "clear=%.2f "
           "clear.string_table=%.2f "
           "clear.weak_lists=%.2f "
@@ -830,10 +852,15 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::MINOR_MC_SWEEPING],
           current_.scopes[Scope::TIME_TO_SAFEPOINT],
           current_.scopes[Scope::MINOR_MC_MARK],
+          current_.scopes[Scope::MINOR_MC_MARK_FINISH_INCREMENTAL],
           current_.scopes[Scope::MINOR_MC_MARK_SEED],
           current_.scopes[Scope::MINOR_MC_MARK_ROOTS],
           current_.scopes[Scope::MINOR_MC_MARK_WEAK],
           current_.scopes[Scope::MINOR_MC_MARK_GLOBAL_HANDLES],
+          current_.scopes[Scope::MINOR_MC_INCREMENTAL],
+          current_.scopes[Scope::MINOR_MC_INCREMENTAL_START],
+          minor_incremental_marking.steps, minor_incremental_marking.duration,
+          minor_incremental_marking.longest_step,
           current_.scopes[Scope::MINOR_MC_CLEAR],
           current_.scopes[Scope::MINOR_MC_CLEAR_STRING_TABLE],
           current_.scopes[Scope::MINOR_MC_CLEAR_WEAK_LISTS],
@@ -1166,6 +1193,17 @@ double GCTracer::ScavengeSpeedInBytesPerMillisecond(
   }
 }
 
+double GCTracer::AverageYoungGenerationGCDurationInMilliseconds() const {
+  const int count = recorded_minor_gcs_total_.Count();
+  if (count == 0) return 0;
+  const BytesAndDuration sum = recorded_minor_gcs_total_.Sum(
+      [](BytesAndDuration a, BytesAndDuration b) {
+        return std::make_pair(a.first + b.first, a.second + b.second);
+      },
+      MakeBytesAndDuration(0, 0));
+  return sum.second / count;
+}
+
 double GCTracer::CompactionSpeedInBytesPerMillisecond() const {
   return AverageSpeed(recorded_compactions_);
 }
@@ -1608,6 +1646,30 @@ void GCTracer::ReportYoungCycleToRecorder() {
   event.main_thread_efficiency_in_bytes_per_us =
       freed_bytes / main_thread_wall_clock_duration_in_us;
 
+  if (heap_->cpp_heap()) {
+    const base::Optional<cppgc::internal::MetricRecorder::FullCycle>
+        optional_cppgc_event = CppHeap::From(heap_->cpp_heap())
+                                   ->GetMetricRecorder()
+                                   ->ExtractLastYoungGcEvent();
+    // The C++ heap skips minor collections while a major cycle is running.
+    if (optional_cppgc_event.has_value()) {
+      const cppgc::internal::MetricRecorder::FullCycle& cppgc_event =
+          optional_cppgc_event.value();
+      DCHECK_EQ(cppgc::internal::MetricRecorder::FullCycle::Type::kMinor,
+                cppgc_event.type);
+      CopyTimeMetrics(event.total_cpp, cppgc_event.total);
+      CopyTimeMetrics(event.main_thread_cpp, cppgc_event.main_thread);
+      CopySizeMetrics(event.objects_cpp, cppgc_event.objects);
+      CopySizeMetrics(event.memory_cpp, cppgc_event.memory);
+      event.collection_rate_cpp_in_percent =
+          cppgc_event.collection_rate_in_percent;
+      event.efficiency_cpp_in_bytes_per_us =
+          cppgc_event.efficiency_in_bytes_per_us;
+      event.main_thread_efficiency_cpp_in_bytes_per_us =
+          cppgc_event.main_thread_efficiency_in_bytes_per_us;
+    }
+  }
+
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
 }
 
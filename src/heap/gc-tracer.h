@@ -95,6 +95,10 @@ class V8_EXPORT_PRIVATE GCTracer {
       FIRST_SCOPE = MC_INCREMENTAL,
       NUMBER_OF_INCREMENTAL_SCOPES =
           LAST_INCREMENTAL_SCOPE - FIRST_INCREMENTAL_SCOPE + 1,
+      FIRST_MINOR_INCREMENTAL_SCOPE = MINOR_MC_INCREMENTAL,
+      LAST_MINOR_INCREMENTAL_SCOPE = MINOR_MC_INCREMENTAL_START,
+      NUMBER_OF_MINOR_INCREMENTAL_SCOPES =
+          LAST_MINOR_INCREMENTAL_SCOPE - FIRST_MINOR_INCREMENTAL_SCOPE + 1,
       FIRST_GENERAL_BACKGROUND_SCOPE = BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP,
       LAST_GENERAL_BACKGROUND_SCOPE = BACKGROUND_UNMAPPER,
       FIRST_MC_BACKGROUND_SCOPE = MC_BACKGROUND_EVACUATE_COPY,
@@ -217,6 +221,11 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Holds details for incremental marking scopes.
     IncrementalMarkingInfos
         incremental_marking_scopes[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
+
+    // Holds details for young generation incremental marking scopes of
+    // MINOR_MARK_COMPACTOR.
+    IncrementalMarkingInfos minor_incremental_marking_scopes
+        [Scope::NUMBER_OF_MINOR_INCREMENTAL_SCOPES];
   };
 
   class RecordGCPhasesInfo {
@@ -326,6 +335,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   double ScavengeSpeedInBytesPerMillisecond(
       ScavengeSpeedMode mode = kForAllObjects) const;
 
+  // Compute the average duration of the recorded young generation GCs.
+  // Returns 0 if no events have been recorded.
+  double AverageYoungGenerationGCDurationInMilliseconds() const;
+
   // Compute the average compaction speed in bytes/millisecond.
   // Returns 0 if not enough events have been recorded.
   double CompactionSpeedInBytesPerMillisecond() const;
@@ -404,6 +417,11 @@ class V8_EXPORT_PRIVATE GCTracer {
         scope <= Scope::LAST_INCREMENTAL_SCOPE) {
       incremental_marking_scopes_[scope - Scope::FIRST_INCREMENTAL_SCOPE]
           .Update(duration);
+    } else if (scope >= Scope::FIRST_MINOR_INCREMENTAL_SCOPE &&
+               scope <= Scope::LAST_MINOR_INCREMENTAL_SCOPE) {
+      minor_incremental_marking_scopes_
+          [scope - Scope::FIRST_MINOR_INCREMENTAL_SCOPE]
+              .Update(duration);
     } else {
       current_.scopes[scope] += duration;
     }
@@ -536,6 +554,11 @@ class V8_EXPORT_PRIVATE GCTracer {
   IncrementalMarkingInfos
       incremental_marking_scopes_[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
 
+  // Young generation incremental marking happens outside of a GC cycle. The
+  // infos are merged into the next MINOR_MARK_COMPACTOR event.
+  IncrementalMarkingInfos minor_incremental_marking_scopes_
+      [Scope::NUMBER_OF_MINOR_INCREMENTAL_SCOPES];
+
   // Timestamp and allocation counter at the last sampled allocation event.
   double allocation_time_ms_;
   size_t new_space_allocation_counter_bytes_;
@@ -5,6 +5,7 @@
 #include "src/heap/heap-controller.h"
 
 #include "src/execution/isolate-inl.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/spaces.h"
 
 namespace v8 {
@@ -165,6 +166,89 @@ size_t MemoryController<Trait>::CalculateAllocationLimit(
   return result;
 }
 
+// Given the average duration D of a young generation GC at the current
+// capacity C0, the survival ratio S and the allocation throughput A, this
+// function returns the smallest capacity C for which young generation GCs keep
+// the mutator utilization at or above MU.
+//
+// Dead objects are free to collect, so only the surviving part of the GC cost
+// scales with the capacity:
+//   G(C) = D * ((1 - S) + S * C / C0)
+// The time spent in GC per byte allocated is G(C) / C and the time spent in
+// the mutator per byte allocated is 1 / A. Requiring the mutator utilization
+// to be at least MU yields
+//   G(C) / C <= (1 - MU) / (MU * A) =: B
+//   D * (1 - S) / C <= B - D * S / C0
+//   C >= D * (1 - S) / (B - D * S / C0)
+// If the right-hand side is not positive, then survivors alone exceed the
+// budget and growing new space does not help (most of it gets promoted
+// anyway), so the current capacity is kept.
+size_t YoungGenerationSizeController::DesiredCapacity(
+    double gc_duration_in_ms, double survival_ratio,
+    double allocation_throughput_in_bytes_per_ms, size_t current_capacity,
+    size_t min_capacity, size_t max_capacity) {
+  DCHECK_LE(min_capacity, max_capacity);
+  DCHECK_LE(0.0, survival_ratio);
+  current_capacity =
+      std::min(std::max(current_capacity, min_capacity), max_capacity);
+  if (gc_duration_in_ms == 0 || allocation_throughput_in_bytes_per_ms == 0) {
+    return current_capacity;
+  }
+  survival_ratio = std::min(survival_ratio, 1.0);
+
+  const double budget =
+      (1 - kTargetMutatorUtilization) /
+      (kTargetMutatorUtilization * allocation_throughput_in_bytes_per_ms);
+  const double survivor_cost =
+      gc_duration_in_ms * survival_ratio / current_capacity;
+  if (budget <= survivor_cost) return current_capacity;
+
+  const double capacity =
+      gc_duration_in_ms * (1 - survival_ratio) / (budget - survivor_cost);
+  if (capacity >= max_capacity) return max_capacity;
+  const size_t rounded_capacity =
+      ::RoundUp(static_cast<size_t>(capacity), Page::kPageSize);
+  return std::min(std::max(rounded_capacity, min_capacity), max_capacity);
+}
+
+size_t YoungGenerationSizeController::NextCapacity(size_t current_capacity,
+                                                   size_t min_capacity,
+                                                   size_t max_capacity) {
+  GCTracer* tracer = heap_->tracer();
+  const double gc_duration =
+      tracer->AverageYoungGenerationGCDurationInMilliseconds();
+  const double survival_ratio = tracer->AverageSurvivalRatio() / 100;
+  const double allocation_throughput =
+      tracer->NewSpaceAllocationThroughputInBytesPerMillisecond();
+  const size_t desired_capacity = DesiredCapacity(
+      gc_duration, survival_ratio, allocation_throughput, current_capacity,
+      min_capacity, max_capacity);
+
+  size_t result = current_capacity;
+  if (desired_capacity > current_capacity) {
+    shrink_decisions_ = 0;
+    result = desired_capacity;
+  } else if (desired_capacity <= current_capacity * kShrinkThreshold) {
+    if (++shrink_decisions_ >= kShrinkDecisionsBeforeShrinking) {
+      shrink_decisions_ = 0;
+      result = desired_capacity;
+    }
+  } else {
+    shrink_decisions_ = 0;
+  }
+
+  if (FLAG_trace_semi_space_sizing) {
+    Isolate::FromHeap(heap_)->PrintWithTimestamp(
+        "[YoungGenerationSizeController] capacity: %zu KB -> %zu KB "
+        "(desired=%zu KB, gc=%.2f ms, survival=%.2f, "
+        "allocation=%.f bytes/ms, shrink_decisions=%d)\n",
+        current_capacity / KB, result / KB, desired_capacity / KB,
+        gc_duration, survival_ratio, allocation_throughput,
+        shrink_decisions_);
+  }
+  return result;
+}
+
 template class V8_EXPORT_PRIVATE MemoryController<V8HeapTrait>;
 template class V8_EXPORT_PRIVATE MemoryController<GlobalMemoryTrait>;
 
@@ -56,6 +56,42 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
+// Picks the semi-space capacity based on the recent history of young
+// generation GCs, so that the time spent in young generation GCs per byte
+// allocated stays within the target mutator utilization.
+class V8_EXPORT_PRIVATE YoungGenerationSizeController {
+ public:
+  static constexpr double kTargetMutatorUtilization = 0.97;
+  // Number of consecutive shrinking decisions before new space is shrunk.
+  static constexpr int kShrinkDecisionsBeforeShrinking = 3;
+  // Shrinking is only considered if the desired capacity is at most this
+  // fraction of the current capacity.
+  static constexpr double kShrinkThreshold = 0.5;
+
+  explicit YoungGenerationSizeController(Heap* heap) : heap_(heap) {}
+  YoungGenerationSizeController(const YoungGenerationSizeController&) =
+      delete;
+  YoungGenerationSizeController& operator=(
+      const YoungGenerationSizeController&) = delete;
+
+  // Returns the capacity new space should be resized to after the current
+  // GC. Growing takes effect immediately whereas shrinking requires
+  // kShrinkDecisionsBeforeShrinking consecutive decisions to avoid
+  // oscillation on bursty allocation.
+  size_t NextCapacity(size_t current_capacity, size_t min_capacity,
+                      size_t max_capacity);
+
+  static size_t DesiredCapacity(double gc_duration_in_ms,
+                                double survival_ratio,
+                                double allocation_throughput_in_bytes_per_ms,
+                                size_t current_capacity, size_t min_capacity,
+                                size_t max_capacity);
+
+ private:
+  Heap* const heap_;
+  int shrink_decisions_ = 0;
+};
+
 }  // namespace internal
 }  // namespace v8
 
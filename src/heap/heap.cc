@@ -69,6 +69,7 @@
 #include "src/heap/objects-visiting.h"
 #include "src/heap/paged-spaces-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/heap/pretenuring-sampler.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/safepoint.h"
@@ -88,6 +89,7 @@
 #include "src/objects/free-space-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/instance-type.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/maybe-object.h"
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots-atomic-inl.h"
@@ -102,11 +104,16 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
 #endif
 
+#if V8_ENABLE_WEBASSEMBLY
+#include "src/wasm/wasm-engine.h"
+#endif  // V8_ENABLE_WEBASSEMBLY
+
 #include "src/base/platform/wrappers.h"
 // Has to be the last include (doesn't have include guards):
 #include "src/objects/object-macros.h"
@@ -1061,6 +1068,9 @@ void Heap::GarbageCollectionPrologueInSafepoint() {
   TRACE_GC(tracer(), GCTracer::Scope::HEAP_PROLOGUE_SAFEPOINT);
   gc_count_++;
 
+  // Every GC may move maps and names, see DictionaryLookupCache.
+  isolate_->dictionary_lookup_cache()->Clear();
+
   if (new_space_) {
     UpdateNewSpaceAllocationCounter();
     CheckNewSpaceExpansionCriteria();
@@ -1956,6 +1966,8 @@ bool Heap::CollectGarbage(AllocationSpace space,
         kGCCallbackScheduleIdleGarbageCollection);
   }
 
+  memory_reducer_->NotifyGarbageCollection(collector);
+
   if (!CanExpandOldGeneration(0)) {
     InvokeNearHeapLimitCallback();
     if (!CanExpandOldGeneration(0)) {
@@ -2006,6 +2018,12 @@ void Heap::StartIncrementalMarking(int gc_flags,
   VerifyCountersAfterSweeping();
 #endif
 
+  // Full marking also marks through the young generation, so incremental young
+  // generation marking is given up.
+  if (minor_mark_compact_collector()->IsMarking()) {
+    minor_mark_compact_collector()->AbortMarking();
+  }
+
   // Now that sweeping is completed, we can start the next full GC cycle.
   tracer()->StartCycle(GarbageCollector::MARK_COMPACTOR, gc_reason, nullptr,
                        GCTracer::MarkingType::kIncremental);
@@ -2286,7 +2304,14 @@ size_t Heap::PerformGarbageCollection(
       break;
   }
 
+  if (IsYoungGenerationCollector(collector) && cpp_heap()) {
+    // Dead young wrappers have been dropped by now, so the minor collection of
+    // the C++ heap only keeps objects alive that are still reachable from V8.
+    CppHeap::From(cpp_heap())->RunMinorGCIfNeeded();
+  }
+
   ProcessPretenuringFeedback();
+  if (pretenuring_sampler_) pretenuring_sampler_->ProcessSamples();
 
   UpdateSurvivalStatistics(static_cast<int>(start_young_generation_size));
   ConfigureInitialOldGenerationSize();
@@ -2544,6 +2569,12 @@ void Heap::MarkCompact() {
   UpdateOldGenerationAllocationCounter();
   uint64_t size_of_objects_before_gc = SizeOfObjects();
 
+  // The full GC moves young objects, which invalidates young generation
+  // marking that may be in progress.
+  if (minor_mark_compact_collector()->IsMarking()) {
+    minor_mark_compact_collector()->AbortMarking();
+  }
+
   mark_compact_collector()->Prepare();
 
   ms_count_++;
@@ -2619,6 +2650,11 @@ void Heap::MarkCompactPrologue() {
 }
 
 void Heap::CheckNewSpaceExpansionCriteria() {
+  // With adaptive sizing, new space is resized in the GC epilogue instead.
+  if (young_generation_size_controller_) {
+    new_lo_space()->SetCapacity(new_space()->Capacity());
+    return;
+  }
   if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
       survived_since_last_expansion_ > new_space_->TotalCapacity()) {
     // Grow the size of new space if there is room to grow, and enough data
@@ -3066,6 +3102,7 @@ void Heap::EvaluateOldSpaceLocalPretenuring(
     // dependent code registered in the allocation sites to re-evaluate
     // our pretenuring decisions.
     ResetAllAllocationSitesDependentCode(AllocationType::kOld);
+    if (pretenuring_sampler_) pretenuring_sampler_->ResetDecisions();
     if (FLAG_trace_pretenuring) {
       PrintF(
           "Deopt all allocation sites dependent code due to low survival "
@@ -3319,6 +3356,12 @@ HeapObject Heap::CreateFillerObjectAt(Address addr, int size,
   return filler;
 }
 
+bool Heap::IsMarkingYoungGeneration() const {
+  return incremental_marking()->IsMarking() ||
+         (minor_mark_compact_collector_ &&
+          minor_mark_compact_collector_->IsMarking());
+}
+
 bool Heap::CanMoveObjectStart(HeapObject object) {
   if (!FLAG_move_object_start) return false;
 
@@ -3327,6 +3370,12 @@ bool Heap::CanMoveObjectStart(HeapObject object) {
 
   if (IsLargeObject(object)) return false;
 
+  // Incremental young generation marking does not track left-trimming.
+  if (minor_mark_compact_collector()->IsMarking() &&
+      InYoungGeneration(object)) {
+    return false;
+  }
+
   // Compilation jobs may have references to the object.
   if (isolate()->concurrent_recompilation_enabled() &&
       isolate()->optimizing_compile_dispatcher()->HasJobs()) {
@@ -3791,6 +3840,11 @@ void Heap::ReduceNewSpaceSize() {
 
   if (FLAG_predictable) return;
 
+  if (young_generation_size_controller_ && !ShouldReduceMemory()) {
+    ResizeNewSpaceAdaptively();
+    return;
+  }
+
   if (ShouldReduceMemory() ||
       ((allocation_throughput != 0) &&
        (allocation_throughput < kLowAllocationThroughput))) {
@@ -3800,6 +3854,22 @@ void Heap::ReduceNewSpaceSize() {
   }
 }
 
+void Heap::ResizeNewSpaceAdaptively() {
+  const size_t current_capacity = new_space_->TotalCapacity();
+  const size_t new_capacity = young_generation_size_controller_->NextCapacity(
+      current_capacity, new_space_->InitialTotalCapacity(),
+      new_space_->MaximumCapacity());
+  if (new_capacity > current_capacity) {
+    new_space_->GrowTo(new_capacity);
+  } else if (new_capacity < current_capacity) {
+    new_space_->ShrinkTo(new_capacity);
+    UncommitFromSpace();
+  } else {
+    return;
+  }
+  new_lo_space_->SetCapacity(new_space_->Capacity());
+}
+
 size_t Heap::NewSpaceSize() { return new_space() ? new_space()->Size() : 0; }
 
 size_t Heap::NewSpaceCapacity() {
@@ -4108,6 +4178,8 @@ bool Heap::IdleNotification(double deadline_in_seconds) {
                              OldGenerationAllocationCounter(),
                              EmbedderAllocationCounter());
 
+  memory_reducer_->NotifyIdleWindow(deadline_in_ms);
+
   GCIdleTimeHeapState heap_state = ComputeHeapState();
   GCIdleTimeAction action =
       gc_idle_time_handler_->Compute(idle_time_in_ms, heap_state);
@@ -4203,6 +4275,14 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                static_cast<int>(level));
   MemoryPressureLevel previous =
       memory_pressure_level_.exchange(level, std::memory_order_relaxed);
+  if (level != MemoryPressureLevel::kNone) {
+    // Pooled zone segments are only a cache for upcoming compilations, so
+    // give them back right away. The pools are thread-safe.
+    isolate()->allocator()->ReleasePooledSegments();
+#if V8_ENABLE_WEBASSEMBLY
+    wasm::GetWasmEngine()->allocator()->ReleasePooledSegments();
+#endif  // V8_ENABLE_WEBASSEMBLY
+  }
   if ((previous != MemoryPressureLevel::kCritical &&
        level == MemoryPressureLevel::kCritical) ||
       (previous == MemoryPressureLevel::kNone &&
@@ -5780,6 +5860,10 @@ void Heap::SetUpSpaces(LinearAllocationArea* new_allocation_info,
   gc_idle_time_handler_.reset(new GCIdleTimeHandler());
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
   memory_reducer_.reset(new MemoryReducer(this));
+  if (FLAG_adaptive_semi_space_sizing) {
+    young_generation_size_controller_.reset(
+        new YoungGenerationSizeController(this));
+  }
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
     live_object_stats_.reset(new ObjectStats(this));
     dead_object_stats_.reset(new ObjectStats(this));
@@ -5805,6 +5889,11 @@ void Heap::SetUpSpaces(LinearAllocationArea* new_allocation_info,
     scavenge_task_observer_.reset(new ScavengeTaskObserver(
         this, ScavengeJob::YoungGenerationTaskTriggerSize(this)));
     new_space()->AddAllocationObserver(scavenge_task_observer_.get());
+
+    if (FLAG_lifetime_sampling_pretenuring) {
+      pretenuring_sampler_.reset(new PretenuringSampler(this));
+      pretenuring_sampler_->SetUp();
+    }
   }
 
   SetGetExternallyAllocatedMemoryInBytesCallback(
@@ -5989,6 +6078,13 @@ void Heap::StartTearDown() {
   // the heap during teardown.
   CompleteSweepingFull();
 
+  if (minor_mark_compact_collector()->IsMarking()) {
+    AllowGarbageCollection allow_gc;
+    IgnoreLocalGCRequests ignore_gc_requests(this);
+    SafepointScope scope(this);
+    minor_mark_compact_collector()->AbortMarking();
+  }
+
   memory_allocator()->unmapper()->EnsureUnmappingCompleted();
 
   SetGCState(TEAR_DOWN);
@@ -6045,6 +6141,11 @@ void Heap::TearDown() {
   scavenge_task_observer_.reset();
   scavenge_job_.reset();
 
+  if (pretenuring_sampler_) {
+    pretenuring_sampler_->TearDown();
+    pretenuring_sampler_.reset();
+  }
+
   if (need_to_remove_stress_concurrent_allocation_observer_) {
     RemoveAllocationObserversFromAllSpaces(
         stress_concurrent_allocation_observer_.get(),
@@ -6088,6 +6189,8 @@ void Heap::TearDown() {
     memory_reducer_.reset();
   }
 
+  young_generation_size_controller_.reset();
+
   live_object_stats_.reset();
   dead_object_stats_.reset();
 
@@ -7303,6 +7406,8 @@ void Heap::WriteBarrierForRange(HeapObject object, TSlot start_slot,
     if (!source_page->ShouldSkipEvacuationSlotRecording()) {
       mode |= kDoEvacuationSlotRecording;
     }
+  } else if (source_page->InYoungGeneration() && IsMarkingYoungGeneration()) {
+    mode |= kDoMarking;
   }
 
   switch (mode) {
@@ -7376,7 +7481,12 @@ bool Heap::PageFlagsAreConsistent(HeapObject object) {
     // find a heap. The exception is when the ReadOnlySpace is writeable, during
     // bootstrapping, so explicitly allow this case.
     Heap* heap = Heap::FromWritableHeapObject(object);
-    CHECK_EQ(slim_chunk->IsMarking(), heap->incremental_marking()->IsMarking());
+    if (slim_chunk->InYoungGeneration()) {
+      CHECK_EQ(slim_chunk->IsMarking(), heap->IsMarkingYoungGeneration());
+    } else {
+      CHECK_EQ(slim_chunk->IsMarking(),
+               heap->incremental_marking()->IsMarking());
+    }
   } else {
     // Non-writable RO_SPACE must never have marking flag set.
     CHECK(!slim_chunk->IsMarking());
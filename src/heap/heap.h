@@ -95,6 +95,7 @@ class MemoryAllocator;
 class MemoryChunk;
 class MemoryMeasurement;
 class MemoryReducer;
+class PretenuringSampler;
 class MinorMarkCompactCollector;
 class ObjectIterator;
 class ObjectStats;
@@ -111,6 +112,7 @@ class Space;
 class StressScavengeObserver;
 class TimedHistogram;
 class WeakObjectRetainer;
+class YoungGenerationSizeController;
 
 enum ArrayStorageAllocationMode {
   DONT_INITIALIZE_ARRAY_ELEMENTS,
@@ -1085,6 +1087,10 @@ class Heap {
     return incremental_marking_.get();
   }
 
+  // Returns true if writes into young generation objects need to go through
+  // the marking barrier, i.e. during full or young generation marking.
+  bool IsMarkingYoungGeneration() const;
+
   MarkingBarrier* marking_barrier() const { return marking_barrier_.get(); }
 
   // ===========================================================================
@@ -1825,6 +1831,10 @@ class Heap {
 
   void ReduceNewSpaceSize();
 
+  // Resizes new space to the capacity picked by the young generation size
+  // controller (--adaptive-semi-space-sizing).
+  void ResizeNewSpaceAdaptively();
+
   GCIdleTimeHeapState ComputeHeapState();
 
   bool PerformIdleTimeAction(GCIdleTimeAction action,
@@ -1946,6 +1956,10 @@ class Heap {
 
   MemoryReducer* memory_reducer() { return memory_reducer_.get(); }
 
+  PretenuringSampler* pretenuring_sampler() {
+    return pretenuring_sampler_.get();
+  }
+
   // For some webpages RAIL mode does not switch from PERFORMANCE_LOAD.
   // This constant limits the effect of load RAIL mode on GC.
   // The value is arbitrary and chosen as the largest load time observed in
@@ -2291,6 +2305,9 @@ class Heap {
   std::unique_ptr<GCIdleTimeHandler> gc_idle_time_handler_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
+  std::unique_ptr<PretenuringSampler> pretenuring_sampler_;
+  std::unique_ptr<YoungGenerationSizeController>
+      young_generation_size_controller_;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
   std::unique_ptr<ScavengeJob> scavenge_job_;
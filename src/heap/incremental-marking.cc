@@ -251,7 +251,8 @@ void IncrementalMarking::StartMarking() {
 
   SetState(MARKING);
 
-  MarkingBarrier::ActivateAll(heap(), is_compacting_);
+  MarkingBarrier::ActivateAll(heap(), is_compacting_,
+                              MarkingBarrierType::kMajor);
   GlobalHandles::EnableMarkingBarrier(heap()->isolate());
 
   heap_->isolate()->compilation_cache()->MarkCompactPrologue();
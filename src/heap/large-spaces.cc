@@ -502,7 +502,7 @@ AllocationResult NewLargeObjectSpace::AllocateRaw(int object_size) {
   capacity_ = std::max(capacity_, SizeOfObjects());
 
   HeapObject result = page->GetObject();
-  page->SetYoungGenerationPageFlags(heap()->incremental_marking()->IsMarking());
+  page->SetYoungGenerationPageFlags(heap()->IsMarkingYoungGeneration());
   page->SetFlag(MemoryChunk::TO_PAGE);
   UpdatePendingObject(result);
   if (FLAG_minor_mc) {
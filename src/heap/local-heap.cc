@@ -62,8 +62,10 @@ LocalHeap::LocalHeap(Heap* heap, ThreadKind kind,
     if (!is_main_thread()) {
       WriteBarrier::SetForThread(marking_barrier_.get());
       if (heap_->incremental_marking()->IsMarking()) {
-        marking_barrier_->Activate(
-            heap_->incremental_marking()->IsCompacting());
+        marking_barrier_->Activate(heap_->incremental_marking()->IsCompacting(),
+                                   MarkingBarrierType::kMajor);
+      } else if (heap_->minor_mark_compact_collector()->IsMarking()) {
+        marking_barrier_->Activate(false, MarkingBarrierType::kMinor);
       }
     }
   });
@@ -19,6 +19,7 @@
 #include "src/execution/isolate-utils.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
+#include "src/heap/allocation-observer.h"
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/basic-memory-chunk.h"
 #include "src/heap/code-object-registry.h"
@@ -3907,6 +3908,10 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
     }
   }
 
+  if (FLAG_compaction_pause_budget_ms > 0 && !heap()->ShouldReduceMemory()) {
+    LimitEvacuationCandidatesToPauseBudget();
+  }
+
   for (Page* page : old_space_evacuation_pages_) {
     if (page->IsFlagSet(Page::COMPACTION_WAS_ABORTED)) continue;
 
@@ -4707,6 +4712,61 @@ void MarkCompactCollector::ReportAbortedEvacuationCandidateDueToFlags(
       std::make_pair(failed_start, page));
 }
 
+void MarkCompactCollector::LimitEvacuationCandidatesToPauseBudget() {
+  const double compaction_speed =
+      heap()->tracer()->CompactionSpeedInBytesPerMillisecond();
+  // Without samples the cost of evacuation cannot be estimated.
+  if (compaction_speed == 0) return;
+  // The compaction speed is traced per evacuator.
+  const size_t budget =
+      static_cast<size_t>(FLAG_compaction_pause_budget_ms * compaction_speed *
+                          NumberOfParallelCompactionTasks());
+
+  // Candidates were selected before marking based on allocated bytes. Now
+  // that live bytes are known, keep the pages deferred by earlier GCs and then
+  // the ones that are cheapest to evacuate.
+  using LiveBytesPagePair = std::pair<intptr_t, Page*>;
+  std::vector<LiveBytesPagePair> candidates;
+  for (Page* page : old_space_evacuation_pages_) {
+    if (page->IsFlagSet(Page::COMPACTION_WAS_ABORTED)) continue;
+    candidates.emplace_back(non_atomic_marking_state()->live_bytes(page),
+                            page);
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const LiveBytesPagePair& a, const LiveBytesPagePair& b) {
+              const bool a_deferred =
+                  a.second->IsFlagSet(Page::EVACUATION_DEFERRED);
+              const bool b_deferred =
+                  b.second->IsFlagSet(Page::EVACUATION_DEFERRED);
+              if (a_deferred != b_deferred) return a_deferred;
+              return a.first < b.first;
+            });
+
+  size_t live_bytes = 0;
+  size_t deferred_pages = 0;
+  for (size_t i = 0; i < candidates.size(); i++) {
+    Page* page = candidates[i].second;
+    live_bytes += static_cast<size_t>(candidates[i].first);
+    // A page that was deferred before is evacuated even if it alone exceeds
+    // the budget, so that every page is compacted eventually.
+    if (live_bytes <= budget ||
+        (i == 0 && page->IsFlagSet(Page::EVACUATION_DEFERRED))) {
+      continue;
+    }
+    ReportAbortedEvacuationCandidateDueToFlags(page->area_start(), page);
+    page->SetFlag(Page::COMPACTION_WAS_ABORTED);
+    page->SetFlag(Page::EVACUATION_DEFERRED);
+    deferred_pages++;
+  }
+
+  if (FLAG_trace_evacuation && deferred_pages > 0) {
+    PrintIsolate(isolate(),
+                 "evacuation-budget: budget=%zu live_bytes=%zu "
+                 "candidates=%zu deferred=%zu\n",
+                 budget, live_bytes, candidates.size(), deferred_pages);
+  }
+}
+
 namespace {
 
 void ReRecordPage(
@@ -5086,9 +5146,35 @@ class YoungGenerationMarkingVisitor final
   MinorMarkCompactCollector::MarkingState* marking_state_;
 };
 
-void MinorMarkCompactCollector::SetUp() {}
+class MinorMarkCompactCollector::MarkingObserver final
+    : public AllocationObserver {
+ public:
+  MarkingObserver(MinorMarkCompactCollector* collector, intptr_t step_size)
+      : AllocationObserver(step_size), collector_(collector) {}
+
+  void Step(int bytes_allocated, Address, size_t) override {
+    collector_->AdvanceMarkingOnAllocation(bytes_allocated);
+  }
+
+ private:
+  MinorMarkCompactCollector* const collector_;
+};
+
+void MinorMarkCompactCollector::SetUp() {
+  if (FLAG_minor_mc_incremental_marking && heap()->new_space()) {
+    marking_observer_ =
+        std::make_unique<MarkingObserver>(this, kMarkingObserverStepSize);
+    heap()->new_space()->AddAllocationObserver(marking_observer_.get());
+  }
+}
 
-void MinorMarkCompactCollector::TearDown() {}
+void MinorMarkCompactCollector::TearDown() {
+  DCHECK(!is_marking_);
+  if (marking_observer_) {
+    heap()->new_space()->RemoveAllocationObserver(marking_observer_.get());
+    marking_observer_.reset();
+  }
+}
 
 // static
 constexpr size_t MinorMarkCompactCollector::kMaxParallelTasks;
@@ -5554,10 +5640,28 @@ class YoungGenerationMarkingTask {
     }
   }
 
+  // Visits objects from the worklist until either the worklist is empty or
+  // |max_visited_bytes| were visited by this task. Returns true if the
+  // worklist was emptied.
+  bool EmptyMarkingWorklist(size_t max_visited_bytes) {
+    HeapObject object;
+    while (visited_bytes_ < max_visited_bytes) {
+      if (!marking_worklist_local_.Pop(&object)) return true;
+      const int size = visitor_.Visit(object);
+      IncrementLiveBytes(object, size);
+    }
+    return false;
+  }
+
   void IncrementLiveBytes(HeapObject object, intptr_t bytes) {
     local_live_bytes_[Page::FromHeapObject(object)] += bytes;
+    visited_bytes_ += bytes;
   }
 
+  void Publish() { marking_worklist_local_.Publish(); }
+
+  size_t visited_bytes() const { return visited_bytes_; }
+
   void FlushLiveBytes() {
     for (auto pair : local_live_bytes_) {
       marking_state_->IncrementLiveBytes(pair.first, pair.second);
@@ -5569,11 +5673,15 @@ class YoungGenerationMarkingTask {
   MinorMarkCompactCollector::MarkingState* marking_state_;
   YoungGenerationMarkingVisitor visitor_;
   std::unordered_map<Page*, intptr_t, Page::Hasher> local_live_bytes_;
+  size_t visited_bytes_ = 0;
 };
 
 class PageMarkingItem : public ParallelWorkItem {
  public:
-  explicit PageMarkingItem(MemoryChunk* chunk) : chunk_(chunk) {}
+  explicit PageMarkingItem(
+      MemoryChunk* chunk,
+      SlotSet::EmptyBucketMode empty_bucket_mode = SlotSet::FREE_EMPTY_BUCKETS)
+      : chunk_(chunk), empty_bucket_mode_(empty_bucket_mode) {}
   ~PageMarkingItem() = default;
 
   void Process(YoungGenerationMarkingTask* task) {
@@ -5595,7 +5703,7 @@ class PageMarkingItem : public ParallelWorkItem {
           if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
           return CheckAndMarkObject(task, slot);
         },
-        SlotSet::FREE_EMPTY_BUCKETS);
+        empty_bucket_mode_);
     filter = InvalidatedSlotsFilter::OldToNew(chunk_);
     RememberedSetSweeping::Iterate(
         chunk_,
@@ -5603,7 +5711,7 @@ class PageMarkingItem : public ParallelWorkItem {
           if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
           return CheckAndMarkObject(task, slot);
         },
-        SlotSet::FREE_EMPTY_BUCKETS);
+        empty_bucket_mode_);
   }
 
   void MarkTypedPointers(YoungGenerationMarkingTask* task) {
@@ -5639,6 +5747,7 @@ class PageMarkingItem : public ParallelWorkItem {
   }
 
   MemoryChunk* chunk_;
+  const SlotSet::EmptyBucketMode empty_bucket_mode_;
 };
 
 class YoungGenerationMarkingJob : public v8::JobTask {
@@ -5767,11 +5876,142 @@ void MinorMarkCompactCollector::MarkRootSetInParallel(
   }
 }
 
+bool MinorMarkCompactCollector::ShouldStartMarking() const {
+  NewSpace* new_space = heap_->new_space();
+  return new_space->Size() >= new_space->Capacity() *
+                                  FLAG_minor_mc_incremental_marking_trigger /
+                                  100;
+}
+
+void MinorMarkCompactCollector::AdvanceMarkingOnAllocation(
+    size_t bytes_allocated) {
+  DCHECK(FLAG_minor_mc_incremental_marking);
+  if (heap()->gc_state() != Heap::NOT_IN_GC || heap()->always_allocate() ||
+      heap()->IsTearingDown() || !heap()->deserialization_complete()) {
+    return;
+  }
+  // Young generation marking does not run alongside full marking which also
+  // marks through the young generation.
+  if (!heap()->incremental_marking()->IsStopped()) return;
+
+  VMState<GC> state(isolate());
+  if (!is_marking_) {
+    if (ShouldStartMarking()) StartMarking();
+    return;
+  }
+  AdvanceMarking(bytes_allocated * kMarkedBytesPerAllocatedByte);
+}
+
+void MinorMarkCompactCollector::StartMarking() {
+  DCHECK(!is_marking_);
+  DCHECK(heap()->incremental_marking()->IsStopped());
+  TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_INCREMENTAL_START);
+
+  // The array buffer sweeper resets the young generation marks of extensions
+  // that are set while marking.
+  heap()->array_buffer_sweeper()->EnsureFinished();
+
+  base::Optional<SafepointScope> safepoint_scope;
+  {
+    AllowGarbageCollection allow_shared_gc;
+    IgnoreLocalGCRequests ignore_gc_requests(heap());
+    safepoint_scope.emplace(heap());
+  }
+
+  is_marking_ = true;
+  remembered_set_chunks_processed_ = 0;
+  heap()->SetIsMarkingFlag(true);
+  MarkingBarrier::ActivateAll(heap(), false, MarkingBarrierType::kMinor);
+
+  // Roots are only used as a seed here. The stack and handles change too
+  // frequently to be worth visiting and all roots are re-scanned in the
+  // atomic pause anyway.
+  RootMarkingVisitor root_visitor(this);
+  heap()->IterateRoots(
+      &root_visitor,
+      base::EnumSet<SkipRoot>{SkipRoot::kExternalStringTable,
+                              SkipRoot::kGlobalHandles,
+                              SkipRoot::kOldGeneration, SkipRoot::kStack,
+                              SkipRoot::kMainThreadHandles});
+  main_thread_worklist_local_.Publish();
+
+  if (FLAG_trace_minor_mc_incremental_marking) {
+    isolate()->PrintWithTimestamp(
+        "[MinorMC] Start marking: new space size=%zuKB capacity=%zuKB\n",
+        heap()->new_space()->Size() / KB,
+        heap()->new_space()->Capacity() / KB);
+  }
+}
+
+void MinorMarkCompactCollector::AdvanceMarking(size_t bytes_to_process) {
+  DCHECK(is_marking_);
+  TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_INCREMENTAL);
+
+  heap()->marking_barrier()->Publish();
+  YoungGenerationMarkingTask task(isolate(), this, worklist());
+  if (task.EmptyMarkingWorklist(bytes_to_process)) {
+    // Visit old-to-new slots chunk by chunk. Empty buckets are kept as
+    // background threads may insert slots concurrently outside of the pause.
+    size_t index = 0;
+    RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+        heap(), [this, &task, &index, bytes_to_process](MemoryChunk* chunk) {
+          if (index++ < remembered_set_chunks_processed_) return;
+          if (task.visited_bytes() >= bytes_to_process) return;
+          PageMarkingItem item(chunk, SlotSet::KEEP_EMPTY_BUCKETS);
+          item.Process(&task);
+          remembered_set_chunks_processed_++;
+          task.EmptyMarkingWorklist(bytes_to_process);
+        });
+  }
+  task.FlushLiveBytes();
+  task.Publish();
+
+  if (FLAG_trace_minor_mc_incremental_marking) {
+    isolate()->PrintWithTimestamp(
+        "[MinorMC] Marking step: visited=%zuKB remembered_set_chunks=%zu\n",
+        task.visited_bytes() / KB, remembered_set_chunks_processed_);
+  }
+}
+
+void MinorMarkCompactCollector::FinishMarking() {
+  DCHECK(is_marking_);
+  TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_MARK_FINISH_INCREMENTAL);
+  // Objects discovered by the write barrier are left on the global worklist
+  // and are drained together with the re-scanned roots.
+  MarkingBarrier::PublishAll(heap());
+  MarkingBarrier::DeactivateAll(heap());
+  heap()->SetIsMarkingFlag(false);
+  is_marking_ = false;
+}
+
+void MinorMarkCompactCollector::AbortMarking() {
+  DCHECK(is_marking_);
+  heap()->safepoint()->AssertActive();
+  MarkingBarrier::DeactivateAll(heap());
+  heap()->SetIsMarkingFlag(false);
+  is_marking_ = false;
+
+  DCHECK(main_thread_worklist_local_.IsLocalEmpty());
+  worklist()->Clear();
+  for (Page* p : *heap()->new_space()) {
+    non_atomic_marking_state()->ClearLiveness(p);
+  }
+  for (LargePage* p : *heap()->new_lo_space()) {
+    non_atomic_marking_state()->ClearLiveness(p);
+  }
+
+  if (FLAG_trace_minor_mc_incremental_marking) {
+    isolate()->PrintWithTimestamp("[MinorMC] Aborted marking\n");
+  }
+}
+
 void MinorMarkCompactCollector::MarkLiveObjects() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_MARK);
 
   PostponeInterruptsScope postpone(isolate());
 
+  if (is_marking_) FinishMarking();
+
   RootMarkingVisitor root_visitor(this);
 
   MarkRootSetInParallel(&root_visitor);
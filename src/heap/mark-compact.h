@@ -755,6 +755,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
                                                 Page* page);
   void ReportAbortedEvacuationCandidateDueToFlags(Address failed_start,
                                                   Page* page);
+  // Aborts the evacuation candidates that do not fit into
+  // --compaction-pause-budget-ms and marks them EVACUATION_DEFERRED, so that
+  // fragmented pages are compacted a budget's worth per GC.
+  void LimitEvacuationCandidatesToPauseBudget();
 
   static const int kEphemeronChunkSize = 8 * KB;
 
@@ -850,6 +854,8 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
  public:
   using MarkingState = MinorMarkingState;
   using NonAtomicMarkingState = MinorNonAtomicMarkingState;
+  using MarkingWorklist =
+      ::heap::base::Worklist<HeapObject, 64 /* segment size */>;
 
   static constexpr size_t kMaxParallelTasks = 8;
 
@@ -869,15 +875,32 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
   void MakeIterable(Page* page, FreeSpaceTreatmentMode free_space_mode);
   void CleanupPromotedPages();
 
+  // Incremental young generation marking (--minor-mc-incremental-marking).
+  // Marking is started once new space reaches the trigger and is advanced on
+  // allocation. The atomic pause then only re-scans roots and the remembered
+  // set and finishes marking.
+  void StartMarking();
+  void AbortMarking();
+  bool IsMarking() const { return is_marking_; }
+
+  MarkingWorklist* worklist() { return worklist_; }
+
  private:
-  using MarkingWorklist =
-      ::heap::base::Worklist<HeapObject, 64 /* segment size */>;
+  class MarkingObserver;
   class RootMarkingVisitor;
 
   static const int kNumMarkers = 8;
   static const int kMainMarker = 0;
 
-  inline MarkingWorklist* worklist() { return worklist_; }
+  // Allocation step after which incremental marking is started or advanced.
+  static const intptr_t kMarkingObserverStepSize = 64 * KB;
+  // Bytes marked per byte allocated during incremental marking.
+  static const int kMarkedBytesPerAllocatedByte = 2;
+
+  bool ShouldStartMarking() const;
+  void AdvanceMarkingOnAllocation(size_t bytes_allocated);
+  void AdvanceMarking(size_t bytes_to_process);
+  void FinishMarking();
 
   inline YoungGenerationMarkingVisitor* main_marking_visitor() {
     return main_marking_visitor_;
@@ -919,6 +942,12 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
   std::vector<Page*> promoted_pages_;
   std::vector<LargePage*> promoted_large_pages_;
 
+  std::unique_ptr<AllocationObserver> marking_observer_;
+  bool is_marking_ = false;
+  // Number of old-to-new remembered set chunks already visited by
+  // incremental marking steps.
+  size_t remembered_set_chunks_processed_ = 0;
+
   friend class YoungGenerationMarkingTask;
   friend class YoungGenerationMarkingJob;
   friend class YoungGenerationMarkingVisitor;
@@ -15,6 +15,12 @@ namespace internal {
 bool MarkingBarrier::MarkValue(HeapObject host, HeapObject value) {
   DCHECK(IsCurrentMarkingBarrier());
   DCHECK(is_activated_);
+  if (is_minor()) {
+    // Young generation marking does not record slots. Old-to-new slots are
+    // tracked by the generational barrier and re-visited in the atomic pause.
+    MinorMarkValue(value);
+    return false;
+  }
   DCHECK(!marking_state_.IsImpossible(value));
   // Host may have an impossible markbit pattern if manual allocation folding
   // is performed and host happens to be the last word of an allocated region.
@@ -57,6 +63,16 @@ inline void MarkingBarrier::MarkRange(HeapObject host, TSlot start, TSlot end) {
   }
 }
 
+void MarkingBarrier::MinorMarkValue(HeapObject value) {
+  DCHECK(is_minor());
+  if (!Heap::InYoungGeneration(value)) return;
+  // The host color is not checked, i.e. all young values written into young
+  // hosts are marked.
+  if (minor_marking_state_.WhiteToGrey(value)) {
+    minor_worklist_->Push(value);
+  }
+}
+
 bool MarkingBarrier::WhiteToGreyAndPush(HeapObject obj) {
   if (marking_state_.WhiteToGrey(obj)) {
     worklist_.Push(obj);
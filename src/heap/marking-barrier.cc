@@ -28,6 +28,7 @@ MarkingBarrier::MarkingBarrier(Heap* heap)
       incremental_marking_(heap_->incremental_marking()),
       worklist_(collector_->marking_worklists()->shared()),
       marking_state_(heap_->isolate()),
+      minor_marking_state_(heap_->isolate()),
       is_main_thread_barrier_(true),
       is_shared_heap_(heap_->IsShared()) {}
 
@@ -37,10 +38,14 @@ MarkingBarrier::MarkingBarrier(LocalHeap* local_heap)
       incremental_marking_(nullptr),
       worklist_(collector_->marking_worklists()->shared()),
       marking_state_(heap_->isolate()),
+      minor_marking_state_(heap_->isolate()),
       is_main_thread_barrier_(false),
       is_shared_heap_(heap_->IsShared()) {}
 
-MarkingBarrier::~MarkingBarrier() { DCHECK(worklist_.IsLocalEmpty()); }
+MarkingBarrier::~MarkingBarrier() {
+  DCHECK(worklist_.IsLocalEmpty());
+  DCHECK_NULL(minor_worklist_);
+}
 
 void MarkingBarrier::Write(HeapObject host, HeapObjectSlot slot,
                            HeapObject value) {
@@ -54,6 +59,10 @@ void MarkingBarrier::Write(HeapObject host, HeapObjectSlot slot,
 
 void MarkingBarrier::WriteWithoutHost(HeapObject value) {
   DCHECK(is_main_thread_barrier_);
+  if (is_minor()) {
+    MinorMarkValue(value);
+    return;
+  }
   if (WhiteToGreyAndPush(value)) {
     incremental_marking_->RestartIfNotMarking();
 
@@ -81,6 +90,10 @@ void MarkingBarrier::Write(Code host, RelocInfo* reloc_info, HeapObject value) {
 void MarkingBarrier::Write(JSArrayBuffer host,
                            ArrayBufferExtension* extension) {
   DCHECK(IsCurrentMarkingBarrier());
+  if (is_minor()) {
+    if (Heap::InYoungGeneration(host)) extension->YoungMark();
+    return;
+  }
   if (!V8_CONCURRENT_MARKING_BOOL && !marking_state_.IsBlack(host)) {
     // The extension will be marked when the marker visits the host object.
     return;
@@ -92,6 +105,9 @@ void MarkingBarrier::Write(DescriptorArray descriptor_array,
                            int number_of_own_descriptors) {
   DCHECK(IsCurrentMarkingBarrier());
   DCHECK(IsReadOnlyHeapObject(descriptor_array.map()));
+  // Young generation marking visits descriptor arrays strongly and the
+  // descriptors themselves are written with a regular write barrier.
+  if (is_minor()) return;
   // The DescriptorArray needs to be marked black here to ensure that slots are
   // recorded by the Scavenger in case the DescriptorArray is promoted while
   // incremental marking is running. This is needed as the regular marking
@@ -134,11 +150,14 @@ void MarkingBarrier::RecordRelocSlot(Code host, RelocInfo* rinfo,
 }
 
 // static
-void MarkingBarrier::ActivateAll(Heap* heap, bool is_compacting) {
-  heap->marking_barrier()->Activate(is_compacting);
-  heap->safepoint()->IterateLocalHeaps([is_compacting](LocalHeap* local_heap) {
-    local_heap->marking_barrier()->Activate(is_compacting);
-  });
+void MarkingBarrier::ActivateAll(Heap* heap, bool is_compacting,
+                                 MarkingBarrierType marking_barrier_type) {
+  heap->marking_barrier()->Activate(is_compacting, marking_barrier_type);
+  heap->safepoint()->IterateLocalHeaps(
+      [is_compacting, marking_barrier_type](LocalHeap* local_heap) {
+        local_heap->marking_barrier()->Activate(is_compacting,
+                                                marking_barrier_type);
+      });
 }
 
 // static
@@ -157,6 +176,10 @@ void MarkingBarrier::PublishAll(Heap* heap) {
 }
 
 void MarkingBarrier::Publish() {
+  if (is_activated_ && is_minor()) {
+    minor_worklist_->Publish();
+    return;
+  }
   if (is_activated_) {
     worklist_.Publish();
     for (auto& it : typed_slots_map_) {
@@ -190,6 +213,10 @@ void MarkingBarrier::DeactivateSpace(NewSpace* space) {
 }
 
 void MarkingBarrier::Deactivate() {
+  if (is_minor()) {
+    DeactivateMinor();
+    return;
+  }
   is_activated_ = false;
   is_compacting_ = false;
   if (is_main_thread_barrier_) {
@@ -226,9 +253,16 @@ void MarkingBarrier::ActivateSpace(NewSpace* space) {
   }
 }
 
-void MarkingBarrier::Activate(bool is_compacting) {
+void MarkingBarrier::Activate(bool is_compacting,
+                              MarkingBarrierType marking_barrier_type) {
   DCHECK(!is_activated_);
   DCHECK(worklist_.IsLocalEmpty());
+  marking_barrier_type_ = marking_barrier_type;
+  if (is_minor()) {
+    DCHECK(!is_compacting);
+    ActivateMinor();
+    return;
+  }
   is_compacting_ = is_compacting;
   is_activated_ = true;
   if (is_main_thread_barrier_) {
@@ -252,6 +286,38 @@ void MarkingBarrier::Activate(bool is_compacting) {
   }
 }
 
+void MarkingBarrier::ActivateMinor() {
+  DCHECK_NULL(minor_worklist_);
+  minor_worklist_ =
+      std::make_unique<MinorMarkCompactCollector::MarkingWorklist::Local>(
+          heap_->minor_mark_compact_collector()->worklist());
+  is_activated_ = true;
+  if (is_main_thread_barrier_) {
+    // Only writes into young hosts need to be observed. Old-to-new pointers
+    // are covered by the remembered set.
+    ActivateSpace(heap_->new_space());
+    for (LargePage* p : *heap_->new_lo_space()) {
+      p->SetYoungGenerationPageFlags(true);
+      DCHECK(p->IsLargePage());
+    }
+  }
+}
+
+void MarkingBarrier::DeactivateMinor() {
+  DCHECK(is_activated_);
+  is_activated_ = false;
+  marking_barrier_type_ = MarkingBarrierType::kMajor;
+  minor_worklist_->Publish();
+  minor_worklist_.reset();
+  if (is_main_thread_barrier_) {
+    DeactivateSpace(heap_->new_space());
+    for (LargePage* p : *heap_->new_lo_space()) {
+      p->SetYoungGenerationPageFlags(false);
+      DCHECK(p->IsLargePage());
+    }
+  }
+}
+
 bool MarkingBarrier::IsCurrentMarkingBarrier() {
   return WriteBarrier::CurrentMarkingBarrier(heap_) == this;
 }
@@ -18,17 +18,23 @@ class LocalHeap;
 class PagedSpace;
 class NewSpace;
 
+// Full marking barriers mark all values written into marked hosts. Minor
+// marking barriers are used by incremental young generation marking and only
+// mark young generation values.
+enum class MarkingBarrierType { kMinor, kMajor };
+
 class MarkingBarrier {
  public:
   explicit MarkingBarrier(Heap*);
   explicit MarkingBarrier(LocalHeap*);
   ~MarkingBarrier();
 
-  void Activate(bool is_compacting);
+  void Activate(bool is_compacting, MarkingBarrierType marking_barrier_type);
   void Deactivate();
   void Publish();
 
-  static void ActivateAll(Heap* heap, bool is_compacting);
+  static void ActivateAll(Heap* heap, bool is_compacting,
+                          MarkingBarrierType marking_barrier_type);
   static void DeactivateAll(Heap* heap);
   static void PublishAll(Heap* heap);
 
@@ -43,10 +49,16 @@ class MarkingBarrier {
   // Returns true if the slot needs to be recorded.
   inline bool MarkValue(HeapObject host, HeapObject value);
 
+  bool is_minor() const {
+    return marking_barrier_type_ == MarkingBarrierType::kMinor;
+  }
+
  private:
   using MarkingState = MarkCompactCollector::MarkingState;
+  using MinorMarkingState = MinorMarkCompactCollector::MarkingState;
 
   inline bool WhiteToGreyAndPush(HeapObject value);
+  inline void MinorMarkValue(HeapObject value);
 
   void RecordRelocSlot(Code host, RelocInfo* rinfo, HeapObject target);
 
@@ -56,6 +68,9 @@ class MarkingBarrier {
   void DeactivateSpace(PagedSpace*);
   void DeactivateSpace(NewSpace*);
 
+  void ActivateMinor();
+  void DeactivateMinor();
+
   bool IsCurrentMarkingBarrier();
 
   template <typename TSlot>
@@ -66,11 +81,16 @@ class MarkingBarrier {
   IncrementalMarking* incremental_marking_;
   MarkingWorklist::Local worklist_;
   MarkingState marking_state_;
+  // Only set while a minor marking barrier is activated.
+  std::unique_ptr<MinorMarkCompactCollector::MarkingWorklist::Local>
+      minor_worklist_;
+  MinorMarkingState minor_marking_state_;
   std::unordered_map<MemoryChunk*, std::unique_ptr<TypedSlots>,
                      MemoryChunk::Hasher>
       typed_slots_map_;
   bool is_compacting_ = false;
   bool is_activated_ = false;
+  MarkingBarrierType marking_barrier_type_ = MarkingBarrierType::kMajor;
   bool is_main_thread_barrier_;
   bool is_shared_heap_;
 };
@@ -7,6 +7,7 @@
 #include <cinttypes>
 
 #include "src/base/address-region.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -167,6 +168,14 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks(
       allocator_->FreePooledChunk(chunk);
       if (delegate && delegate->ShouldYield()) return;
     }
+    for (ChunkQueueType type :
+         {kCommittedPooled, kCommittedPooledExecutable}) {
+      while ((chunk = GetMemoryChunkSafe(type)) != nullptr) {
+        chunk->ClearFlag(MemoryChunk::POOLED_COMMITTED);
+        allocator_->PerformFreeMemory(chunk);
+        if (delegate && delegate->ShouldYield()) return;
+      }
+    }
   }
   PerformFreeMemoryOnQueuedNonRegularChunks();
 }
@@ -205,9 +214,28 @@ size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
   for (auto& chunk : chunks_[kNonRegular]) {
     sum += chunk->size();
   }
+  for (auto& chunk : chunks_[kCommittedPooled]) {
+    sum += chunk->size();
+  }
+  for (auto& chunk : chunks_[kCommittedPooledExecutable]) {
+    sum += chunk->size();
+  }
   return sum;
 }
 
+bool MemoryAllocator::Unmapper::CanPoolCommittedChunk() {
+  base::MutexGuard guard(&mutex_);
+  return chunks_[kCommittedPooled].size() +
+             chunks_[kCommittedPooledExecutable].size() <
+         kMaxCommittedPooledChunks;
+}
+
+// static
+bool MemoryAllocator::UsesHugePages(AllocationSpace space) {
+  return FLAG_huge_pages_for_old_and_code_space &&
+         (space == OLD_SPACE || space == CODE_SPACE);
+}
+
 bool MemoryAllocator::CommitMemory(VirtualMemory* reservation) {
   Address base = reservation->address();
   size_t size = reservation->size();
@@ -533,6 +561,12 @@ void MemoryAllocator::Free(MemoryAllocator::FreeMode mode, MemoryChunk* chunk) {
       chunk->SetFlag(MemoryChunk::POOLED);
       V8_FALLTHROUGH;
     case kConcurrently:
+      if (!chunk->IsFlagSet(MemoryChunk::POOLED) && chunk->owner() &&
+          UsesHugePages(chunk->owner()->identity()) && !chunk->IsLargePage() &&
+          chunk->size() == static_cast<size_t>(MemoryChunk::kPageSize) &&
+          unmapper()->CanPoolCommittedChunk()) {
+        chunk->SetFlag(MemoryChunk::POOLED_COMMITTED);
+      }
       PreFreeMemory(chunk);
       // The chunks added to this queue will be freed by a concurrent thread.
       unmapper()->AddMemoryChunkSafe(chunk);
@@ -555,11 +589,20 @@ Page* MemoryAllocator::AllocatePage(MemoryAllocator::AllocationMode alloc_mode,
     DCHECK_EQ(size, static_cast<size_t>(
                         MemoryChunkLayout::AllocatableMemoryInMemoryChunk(
                             owner->identity())));
-    DCHECK_EQ(executable, NOT_EXECUTABLE);
-    chunk = AllocatePagePooled(owner);
+    if (UsesHugePages(owner->identity())) {
+      chunk = AllocatePageFromCommittedPool(owner, executable);
+    } else {
+      DCHECK_EQ(executable, NOT_EXECUTABLE);
+      chunk = AllocatePagePooled(owner);
+    }
   }
   if (chunk == nullptr) {
     chunk = AllocateChunk(size, size, executable, owner);
+    if (chunk != nullptr && UsesHugePages(owner->identity())) {
+      // This is advisory; the page is still usable without huge pages.
+      USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(chunk->address()),
+                                    chunk->size()));
+    }
   }
   if (chunk == nullptr) return nullptr;
   return owner->InitializePage(chunk);
@@ -611,6 +654,49 @@ MemoryChunk* MemoryAllocator::AllocatePagePooled(Space* owner) {
   return chunk;
 }
 
+MemoryChunk* MemoryAllocator::AllocatePageFromCommittedPool(
+    Space* owner, Executability executable) {
+  MemoryChunk* chunk =
+      unmapper()->TryGetCommittedPooledMemoryChunkSafe(executable);
+  if (chunk == nullptr) return nullptr;
+  const size_t size = MemoryChunk::kPageSize;
+  const Address start = chunk->address();
+  const size_t area_size =
+      MemoryChunkLayout::AllocatableMemoryInMemoryChunk(owner->identity());
+  const Address area_start =
+      start +
+      MemoryChunkLayout::ObjectStartOffsetInMemoryChunk(owner->identity());
+  const Address area_end = area_start + area_size;
+  VirtualMemory reservation(page_allocator(executable), start, size);
+  if (executable == EXECUTABLE) {
+    // Code pages may have been write-protected while in use. Restore the
+    // permissions of a freshly allocated code page. The pages keep their
+    // mapping, so this does not split the huge page backing them.
+    const size_t commit_size =
+        ::RoundUp(MemoryChunkLayout::CodePageGuardStartOffset() + area_size,
+                  GetCommitPageSize());
+    if (!CommitExecutableMemory(&reservation, start, commit_size, size)) {
+      reservation.Free();
+      return nullptr;
+    }
+    size_executable_ += size;
+  } else {
+    UpdateAllocatedSpaceLimits(start, start + size);
+  }
+  if (Heap::ShouldZapGarbage()) {
+    ZapBlock(area_start, area_size, kZapValue);
+  }
+  BasicMemoryChunk* basic_chunk =
+      BasicMemoryChunk::Initialize(isolate_->heap(), start, size, area_start,
+                                   area_end, owner, std::move(reservation));
+  MemoryChunk::Initialize(basic_chunk, isolate_->heap(), executable);
+  size_ += size;
+#ifdef DEBUG
+  if (executable == EXECUTABLE) RegisterExecutableMemoryChunk(chunk);
+#endif  // DEBUG
+  return chunk;
+}
+
 void MemoryAllocator::ZapBlock(Address start, size_t size,
                                uintptr_t zap_value) {
   DCHECK(IsAligned(start, kTaggedSize));
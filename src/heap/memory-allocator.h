@@ -49,7 +49,12 @@ class MemoryAllocator {
     }
 
     void AddMemoryChunkSafe(MemoryChunk* chunk) {
-      if (!chunk->IsLargePage() && chunk->executable() != EXECUTABLE) {
+      if (chunk->IsFlagSet(MemoryChunk::POOLED_COMMITTED)) {
+        AddMemoryChunkSafe(chunk->executable() == EXECUTABLE
+                               ? kCommittedPooledExecutable
+                               : kCommittedPooled,
+                           chunk);
+      } else if (!chunk->IsLargePage() && chunk->executable() != EXECUTABLE) {
         AddMemoryChunkSafe(kRegular, chunk);
       } else {
         AddMemoryChunkSafe(kNonRegular, chunk);
@@ -73,6 +78,18 @@ class MemoryAllocator {
       return chunk;
     }
 
+    // Returns a chunk that was pooled without being uncommitted, see
+    // MemoryAllocator::UsesHugePages().
+    MemoryChunk* TryGetCommittedPooledMemoryChunkSafe(
+        Executability executable) {
+      MemoryChunk* chunk =
+          GetMemoryChunkSafe(executable == EXECUTABLE
+                                 ? kCommittedPooledExecutable
+                                 : kCommittedPooled);
+      if (chunk != nullptr) chunk->ReleaseAllAllocatedMemory();
+      return chunk;
+    }
+
     V8_EXPORT_PRIVATE void FreeQueuedChunks();
     void CancelAndWaitForPendingTasks();
     void PrepareForGC();
@@ -81,16 +98,24 @@ class MemoryAllocator {
     size_t NumberOfCommittedChunks();
     V8_EXPORT_PRIVATE int NumberOfChunks();
     size_t CommittedBufferedMemory();
+    bool CanPoolCommittedChunk();
 
    private:
     static const int kReservedQueueingSlots = 64;
     static const int kMaxUnmapperTasks = 4;
+    // Upper bound on the chunks kept committed in the pool. Corresponds to
+    // 16 huge pages.
+    static const size_t kMaxCommittedPooledChunks =
+        16 * 2 * MB / MemoryChunk::kPageSize;
 
     enum ChunkQueueType {
       kRegular,     // Pages of kPageSize that do not live in a CodeRange and
                     // can thus be used for stealing.
       kNonRegular,  // Large chunks and executable chunks.
       kPooled,      // Pooled chunks, already freed and ready for reuse.
+      kCommittedPooled,            // Old space chunks that were pooled
+                                   // without uncommitting them.
+      kCommittedPooledExecutable,  // Same for code space chunks.
       kNumberOfChunkQueues,
     };
 
@@ -169,7 +194,8 @@ class MemoryAllocator {
 
   // Allocates a Page from the allocator. AllocationMode is used to indicate
   // whether pooled allocation, which only works for MemoryChunk::kPageSize,
-  // should be tried first.
+  // should be tried first. Pooled code pages are only available if
+  // UsesHugePages(CODE_SPACE) holds.
   V8_EXPORT_PRIVATE Page* AllocatePage(
       MemoryAllocator::AllocationMode alloc_mode, size_t size, Space* owner,
       Executability executable);
@@ -186,6 +212,11 @@ class MemoryAllocator {
                               MemoryChunk* chunk);
   void FreeReadOnlyPage(ReadOnlyPage* chunk);
 
+  // Returns whether pages of |space| are backed by transparent huge pages. Such
+  // pages are pooled without being uncommitted when they are freed, as
+  // uncommitting a single page would split the huge page containing it.
+  static bool UsesHugePages(AllocationSpace space);
+
   // Returns allocated spaces in bytes.
   size_t Size() const { return size_; }
 
@@ -294,6 +325,11 @@ class MemoryAllocator {
   // support pools for NOT_EXECUTABLE pages of size MemoryChunk::kPageSize.
   MemoryChunk* AllocatePagePooled(Space* owner);
 
+  // Takes a page of |owner| from the pool of committed pages. See
+  // UsesHugePages().
+  MemoryChunk* AllocatePageFromCommittedPool(Space* owner,
+                                             Executability executable);
+
   // Frees a pooled page. Only used on tear-down and last-resort GCs.
   void FreePooledChunk(MemoryChunk* chunk);
 
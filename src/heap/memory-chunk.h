@@ -97,6 +97,15 @@ class MemoryChunk : public BasicMemoryChunk {
     return concurrent_sweeping_ == ConcurrentSweepingState::kDone;
   }
 
+  // Transitions the page from kPending to kInProgress. Returns false if the
+  // page was already claimed by another sweeper.
+  bool TryStartSweeping() {
+    ConcurrentSweepingState expected = ConcurrentSweepingState::kPending;
+    return concurrent_sweeping_.compare_exchange_strong(
+        expected, ConcurrentSweepingState::kInProgress,
+        std::memory_order_acq_rel);
+  }
+
   template <RememberedSetType type>
   bool ContainsSlots() {
     return slot_set<type>() != nullptr || typed_slot_set<type>() != nullptr ||
@@ -8,7 +8,9 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/memory-allocator.h"
 #include "src/init/v8.h"
+#include "src/logging/counters.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -20,6 +22,9 @@ const int MemoryReducer::kWatchdogDelayMs = 100000;
 const int MemoryReducer::kMaxNumberOfGCs = 3;
 const double MemoryReducer::kCommittedMemoryFactor = 1.1;
 const size_t MemoryReducer::kCommittedMemoryDelta = 10 * MB;
+const double MemoryReducer::kBudgetSoftLimitFactor = 0.9;
+const int MemoryReducer::kBudgetIdleWaitMs = 2000;
+const int MemoryReducer::kBudgetTimerDelayMs = 1000;
 
 MemoryReducer::MemoryReducer(Heap* heap)
     : heap_(heap),
@@ -219,7 +224,134 @@ void MemoryReducer::ScheduleTimer(double delay_ms) {
                                (delay_ms + kSlackMs) / 1000.0);
 }
 
-void MemoryReducer::TearDown() { state_ = State(kDone, 0, 0, 0.0, 0); }
+MemoryReducer::BudgetTimerTask::BudgetTimerTask(MemoryReducer* memory_reducer)
+    : CancelableTask(memory_reducer->heap()->isolate()),
+      memory_reducer_(memory_reducer) {}
+
+void MemoryReducer::BudgetTimerTask::RunInternal() {
+  memory_reducer_->budget_timer_scheduled_ = false;
+  memory_reducer_->CheckMemoryBudget(false);
+}
+
+void MemoryReducer::SetMemoryBudget(size_t budget_in_bytes) {
+  // Account the time until now against the old budget.
+  double time_ms = heap()->MonotonicallyIncreasingTimeInMs();
+  AccountTimeOverBudget(time_ms, false);
+  memory_budget_ = budget_in_bytes;
+  committed_after_last_gc_ = 0;
+  above_soft_limit_since_ms_ = 0.0;
+  CheckMemoryBudget(false);
+}
+
+void MemoryReducer::NotifyIdleWindow(double deadline_ms) {
+  if (memory_budget_ == 0) return;
+  if (deadline_ms <= heap()->MonotonicallyIncreasingTimeInMs()) return;
+  // Incremental marking started here is advanced by the idle time handler in
+  // the same idle notification.
+  CheckMemoryBudget(true);
+}
+
+void MemoryReducer::NotifyGarbageCollection(GarbageCollector collector) {
+  if (memory_budget_ == 0) return;
+  if (collector == GarbageCollector::MARK_COMPACTOR) {
+    if (BudgetedMemory() > memory_budget_) {
+      // Pooled pages stay committed or mapped for reuse. Give them back if
+      // that is what keeps us above the budget.
+      heap()->memory_allocator()->unmapper()->EnsureUnmappingCompleted();
+    }
+    committed_after_last_gc_ = BudgetedMemory();
+    // Starting marking right after a full GC could lead to a loop of full
+    // GCs, so only the accounting is updated.
+    double time_ms = heap()->MonotonicallyIncreasingTimeInMs();
+    AccountTimeOverBudget(time_ms, committed_after_last_gc_ > memory_budget_);
+    if (committed_after_last_gc_ < memory_budget_ * kBudgetSoftLimitFactor) {
+      above_soft_limit_since_ms_ = 0.0;
+    }
+    return;
+  }
+  CheckMemoryBudget(false);
+}
+
+size_t MemoryReducer::BudgetedMemory() {
+  return heap()->CommittedMemory() + heap()->CommittedMemoryOfUnmapper();
+}
+
+// static
+MemoryReducer::BudgetAction MemoryReducer::ComputeBudgetAction(
+    size_t budget, size_t committed, size_t committed_after_last_gc,
+    bool in_idle_window, double ms_above_soft_limit) {
+  if (budget == 0) return BudgetAction::kNone;
+  if (committed < budget * kBudgetSoftLimitFactor) return BudgetAction::kNone;
+  // A GC only helps if there is potential garbage, i.e. the heap grew since
+  // the last full GC.
+  if (committed_after_last_gc > 0 &&
+      committed < std::max(static_cast<size_t>(committed_after_last_gc *
+                                               kCommittedMemoryFactor),
+                           committed_after_last_gc + kCommittedMemoryDelta)) {
+    return BudgetAction::kNone;
+  }
+  if (committed >= budget || in_idle_window ||
+      ms_above_soft_limit >= kBudgetIdleWaitMs) {
+    return BudgetAction::kStartGC;
+  }
+  return BudgetAction::kNone;
+}
+
+void MemoryReducer::CheckMemoryBudget(bool in_idle_window) {
+  if (memory_budget_ == 0 || heap()->IsTearingDown()) return;
+  double time_ms = heap()->MonotonicallyIncreasingTimeInMs();
+  size_t committed = BudgetedMemory();
+  AccountTimeOverBudget(time_ms, committed > memory_budget_);
+  if (committed < memory_budget_ * kBudgetSoftLimitFactor) {
+    above_soft_limit_since_ms_ = 0.0;
+    return;
+  }
+  if (above_soft_limit_since_ms_ == 0.0) above_soft_limit_since_ms_ = time_ms;
+  // Keep accounting and retrying while above the soft limit, even if the
+  // mutator does not allocate.
+  ScheduleBudgetTimer();
+  if (!FLAG_incremental_marking || !heap()->deserialization_complete() ||
+      !heap()->incremental_marking()->IsStopped() ||
+      !heap()->incremental_marking()->CanBeActivated()) {
+    return;
+  }
+  BudgetAction action = ComputeBudgetAction(
+      memory_budget_, committed, committed_after_last_gc_, in_idle_window,
+      time_ms - above_soft_limit_since_ms_);
+  if (action != BudgetAction::kStartGC) return;
+  if (FLAG_trace_gc_verbose) {
+    heap()->isolate()->PrintWithTimestamp(
+        "Memory reducer: %zu KB committed, budget %zu KB, starting GC%s\n",
+        committed / KB, memory_budget_ / KB,
+        in_idle_window ? " in idle time" : "");
+  }
+  heap()->isolate()->counters()->memory_budget_gcs()->Increment();
+  heap()->StartIdleIncrementalMarking(GarbageCollectionReason::kMemoryReducer,
+                                      kGCCallbackFlagCollectAllExternalMemory);
+}
+
+void MemoryReducer::AccountTimeOverBudget(double time_ms, bool over_budget) {
+  if (over_budget_) {
+    int reported_ms = static_cast<int>(time_over_budget_ms_);
+    time_over_budget_ms_ += time_ms - last_budget_check_ms_;
+    heap()->isolate()->counters()->memory_budget_exceeded_ms()->Increment(
+        static_cast<int>(time_over_budget_ms_) - reported_ms);
+  }
+  over_budget_ = over_budget;
+  last_budget_check_ms_ = time_ms;
+}
+
+void MemoryReducer::ScheduleBudgetTimer() {
+  if (budget_timer_scheduled_ || heap()->IsTearingDown()) return;
+  budget_timer_scheduled_ = true;
+  taskrunner_->PostDelayedTask(std::make_unique<BudgetTimerTask>(this),
+                               kBudgetTimerDelayMs / 1000.0);
+}
+
+void MemoryReducer::TearDown() {
+  state_ = State(kDone, 0, 0, 0.0, 0);
+  memory_budget_ = 0;
+}
 
 }  // namespace internal
 }  // namespace v8
@@ -84,10 +84,26 @@ class Heap;
 // now_ms is the current time,
 // t' is t if the current event is not a GC event and is now_ms otherwise,
 // long_delay_ms, short_delay_ms, and watchdog_delay_ms are constants.
+//
+// Independently of the automaton, the embedder can set a memory budget with
+// Isolate::SetMemoryBudget. The MemoryReducer then compares the memory
+// committed by the heap with the budget after every GC, in idle
+// notifications, and in a budget timer that runs while the heap is above
+// kBudgetSoftLimitFactor of the budget:
+// - Above the soft limit, memory reducing incremental marking is started in
+//   the next idle notification, or after kBudgetIdleWaitMs if no idle
+//   notification arrives.
+// - Above the budget, it is started right away and pooled pages are released
+//   after full GCs.
+// Marking is only started if committed memory grew noticeably since the last
+// full GC, which avoids back-to-back GCs when the live heap itself exceeds the
+// budget.
 class V8_EXPORT_PRIVATE MemoryReducer {
  public:
   enum Action { kDone, kWait, kRun };
 
+  enum class BudgetAction { kNone, kStartGC };
+
   struct State {
     State(Action action, int started_gcs, double next_gc_start_ms,
           double last_gc_time_ms, size_t committed_memory_at_last_run)
@@ -124,6 +140,24 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   // The step function that computes the next state from the current state and
   // the incoming event.
   static State Step(const State& state, const Event& event);
+
+  // Memory budget mode, see the class comment. A budget of 0 disables it.
+  void SetMemoryBudget(size_t budget_in_bytes);
+  size_t memory_budget() const { return memory_budget_; }
+  // Called on idle notifications with a deadline in the future.
+  void NotifyIdleWindow(double deadline_ms);
+  // Called at the end of every GC.
+  void NotifyGarbageCollection(GarbageCollector collector);
+  // Time the heap was known to be above the budget.
+  double time_over_budget_ms() const { return time_over_budget_ms_; }
+  // Decides whether to start a GC for the budget. |committed_after_last_gc|
+  // is the committed memory at the end of the last full GC, or 0 if there was
+  // none since the budget was set. |ms_above_soft_limit| is the time since
+  // the heap exceeded the soft limit.
+  static BudgetAction ComputeBudgetAction(size_t budget, size_t committed,
+                                          size_t committed_after_last_gc,
+                                          bool in_idle_window,
+                                          double ms_above_soft_limit);
   // Posts a timer task that will call NotifyTimer after the given delay.
   void ScheduleTimer(double delay_ms);
   void TearDown();
@@ -137,6 +171,13 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   // The committed memory has to increase by at least this amount since the
   // last run in order to trigger a new run after mark-compact.
   static const size_t kCommittedMemoryDelta;
+  // Fraction of the memory budget above which budget GCs are started in idle
+  // time.
+  static const double kBudgetSoftLimitFactor;
+  // Time a budget GC waits for an idle notification above the soft limit.
+  static const int kBudgetIdleWaitMs;
+  // Period of the budget timer.
+  static const int kBudgetTimerDelayMs;
 
   Heap* heap() { return heap_; }
 
@@ -157,16 +198,42 @@ class V8_EXPORT_PRIVATE MemoryReducer {
     MemoryReducer* memory_reducer_;
   };
 
+  class BudgetTimerTask : public v8::internal::CancelableTask {
+   public:
+    explicit BudgetTimerTask(MemoryReducer* memory_reducer);
+    BudgetTimerTask(const BudgetTimerTask&) = delete;
+    BudgetTimerTask& operator=(const BudgetTimerTask&) = delete;
+
+   private:
+    // v8::internal::CancelableTask overrides.
+    void RunInternal() override;
+    MemoryReducer* memory_reducer_;
+  };
+
   void NotifyTimer(const Event& event);
 
   static bool WatchdogGC(const State& state, const Event& event);
 
+  size_t BudgetedMemory();
+  void CheckMemoryBudget(bool in_idle_window);
+  void AccountTimeOverBudget(double time_ms, bool over_budget);
+  void ScheduleBudgetTimer();
+
   Heap* heap_;
   std::shared_ptr<v8::TaskRunner> taskrunner_;
   State state_;
   unsigned int js_calls_counter_;
   double js_calls_sample_time_ms_;
 
+  size_t memory_budget_ = 0;
+  size_t committed_after_last_gc_ = 0;
+  // Time the heap was first seen above the soft limit, 0 if it is below.
+  double above_soft_limit_since_ms_ = 0.0;
+  bool over_budget_ = false;
+  double last_budget_check_ms_ = 0.0;
+  double time_over_budget_ms_ = 0.0;
+  bool budget_timer_scheduled_ = false;
+
   // Used in cctest.
   friend class heap::HeapTester;
 };
@@ -22,7 +22,7 @@ Page* SemiSpace::InitializePage(MemoryChunk* chunk) {
   bool in_to_space = (id() != kFromSpace);
   chunk->SetFlag(in_to_space ? MemoryChunk::TO_PAGE : MemoryChunk::FROM_PAGE);
   Page* page = static_cast<Page*>(chunk);
-  page->SetYoungGenerationPageFlags(heap()->incremental_marking()->IsMarking());
+  page->SetYoungGenerationPageFlags(heap()->IsMarkingYoungGeneration());
   page->list_node().Initialize();
   if (FLAG_minor_mc) {
     page->AllocateYoungGenerationBitmap();
@@ -327,7 +327,7 @@ void SemiSpace::Verify() {
     if (!is_from_space) {
       // The pointers-from-here-are-interesting flag isn't updated dynamically
       // on from-space pages, so it might be out of sync with the marking state.
-      if (page->heap()->incremental_marking()->IsMarking()) {
+      if (page->heap()->IsMarkingYoungGeneration()) {
         CHECK(page->IsFlagSet(MemoryChunk::POINTERS_FROM_HERE_ARE_INTERESTING));
       } else {
         CHECK(
@@ -428,12 +428,18 @@ void NewSpace::ResetParkedAllocationBuffers() {
 void NewSpace::Flip() { SemiSpace::Swap(&from_space_, &to_space_); }
 
 void NewSpace::Grow() {
-  heap()->safepoint()->AssertActive();
   // Double the semispace size but only up to maximum capacity.
   DCHECK(TotalCapacity() < MaximumCapacity());
-  size_t new_capacity = std::min(
+  GrowTo(std::min(
       MaximumCapacity(),
-      static_cast<size_t>(FLAG_semi_space_growth_factor) * TotalCapacity());
+      static_cast<size_t>(FLAG_semi_space_growth_factor) * TotalCapacity()));
+}
+
+void NewSpace::GrowTo(size_t new_capacity) {
+  heap()->safepoint()->AssertActive();
+  DCHECK_LE(new_capacity, MaximumCapacity());
+  DCHECK_GT(new_capacity, TotalCapacity());
+  DCHECK(IsAligned(new_capacity, Page::kPageSize));
   if (to_space_.GrowTo(new_capacity)) {
     // Only grow from space if we managed to grow to-space.
     if (!from_space_.GrowTo(new_capacity)) {
@@ -445,8 +451,11 @@ void NewSpace::Grow() {
   DCHECK_SEMISPACE_ALLOCATION_INFO(allocation_info_, to_space_);
 }
 
-void NewSpace::Shrink() {
-  size_t new_capacity = std::max(InitialTotalCapacity(), 2 * Size());
+void NewSpace::Shrink() { ShrinkTo(InitialTotalCapacity()); }
+
+void NewSpace::ShrinkTo(size_t new_capacity) {
+  // Never shrink below twice the currently allocated size.
+  new_capacity = std::max(new_capacity, 2 * Size());
   size_t rounded_new_capacity = ::RoundUp(new_capacity, Page::kPageSize);
   if (rounded_new_capacity < TotalCapacity()) {
     to_space_.ShrinkTo(rounded_new_capacity);
@@ -261,9 +261,17 @@ class V8_EXPORT_PRIVATE NewSpace
   // their maximum capacity.
   void Grow();
 
+  // Grow the capacity of the semispaces to |new_capacity|, which must be
+  // page aligned and at most the maximum capacity.
+  void GrowTo(size_t new_capacity);
+
   // Shrink the capacity of the semispaces.
   void Shrink();
 
+  // Shrink the capacity of the semispaces towards |new_capacity|, keeping at
+  // least twice the currently allocated size.
+  void ShrinkTo(size_t new_capacity);
+
   // Return the allocated bytes in the active semispace.
   size_t Size() final {
     DCHECK_GE(top(), to_space_.page_low());
@@ -15,6 +15,7 @@
 #include "src/heap/memory-chunk-inl.h"
 #include "src/heap/paged-spaces-inl.h"
 #include "src/heap/read-only-heap.h"
+#include "src/heap/sweeper.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/string.h"
 #include "src/utils/utils.h"
@@ -116,47 +117,55 @@ void PagedSpace::RefillFreeList() {
     return;
   }
   MarkCompactCollector* collector = heap()->mark_compact_collector();
-  size_t added = 0;
 
-  {
-    Page* p = nullptr;
-    while ((p = collector->sweeper()->GetSweptPageSafe(this)) != nullptr) {
-      // We regularly sweep NEVER_ALLOCATE_ON_PAGE pages. We drop the freelist
-      // entries here to make them unavailable for allocations.
-      if (p->IsFlagSet(Page::NEVER_ALLOCATE_ON_PAGE)) {
-        p->ForAllFreeListCategories([this](FreeListCategory* category) {
-          category->Reset(free_list());
-        });
-      }
+  if (!is_compaction_space()) {
+    // Take all swept pages at once and relink their free list categories
+    // under a single acquisition of the space mutex.
+    Sweeper::SweptList swept_pages;
+    collector->sweeper()->GetSweptPagesSafe(this, &swept_pages);
+    if (swept_pages.empty()) return;
+    for (Page* p : swept_pages) PrepareSweptPageForRefill(p);
+    base::MutexGuard guard(mutex());
+    for (Page* p : swept_pages) {
+      DCHECK_EQ(this, p->owner());
+      RefineAllocatedBytesAfterSweeping(p);
+      RelinkFreeListCategories(p);
+    }
+    return;
+  }
 
-      // Also merge old-to-new remembered sets if not scavenging because of
-      // data races: One thread might iterate remembered set, while another
-      // thread merges them.
-      if (compaction_space_kind() !=
-          CompactionSpaceKind::kCompactionSpaceForScavenge) {
-        p->MergeOldToNewRememberedSets();
-      }
+  size_t added = 0;
+  Page* p = nullptr;
+  while ((p = collector->sweeper()->GetSweptPageSafe(this)) != nullptr) {
+    PrepareSweptPageForRefill(p);
+    // Only during compaction pages can actually change ownership. This is
+    // safe because there exists no other competing action on the page links
+    // during compaction.
+    DCHECK_NE(this, p->owner());
+    PagedSpace* owner = reinterpret_cast<PagedSpace*>(p->owner());
+    base::MutexGuard guard(owner->mutex());
+    owner->RefineAllocatedBytesAfterSweeping(p);
+    owner->RemovePage(p);
+    added += AddPage(p);
+    added += p->wasted_memory();
+    if (added > kCompactionMemoryWanted) break;
+  }
+}
 
-      // Only during compaction pages can actually change ownership. This is
-      // safe because there exists no other competing action on the page links
-      // during compaction.
-      if (is_compaction_space()) {
-        DCHECK_NE(this, p->owner());
-        PagedSpace* owner = reinterpret_cast<PagedSpace*>(p->owner());
-        base::MutexGuard guard(owner->mutex());
-        owner->RefineAllocatedBytesAfterSweeping(p);
-        owner->RemovePage(p);
-        added += AddPage(p);
-        added += p->wasted_memory();
-      } else {
-        base::MutexGuard guard(mutex());
-        DCHECK_EQ(this, p->owner());
-        RefineAllocatedBytesAfterSweeping(p);
-        added += RelinkFreeListCategories(p);
-        added += p->wasted_memory();
-      }
-      if (is_compaction_space() && (added > kCompactionMemoryWanted)) break;
-    }
+void PagedSpace::PrepareSweptPageForRefill(Page* p) {
+  // We regularly sweep NEVER_ALLOCATE_ON_PAGE pages. We drop the freelist
+  // entries here to make them unavailable for allocations.
+  if (p->IsFlagSet(Page::NEVER_ALLOCATE_ON_PAGE)) {
+    p->ForAllFreeListCategories(
+        [this](FreeListCategory* category) { category->Reset(free_list()); });
+  }
+
+  // Also merge old-to-new remembered sets if not scavenging because of
+  // data races: One thread might iterate remembered set, while another
+  // thread merges them.
+  if (compaction_space_kind() !=
+      CompactionSpaceKind::kCompactionSpaceForScavenge) {
+    p->MergeOldToNewRememberedSets();
   }
 }
 
@@ -319,8 +328,11 @@ void PagedSpace::ShrinkImmortalImmovablePages() {
 }
 
 Page* PagedSpace::AllocatePage() {
-  return heap()->memory_allocator()->AllocatePage(
-      MemoryAllocator::kRegular, AreaSize(), this, executable());
+  MemoryAllocator::AllocationMode mode =
+      MemoryAllocator::UsesHugePages(identity()) ? MemoryAllocator::kUsePool
+                                                 : MemoryAllocator::kRegular;
+  return heap()->memory_allocator()->AllocatePage(mode, AreaSize(), this,
+                                                  executable());
 }
 
 Page* PagedSpace::Expand() {
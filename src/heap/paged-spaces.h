@@ -363,6 +363,10 @@ class V8_EXPORT_PRIVATE PagedSpace
   // sweeping is only allowed on the main thread.
   bool IsSweepingAllowedOnThread(LocalHeap* local_heap);
 
+  // Drops the free list of never-allocate pages and merges remembered sets of
+  // a page taken from the sweeper before its free list is relinked.
+  void PrepareSweptPageForRefill(Page* p);
+
   // Cleans up the space, frees all pages in this space except those belonging
   // to the initial chunk, uncommits addresses in the initial chunk.
   void TearDown();
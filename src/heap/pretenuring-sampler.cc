@@ -0,0 +1,155 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/pretenuring-sampler.h"
+
+#include "src/execution/isolate.h"
+#include "src/handles/global-handles-inl.h"
+#include "src/heap/allocation-observer.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/new-spaces.h"
+#include "src/logging/counters.h"
+
+namespace v8 {
+namespace internal {
+
+class PretenuringSampler::Observer final : public AllocationObserver {
+ public:
+  Observer(PretenuringSampler* sampler, intptr_t step_size)
+      : AllocationObserver(step_size), sampler_(sampler) {}
+
+  void Step(int bytes_allocated, Address soon_object, size_t size) override {
+    if (soon_object == kNullAddress) return;
+    if (sampler_->current_site_ == RuntimeAllocationSite::kNone) return;
+    sampler_->SampleObject(soon_object);
+  }
+
+ private:
+  PretenuringSampler* const sampler_;
+};
+
+PretenuringSampler::PretenuringSampler(Heap* heap) : heap_(heap) {}
+
+PretenuringSampler::~PretenuringSampler() { DCHECK(samples_.empty()); }
+
+void PretenuringSampler::SetUp() {
+  DCHECK_NOT_NULL(heap_->new_space());
+  observer_ = std::make_unique<Observer>(
+      this, std::max(kTaggedSize, FLAG_lifetime_sampling_pretenuring_rate));
+  heap_->new_space()->AddAllocationObserver(observer_.get());
+}
+
+void PretenuringSampler::TearDown() {
+  if (observer_) {
+    heap_->new_space()->RemoveAllocationObserver(observer_.get());
+    observer_.reset();
+  }
+  for (Sample& sample : samples_) {
+    if (*sample.location) GlobalHandles::Destroy(*sample.location);
+  }
+  samples_.clear();
+}
+
+// static
+const char* PretenuringSampler::SiteName(RuntimeAllocationSite site) {
+  switch (site) {
+#define CASE(Name)                      \
+  case RuntimeAllocationSite::k##Name: \
+    return #Name;
+    RUNTIME_ALLOCATION_SITE_LIST(CASE)
+#undef CASE
+    case RuntimeAllocationSite::kNone:
+      break;
+  }
+  UNREACHABLE();
+}
+
+void PretenuringSampler::SampleObject(Address soon_object) {
+  if (samples_.size() >= kMaximumPendingSamples) return;
+  DisallowGarbageCollection no_gc;
+  // The allocator made the area iterable before invoking the observers.
+  HeapObject object = HeapObject::FromAddress(soon_object);
+  DCHECK(Heap::InYoungGeneration(object));
+  Handle<Object> handle =
+      heap_->isolate()->global_handles()->Create(object);
+  Sample sample{std::make_unique<Address*>(handle.location()), current_site_};
+  GlobalHandles::MakeWeak(sample.location.get());
+  samples_.push_back(std::move(sample));
+}
+
+void PretenuringSampler::RecordPretenuredAllocation(RuntimeAllocationSite site,
+                                                    int size) {
+  DCHECK(sites_[static_cast<int>(site)].pretenure);
+  Counters* counters = heap_->isolate()->counters();
+  counters->pretenured_runtime_bytes()->Increment(size);
+  // A surviving object would have been copied within the young generation
+  // and again on promotion.
+  counters->pretenuring_copied_bytes_saved()->Increment(static_cast<int>(
+      2 * size * sites_[static_cast<int>(site)].survival_ratio));
+}
+
+void PretenuringSampler::ProcessSamples() {
+  bool resolved[kNumberOfSites] = {};
+  auto it = samples_.begin();
+  while (it != samples_.end()) {
+    SiteStatistics& site = sites_[static_cast<int>(it->site)];
+    Address* location = *it->location;
+    if (location == nullptr) {
+      site.dead_samples++;
+    } else if (!Heap::InYoungGeneration(Object(*location))) {
+      site.promoted_samples++;
+      GlobalHandles::Destroy(location);
+    } else {
+      ++it;
+      continue;
+    }
+    resolved[static_cast<int>(it->site)] = true;
+    it = samples_.erase(it);
+  }
+  for (int i = 0; i < kNumberOfSites; i++) {
+    if (resolved[i]) UpdateDecision(static_cast<RuntimeAllocationSite>(i));
+  }
+}
+
+void PretenuringSampler::UpdateDecision(RuntimeAllocationSite site_id) {
+  SiteStatistics& site = sites_[static_cast<int>(site_id)];
+  const size_t resolved = site.promoted_samples + site.dead_samples;
+  if (resolved < kMinimumResolvedSamples) return;
+  site.survival_ratio = static_cast<double>(site.promoted_samples) / resolved;
+  const bool pretenure = site.survival_ratio >= kPretenureRatio;
+  if (FLAG_trace_pretenuring && pretenure != site.pretenure) {
+    PrintIsolate(heap_->isolate(),
+                 "pretenuring: runtime site %s: promoted %zu of %zu sampled "
+                 "objects (%.2f), %s\n",
+                 SiteName(site_id), site.promoted_samples, resolved,
+                 site.survival_ratio, pretenure ? "tenure" : "don't tenure");
+  }
+  site.pretenure = pretenure;
+  // Decisions are based on disjoint windows of samples.
+  site.promoted_samples = 0;
+  site.dead_samples = 0;
+}
+
+void PretenuringSampler::ResetDecisions() {
+  for (SiteStatistics& site : sites_) {
+    site = SiteStatistics();
+  }
+}
+
+RuntimeAllocationSiteScope::RuntimeAllocationSiteScope(
+    Heap* heap, RuntimeAllocationSite site)
+    : sampler_(heap->pretenuring_sampler()), site_(site) {
+  if (!sampler_) return;
+  previous_site_ = sampler_->current_site_;
+  sampler_->current_site_ = site;
+  allocation_ = sampler_->AllocationTypeFor(site);
+}
+
+RuntimeAllocationSiteScope::~RuntimeAllocationSiteScope() {
+  if (!sampler_) return;
+  sampler_->current_site_ = previous_site_;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,136 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PRETENURING_SAMPLER_H_
+#define V8_HEAP_PRETENURING_SAMPLER_H_
+
+#include <memory>
+#include <vector>
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Allocation sites in the runtime and builtins that do not have allocation
+// mementos. Their pretenuring decision is based on lifetime sampling.
+#define RUNTIME_ALLOCATION_SITE_LIST(V) \
+  V(JsonString)                         \
+  V(JsonArray)
+
+enum class RuntimeAllocationSite : uint8_t {
+#define DEFINE_SITE(Name) k##Name,
+  RUNTIME_ALLOCATION_SITE_LIST(DEFINE_SITE)
+#undef DEFINE_SITE
+  kNone
+};
+
+// Samples young generation allocations made on behalf of runtime allocation
+// sites and tracks whether the sampled objects live until promotion. Sites
+// whose sampled objects are mostly promoted are switched to old generation
+// allocation, which saves the scavenger from copying them twice.
+class PretenuringSampler final {
+ public:
+  static constexpr int kNumberOfSites =
+      static_cast<int>(RuntimeAllocationSite::kNone);
+  // Number of resolved samples a site needs before a decision is made.
+  static constexpr size_t kMinimumResolvedSamples = 32;
+  // Upper bound on the samples waiting for their object to die or be
+  // promoted.
+  static constexpr size_t kMaximumPendingSamples = 1024;
+  // Fraction of sampled objects that need to be promoted for a site to be
+  // pretenured. Matches AllocationSite::kPretenureRatio.
+  static constexpr double kPretenureRatio = 0.85;
+
+  explicit PretenuringSampler(Heap* heap);
+  ~PretenuringSampler();
+  PretenuringSampler(const PretenuringSampler&) = delete;
+  PretenuringSampler& operator=(const PretenuringSampler&) = delete;
+
+  void SetUp();
+  void TearDown();
+
+  AllocationType AllocationTypeFor(RuntimeAllocationSite site) const {
+    DCHECK_NE(RuntimeAllocationSite::kNone, site);
+    return sites_[static_cast<int>(site)].pretenure ? AllocationType::kOld
+                                                     : AllocationType::kYoung;
+  }
+
+  // Accounts an object of |size| bytes that |site| allocated in old space.
+  void RecordPretenuredAllocation(RuntimeAllocationSite site, int size);
+
+  // Resolves the samples whose objects died or got promoted during the last
+  // GC and updates the pretenuring decisions.
+  void ProcessSamples();
+
+  // Switches all sites back to young generation allocation.
+  void ResetDecisions();
+
+  size_t pending_samples() const { return samples_.size(); }
+
+ private:
+  class Observer;
+
+  struct Sample {
+    // Location of a weak global handle. Reset to nullptr when the sampled
+    // object dies.
+    std::unique_ptr<Address*> location;
+    RuntimeAllocationSite site;
+  };
+
+  struct SiteStatistics {
+    size_t promoted_samples = 0;
+    size_t dead_samples = 0;
+    // Promoted fraction of the samples the last decision was based on.
+    double survival_ratio = 0.0;
+    bool pretenure = false;
+  };
+
+  static const char* SiteName(RuntimeAllocationSite site);
+
+  void SampleObject(Address soon_object);
+  void UpdateDecision(RuntimeAllocationSite site);
+
+  Heap* const heap_;
+  std::unique_ptr<Observer> observer_;
+  std::vector<Sample> samples_;
+  SiteStatistics sites_[kNumberOfSites];
+  RuntimeAllocationSite current_site_ = RuntimeAllocationSite::kNone;
+
+  friend class RuntimeAllocationSiteScope;
+};
+
+// Attributes young generation allocations in its extent to |site| and
+// provides the allocation type that should be used for them.
+class V8_NODISCARD RuntimeAllocationSiteScope final {
+ public:
+  RuntimeAllocationSiteScope(Heap* heap, RuntimeAllocationSite site);
+  ~RuntimeAllocationSiteScope();
+  RuntimeAllocationSiteScope(const RuntimeAllocationSiteScope&) = delete;
+  RuntimeAllocationSiteScope& operator=(const RuntimeAllocationSiteScope&) =
+      delete;
+
+  AllocationType allocation() const { return allocation_; }
+
+  // Must be called with the size of every object allocated with
+  // allocation().
+  void RecordAllocation(int size) {
+    if (allocation_ == AllocationType::kOld) {
+      sampler_->RecordPretenuredAllocation(site_, size);
+    }
+  }
+
+ private:
+  PretenuringSampler* const sampler_;
+  const RuntimeAllocationSite site_;
+  RuntimeAllocationSite previous_site_ = RuntimeAllocationSite::kNone;
+  AllocationType allocation_ = AllocationType::kYoung;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PRETENURING_SAMPLER_H_
@@ -61,17 +61,64 @@ Sweeper::FilterSweepingPagesScope::FilterSweepingPagesScope(
 
   int old_space_index = GetSweepSpaceIndex(OLD_SPACE);
   old_space_sweeping_list_ =
-      std::move(sweeper_->sweeping_list_[old_space_index]);
-  sweeper_->sweeping_list_[old_space_index].clear();
+      sweeper_->sweeping_queue_[old_space_index].TakeUnclaimed();
 }
 
 Sweeper::FilterSweepingPagesScope::~FilterSweepingPagesScope() {
   DCHECK_EQ(sweeping_in_progress_, sweeper_->sweeping_in_progress());
   if (!sweeping_in_progress_) return;
 
-  sweeper_->sweeping_list_[GetSweepSpaceIndex(OLD_SPACE)] =
-      std::move(old_space_sweeping_list_);
-  // old_space_sweeping_list_ does not need to be cleared as we don't use it.
+  // Pages that were swept in the meantime are skipped by the queue.
+  SweepingQueue& queue =
+      sweeper_->sweeping_queue_[GetSweepSpaceIndex(OLD_SPACE)];
+  queue.TakeUnclaimed();
+  for (Page* page : old_space_sweeping_list_) queue.Push(page);
+}
+
+void Sweeper::SweepingQueue::Push(Page* page) {
+  DCHECK_EQ(pages_.size(), remaining_.load(std::memory_order_relaxed));
+  pages_.push_back(page);
+  remaining_.store(pages_.size(), std::memory_order_relaxed);
+}
+
+Sweeper::SweepingList Sweeper::SweepingQueue::TakeUnclaimed() {
+  SweepingList unclaimed;
+  const size_t remaining = remaining_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < remaining; i++) {
+    Page* page = pages_[i];
+    if (page->concurrent_sweeping_state() ==
+        Page::ConcurrentSweepingState::kPending) {
+      unclaimed.push_back(page);
+    }
+  }
+  pages_.clear();
+  remaining_.store(0, std::memory_order_relaxed);
+  return unclaimed;
+}
+
+Page* Sweeper::SweepingQueue::Pop() {
+  size_t remaining = remaining_.load(std::memory_order_relaxed);
+  while (remaining > 0) {
+    if (!remaining_.compare_exchange_weak(remaining, remaining - 1,
+                                          std::memory_order_relaxed)) {
+      continue;
+    }
+    Page* page = pages_[remaining - 1];
+    // The page may have been claimed by TryRemove() in the meantime.
+    if (page->TryStartSweeping()) return page;
+    remaining = remaining_.load(std::memory_order_relaxed);
+  }
+  return nullptr;
+}
+
+bool Sweeper::SweepingQueue::TryRemove(Page* page) {
+  // Pages are only pushed while no sweeper is running, so |pages_| is stable
+  // here. A page that was already handed out by Pop() fails to be claimed
+  // below.
+  const size_t remaining = remaining_.load(std::memory_order_relaxed);
+  auto end = pages_.begin() + remaining;
+  if (std::find(pages_.begin(), end, page) == end) return false;
+  return page->TryStartSweeping();
 }
 
 class Sweeper::SweeperJob final : public JobTask {
@@ -168,11 +215,9 @@ void Sweeper::StartSweeping() {
     // We sort in descending order of live bytes, i.e., ascending order of free
     // bytes, because GetSweepingPageSafe returns pages in reverse order.
     int space_index = GetSweepSpaceIndex(space);
-    std::sort(
-        sweeping_list_[space_index].begin(), sweeping_list_[space_index].end(),
-        [marking_state](Page* a, Page* b) {
-          return marking_state->live_bytes(a) > marking_state->live_bytes(b);
-        });
+    sweeping_queue_[space_index].Sort([marking_state](Page* a, Page* b) {
+      return marking_state->live_bytes(a) > marking_state->live_bytes(b);
+    });
   });
 }
 
@@ -198,6 +243,17 @@ Page* Sweeper::GetSweptPageSafe(PagedSpace* space) {
   return nullptr;
 }
 
+void Sweeper::GetSweptPagesSafe(PagedSpace* space, SweptList* swept_pages) {
+  DCHECK(swept_pages->empty());
+  base::MutexGuard guard(&mutex_);
+  swept_pages->swap(swept_list_[GetSweepSpaceIndex(space->identity())]);
+}
+
+bool Sweeper::HasSweptPagesSafe(PagedSpace* space) {
+  base::MutexGuard guard(&mutex_);
+  return !swept_list_[GetSweepSpaceIndex(space->identity())].empty();
+}
+
 void Sweeper::MergeOldToNewRememberedSetsForSweptPages() {
   base::MutexGuard guard(&mutex_);
 
@@ -220,7 +276,7 @@ void Sweeper::EnsureCompleted() {
   if (job_handle_ && job_handle_->IsValid()) job_handle_->Join();
 
   ForAllSweepingSpaces([this](AllocationSpace space) {
-    CHECK(sweeping_list_[GetSweepSpaceIndex(space)].empty());
+    CHECK(sweeping_queue_[GetSweepSpaceIndex(space)].IsEmpty());
   });
   sweeping_in_progress_ = false;
 }
@@ -258,6 +314,10 @@ V8_INLINE size_t Sweeper::FreeAndProcessFreedMemory(
   page->heap()->CreateFillerObjectAtBackground(
       free_start, static_cast<int>(size), clear_memory_mode);
   if (free_list_mode == REBUILD_FREE_LIST) {
+    // The memory goes into the page's own free list categories without
+    // linking them into the space's free list, so sweeping threads don't
+    // share any free list state. PagedSpace::RefillFreeList links the
+    // categories of all swept pages at once.
     freed_bytes =
         reinterpret_cast<PagedSpace*>(space)->UnaccountedFree(free_start, size);
   }
@@ -420,15 +480,14 @@ int Sweeper::RawSweep(
 }
 
 size_t Sweeper::ConcurrentSweepingPageCount() {
-  base::MutexGuard guard(&mutex_);
-  return sweeping_list_[GetSweepSpaceIndex(OLD_SPACE)].size() +
-         sweeping_list_[GetSweepSpaceIndex(MAP_SPACE)].size();
+  return sweeping_queue_[GetSweepSpaceIndex(OLD_SPACE)].Size() +
+         sweeping_queue_[GetSweepSpaceIndex(MAP_SPACE)].Size();
 }
 
 bool Sweeper::ConcurrentSweepSpace(AllocationSpace identity,
                                    JobDelegate* delegate) {
   while (!delegate->ShouldYield()) {
-    Page* page = GetSweepingPageSafe(identity);
+    Page* page = GetSweepingPage(identity);
     if (page == nullptr) return true;
     // Typed slot sets are only recorded on code pages. Code pages
     // are not swept concurrently to the application to ensure W^X.
@@ -440,10 +499,10 @@ bool Sweeper::ConcurrentSweepSpace(AllocationSpace identity,
 }
 
 bool Sweeper::IncrementalSweepSpace(AllocationSpace identity) {
-  if (Page* page = GetSweepingPageSafe(identity)) {
+  if (Page* page = GetSweepingPage(identity)) {
     ParallelSweepPage(page, identity);
   }
-  return sweeping_list_[GetSweepSpaceIndex(identity)].empty();
+  return sweeping_queue_[GetSweepSpaceIndex(identity)].IsEmpty();
 }
 
 int Sweeper::ParallelSweepSpace(
@@ -452,7 +511,7 @@ int Sweeper::ParallelSweepSpace(
   int max_freed = 0;
   int pages_freed = 0;
   Page* page = nullptr;
-  while ((page = GetSweepingPageSafe(identity)) != nullptr) {
+  while ((page = GetSweepingPage(identity)) != nullptr) {
     int freed =
         ParallelSweepPage(page, identity, invalidated_slots_in_free_space);
     ++pages_freed;
@@ -474,21 +533,17 @@ int Sweeper::ParallelSweepPage(
     FreeSpaceMayContainInvalidatedSlots invalidated_slots_in_free_space) {
   DCHECK(IsValidSweepingSpace(identity));
 
-  // The Scavenger may add already swept pages back.
-  if (page->SweepingDone()) return 0;
+  // The page was claimed from the sweeping queue by the caller.
+  DCHECK_EQ(Page::ConcurrentSweepingState::kInProgress,
+            page->concurrent_sweeping_state());
 
   int max_freed = 0;
   {
     base::MutexGuard guard(page->mutex());
-    DCHECK(!page->SweepingDone());
     // If the page is a code page, the CodePageMemoryModificationScope changes
     // the page protection mode from rx -> rw while sweeping.
     CodePageMemoryModificationScope code_page_scope(page);
 
-    DCHECK_EQ(Page::ConcurrentSweepingState::kPending,
-              page->concurrent_sweeping_state());
-    page->set_concurrent_sweeping_state(
-        Page::ConcurrentSweepingState::kInProgress);
     const FreeSpaceTreatmentMode free_space_mode =
         Heap::ShouldZapGarbage() ? ZAP_FREE_SPACE : IGNORE_FREE_SPACE;
     max_freed = RawSweep(page, REBUILD_FREE_LIST, free_space_mode,
@@ -509,7 +564,7 @@ void Sweeper::EnsurePageIsSwept(Page* page) {
   AllocationSpace space = page->owner_identity();
 
   if (IsValidSweepingSpace(space)) {
-    if (TryRemoveSweepingPageSafe(space, page)) {
+    if (TryRemoveSweepingPage(space, page)) {
       // Page was successfully removed and can now be swept.
       ParallelSweepPage(page, space);
     } else {
@@ -528,16 +583,9 @@ void Sweeper::EnsurePageIsSwept(Page* page) {
   CHECK(page->SweepingDone());
 }
 
-bool Sweeper::TryRemoveSweepingPageSafe(AllocationSpace space, Page* page) {
-  base::MutexGuard guard(&mutex_);
+bool Sweeper::TryRemoveSweepingPage(AllocationSpace space, Page* page) {
   DCHECK(IsValidSweepingSpace(space));
-  int space_index = GetSweepSpaceIndex(space);
-  SweepingList& sweeping_list = sweeping_list_[space_index];
-  SweepingList::iterator position =
-      std::find(sweeping_list.begin(), sweeping_list.end(), page);
-  if (position == sweeping_list.end()) return false;
-  sweeping_list.erase(position);
-  return true;
+  return sweeping_queue_[GetSweepSpaceIndex(space)].TryRemove(page);
 }
 
 void Sweeper::ScheduleIncrementalSweepingTask() {
@@ -553,19 +601,21 @@ void Sweeper::ScheduleIncrementalSweepingTask() {
 
 void Sweeper::AddPage(AllocationSpace space, Page* page,
                       Sweeper::AddPageMode mode) {
-  base::MutexGuard guard(&mutex_);
   DCHECK(IsValidSweepingSpace(space));
   DCHECK(!FLAG_concurrent_sweeping || !job_handle_ || !job_handle_->IsValid());
-  if (mode == Sweeper::REGULAR) {
-    PrepareToBeSweptPage(space, page);
-  } else {
-    // Page has been temporarily removed from the sweeper. Accounting already
-    // happened when the page was initially added, so it is skipped here.
-    DCHECK_EQ(Sweeper::READD_TEMPORARY_REMOVED_PAGE, mode);
+  if (mode == Sweeper::READD_TEMPORARY_REMOVED_PAGE) {
+    // Page has been temporarily removed from the sweeper by a
+    // FilterSweepingPagesScope, which puts it back into the sweeping queue
+    // when the scope ends. Pages may be re-added from multiple scavenger
+    // tasks, so the queue is not modified here.
+    DCHECK_EQ(Page::ConcurrentSweepingState::kPending,
+              page->concurrent_sweeping_state());
+    return;
   }
+  PrepareToBeSweptPage(space, page);
   DCHECK_EQ(Page::ConcurrentSweepingState::kPending,
             page->concurrent_sweeping_state());
-  sweeping_list_[GetSweepSpaceIndex(space)].push_back(page);
+  sweeping_queue_[GetSweepSpaceIndex(space)].Push(page);
 }
 
 void Sweeper::PrepareToBeSweptPage(AllocationSpace space, Page* page) {
@@ -584,16 +634,9 @@ void Sweeper::PrepareToBeSweptPage(AllocationSpace space, Page* page) {
       marking_state_->live_bytes(page), page);
 }
 
-Page* Sweeper::GetSweepingPageSafe(AllocationSpace space) {
-  base::MutexGuard guard(&mutex_);
+Page* Sweeper::GetSweepingPage(AllocationSpace space) {
   DCHECK(IsValidSweepingSpace(space));
-  int space_index = GetSweepSpaceIndex(space);
-  Page* page = nullptr;
-  if (!sweeping_list_[space_index].empty()) {
-    page = sweeping_list_[space_index].back();
-    sweeping_list_[space_index].pop_back();
-  }
-  return page;
+  return sweeping_queue_[GetSweepSpaceIndex(space)].Pop();
 }
 
 void Sweeper::EnsureIterabilityCompleted() {
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_SWEEPER_H_
 #define V8_HEAP_SWEEPER_H_
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <vector>
 
@@ -55,13 +57,13 @@ class Sweeper {
     void FilterOldSpaceSweepingPages(Callback callback) {
       if (!sweeping_in_progress_) return;
 
-      SweepingList* sweeper_list =
-          &sweeper_->sweeping_list_[GetSweepSpaceIndex(OLD_SPACE)];
+      SweepingQueue* sweeper_queue =
+          &sweeper_->sweeping_queue_[GetSweepSpaceIndex(OLD_SPACE)];
       // Iteration here is from most free space to least free space.
       for (auto it = old_space_sweeping_list_.begin();
            it != old_space_sweeping_list_.end(); it++) {
         if (callback(*it)) {
-          sweeper_list->push_back(*it);
+          sweeper_queue->Push(*it);
         }
       }
     }
@@ -117,6 +119,12 @@ class Sweeper {
   void SupportConcurrentSweeping();
 
   Page* GetSweptPageSafe(PagedSpace* space);
+  // Moves all pages swept so far for |space| into |swept_pages| using a
+  // single lock acquisition.
+  void GetSweptPagesSafe(PagedSpace* space, SweptList* swept_pages);
+  // Whether pages of |space| were swept but not taken yet. Unlike the above,
+  // this leaves the swept pages where they are.
+  V8_EXPORT_PRIVATE bool HasSweptPagesSafe(PagedSpace* space);
 
   void AddPageForIterability(Page* page);
   void StartIterabilityTasks();
@@ -128,6 +136,46 @@ class Sweeper {
   class IterabilityTask;
   class SweeperJob;
 
+  // Pages of a single space that still need to be swept. Pages are only
+  // pushed while no sweeper job is running. Afterwards they are handed out
+  // from the back without taking a lock: Pop() and TryRemove() race on the
+  // page's sweeping state, so each page is swept by exactly one thread and
+  // pages removed by TryRemove() are skipped by Pop().
+  class SweepingQueue final {
+   public:
+    SweepingQueue() = default;
+    SweepingQueue(const SweepingQueue&) = delete;
+    SweepingQueue& operator=(const SweepingQueue&) = delete;
+
+    // Requires exclusive access.
+    void Push(Page* page);
+    // Requires exclusive access.
+    template <typename Comparator>
+    void Sort(Comparator comparator) {
+      DCHECK_EQ(pages_.size(), remaining_.load(std::memory_order_relaxed));
+      std::sort(pages_.begin(), pages_.end(), comparator);
+    }
+    // Requires exclusive access. Returns the pages that were not claimed yet
+    // and empties the queue.
+    SweepingList TakeUnclaimed();
+
+    // Claims the next page to sweep. Returns nullptr if the queue is empty.
+    Page* Pop();
+    // Claims |page| if it is queued and no other thread claimed it yet.
+    bool TryRemove(Page* page);
+
+    bool IsEmpty() const {
+      return remaining_.load(std::memory_order_relaxed) == 0;
+    }
+    // Upper bound on the number of unclaimed pages.
+    size_t Size() const { return remaining_.load(std::memory_order_relaxed); }
+
+   private:
+    SweepingList pages_;
+    // Pages in [0, remaining_) have not been handed out by Pop() yet.
+    std::atomic<size_t> remaining_{0};
+  };
+
   static const int kNumberOfSweepingSpaces =
       LAST_GROWABLE_PAGED_SPACE - FIRST_GROWABLE_PAGED_SPACE + 1;
   static const int kMaxSweeperTasks = 3;
@@ -170,7 +218,9 @@ class Sweeper {
   bool IsDoneSweeping() const {
     bool is_done = true;
     ForAllSweepingSpaces([this, &is_done](AllocationSpace space) {
-      if (!sweeping_list_[GetSweepSpaceIndex(space)].empty()) is_done = false;
+      if (!sweeping_queue_[GetSweepSpaceIndex(space)].IsEmpty()) {
+        is_done = false;
+      }
     });
     return is_done;
   }
@@ -185,8 +235,8 @@ class Sweeper {
   // there are no more pages to sweep in the given space.
   bool IncrementalSweepSpace(AllocationSpace identity);
 
-  Page* GetSweepingPageSafe(AllocationSpace space);
-  bool TryRemoveSweepingPageSafe(AllocationSpace space, Page* page);
+  Page* GetSweepingPage(AllocationSpace space);
+  bool TryRemoveSweepingPage(AllocationSpace space, Page* page);
 
   void PrepareToBeSweptPage(AllocationSpace space, Page* page);
 
@@ -209,10 +259,11 @@ class Sweeper {
   Heap* const heap_;
   MajorNonAtomicMarkingState* marking_state_;
   std::unique_ptr<JobHandle> job_handle_;
+  // Protects the swept lists. The sweeping queues are lock-free.
   base::Mutex mutex_;
   base::ConditionVariable cv_page_swept_;
   SweptList swept_list_[kNumberOfSweepingSpaces];
-  SweepingList sweeping_list_[kNumberOfSweepingSpaces];
+  SweepingQueue sweeping_queue_[kNumberOfSweepingSpaces];
   bool incremental_sweeper_pending_;
   // Main thread can finalize sweeping, while background threads allocation slow
   // path checks this flag to see whether it could support concurrent sweeping.
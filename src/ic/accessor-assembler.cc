@@ -18,6 +18,7 @@
 #include "src/objects/feedback-vector.h"
 #include "src/objects/foreign.h"
 #include "src/objects/heap-number.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/megadom-handler.h"
 #include "src/objects/module.h"
 #include "src/objects/objects-inl.h"
@@ -2673,6 +2674,103 @@ void AccessorAssembler::GenericElementLoad(
   Return(UndefinedConstant());
 }
 
+TNode<IntPtrT> AccessorAssembler::DictionaryLookupCacheEntryOffset(
+    TNode<Map> map, TNode<Name> name) {
+  // See DictionaryLookupCache::Hash.
+  TNode<Word32T> map_hash = Word32Shr(
+      TruncateIntPtrToInt32(BitcastTaggedToWord(map)), kTaggedSizeLog2);
+  TNode<Word32T> hash = Word32And(Word32Xor(map_hash, LoadNameHash(name)),
+                                  Int32Constant(DictionaryLookupCache::kLength - 1));
+  return IntPtrMul(Signed(ChangeUint32ToWord(hash)),
+                   IntPtrConstant(sizeof(DictionaryLookupCache::Entry)));
+}
+
+void AccessorAssembler::InvalidateDictionaryLookupCache(TNode<Map> map,
+                                                        TNode<Name> name) {
+  using Entry = DictionaryLookupCache::Entry;
+  TNode<ExternalReference> cache =
+      ExternalConstant(ExternalReference::dictionary_lookup_cache(isolate()));
+  TNode<IntPtrT> offset = DictionaryLookupCacheEntryOffset(map, name);
+  TNode<IntPtrT> map_offset =
+      IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, map)));
+  TNode<IntPtrT> name_offset =
+      IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, name)));
+
+  Label done(this);
+  GotoIfNot(WordEqual(Load<IntPtrT>(cache, map_offset),
+                      BitcastTaggedToWord(map)),
+            &done);
+  GotoIfNot(WordEqual(Load<IntPtrT>(cache, name_offset),
+                      BitcastTaggedToWord(name)),
+            &done);
+  StoreNoWriteBarrier(MachineType::PointerRepresentation(), cache, map_offset,
+                      IntPtrConstant(kNullAddress));
+  Goto(&done);
+
+  BIND(&done);
+}
+
+template <typename Dictionary>
+void AccessorAssembler::CachedNameDictionaryLookup(
+    TNode<Map> map, TNode<Dictionary> dictionary, TNode<Name> name,
+    Label* if_found, TVariable<IntPtrT>* var_name_index, Label* if_not_found) {
+  Comment("CachedNameDictionaryLookup");
+  using Entry = DictionaryLookupCache::Entry;
+  TNode<ExternalReference> cache =
+      ExternalConstant(ExternalReference::dictionary_lookup_cache(isolate()));
+  TNode<IntPtrT> map_word = BitcastTaggedToWord(map);
+  TNode<IntPtrT> name_word = BitcastTaggedToWord(name);
+
+  TNode<IntPtrT> offset = DictionaryLookupCacheEntryOffset(map, name);
+  TNode<IntPtrT> map_offset =
+      IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, map)));
+  TNode<IntPtrT> name_offset =
+      IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, name)));
+  TNode<IntPtrT> name_index_offset =
+      IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, name_index)));
+
+  Label miss(this), update_cache(this, var_name_index);
+  GotoIfNot(WordEqual(Load<IntPtrT>(cache, map_offset), map_word), &miss);
+  GotoIfNot(WordEqual(Load<IntPtrT>(cache, name_offset), name_word), &miss);
+  {
+    // Other objects with the same map may have put the name at a different
+    // index, or none at all, so check the key at the cached index.
+    TNode<IntPtrT> name_index = Load<IntPtrT>(cache, name_index_offset);
+    GotoIfNot(UintPtrLessThan(name_index,
+                              LoadAndUntagFixedArrayBaseLength(dictionary)),
+              &miss);
+    GotoIfNot(
+        TaggedEqual(UnsafeLoadFixedArrayElement(dictionary, name_index), name),
+        &miss);
+    *var_name_index = name_index;
+    Goto(if_found);
+  }
+
+  BIND(&miss);
+  NameDictionaryLookup<Dictionary>(dictionary, name, &update_cache,
+                                   var_name_index, if_not_found);
+
+  BIND(&update_cache);
+  {
+    StoreNoWriteBarrier(MachineType::PointerRepresentation(), cache,
+                        map_offset, map_word);
+    StoreNoWriteBarrier(MachineType::PointerRepresentation(), cache,
+                        name_offset, name_word);
+    StoreNoWriteBarrier(MachineType::PointerRepresentation(), cache,
+                        name_index_offset, var_name_index->value());
+    Goto(if_found);
+  }
+}
+
+// The cache doesn't support the entries of a SwissNameDictionary.
+template <>
+void AccessorAssembler::CachedNameDictionaryLookup(
+    TNode<Map> map, TNode<SwissNameDictionary> dictionary, TNode<Name> name,
+    Label* if_found, TVariable<IntPtrT>* var_name_index, Label* if_not_found) {
+  NameDictionaryLookup<SwissNameDictionary>(dictionary, name, if_found,
+                                            var_name_index, if_not_found);
+}
+
 void AccessorAssembler::GenericPropertyLoad(
     TNode<HeapObject> lookup_start_object, TNode<Map> lookup_start_object_map,
     TNode<Int32T> lookup_start_object_instance_type, const LoadICParameters* p,
@@ -2763,9 +2861,9 @@ void AccessorAssembler::GenericPropertyLoad(
     Label dictionary_found(this, &var_name_index);
     TNode<PropertyDictionary> properties =
         CAST(LoadSlowProperties(CAST(lookup_start_object)));
-    NameDictionaryLookup<PropertyDictionary>(properties, name,
-                                             &dictionary_found, &var_name_index,
-                                             &lookup_prototype_chain);
+    CachedNameDictionaryLookup<PropertyDictionary>(
+        lookup_start_object_map, properties, name, &dictionary_found,
+        &var_name_index, &lookup_prototype_chain);
     BIND(&dictionary_found);
     {
       LoadPropertyFromDictionary<PropertyDictionary>(
@@ -2863,7 +2961,17 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
+TNode<Uint32T> AccessorAssembler::LoadStubCacheMask(StubCache* stub_cache,
+                                                   StubCacheTable table_id) {
+  StubCache::Table table = static_cast<StubCache::Table>(table_id);
+  return UncheckedCast<Uint32T>(
+      Load(MachineType::Uint32(),
+           ExternalConstant(
+               ExternalReference::Create(stub_cache->mask_reference(table)))));
+}
+
+TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                         TNode<Name> name,
                                                          TNode<Map> map) {
   // Compute the hash of the name (use entire hash field).
   TNode<Uint32T> raw_hash_field = LoadNameRawHashField(name);
@@ -2881,15 +2989,13 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kMapKeyShift))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  TNode<Uint32T> mask = LoadStubCacheMask(stub_cache, kPrimary);
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
-TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
-                                                           TNode<Map> map) {
+TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(
+    StubCache* stub_cache, TNode<Name> name, TNode<Map> map) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
@@ -2899,10 +3005,8 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   TNode<Word32T> hash_a = Int32Add(map32, name32);
   TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryKeyShift);
   TNode<Word32T> hash = Int32Add(hash_a, hash_b);
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  TNode<Uint32T> mask = LoadStubCacheMask(stub_cache, kSecondary);
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
@@ -2917,8 +3021,12 @@ void AccessorAssembler::TryProbeStubCacheTable(
       sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
   entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
 
-  TNode<ExternalReference> key_base = ExternalConstant(
-      ExternalReference::Create(stub_cache->key_reference(table)));
+  // The tables are reallocated when the stub cache grows, so the address of
+  // the first entry has to be loaded.
+  TNode<RawPtrT> key_base = UncheckedCast<RawPtrT>(
+      Load(MachineType::Pointer(),
+           ExternalConstant(
+               ExternalReference::Create(stub_cache->table_reference(table)))));
 
   // Check that the key in the entry matches the name.
   DCHECK_EQ(0, offsetof(StubCache::Entry, key));
@@ -2959,7 +3067,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
 
   // Probe the primary table.
   TNode<IntPtrT> primary_offset =
-      StubCachePrimaryOffset(name, lookup_start_object_map);
+      StubCachePrimaryOffset(stub_cache, name, lookup_start_object_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          lookup_start_object_map, if_handler, var_handler,
                          &try_secondary);
@@ -2968,7 +3076,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   {
     // Probe the secondary table.
     TNode<IntPtrT> secondary_offset =
-        StubCacheSecondaryOffset(name, lookup_start_object_map);
+        StubCacheSecondaryOffset(stub_cache, name, lookup_start_object_map);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            lookup_start_object_map, if_handler, var_handler,
                            &miss);
@@ -78,13 +78,15 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                          Label* if_handler, TVariable<MaybeObject>* var_handler,
                          Label* if_miss);
 
-  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(StubCache* stub_cache,
+                                                  TNode<Name> name,
                                                   TNode<Map> map) {
-    return StubCachePrimaryOffset(name, map);
+    return StubCachePrimaryOffset(stub_cache, name, map);
   }
-  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(StubCache* stub_cache,
+                                                    TNode<Name> name,
                                                     TNode<Map> map) {
-    return StubCacheSecondaryOffset(name, map);
+    return StubCacheSecondaryOffset(stub_cache, name, map);
   }
 
   struct LoadICParameters {
@@ -286,6 +288,10 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                       TNode<IntPtrT> name_index, TNode<Word32T> representation,
                       TNode<Object> value, Label* bailout);
 
+  // Drops the DictionaryLookupCache entry for (map, name), if there is one.
+  // Called when the property is deleted from an object with that map.
+  void InvalidateDictionaryLookupCache(TNode<Map> map, TNode<Name> name);
+
  private:
   // Stub generation entry points.
 
@@ -476,8 +482,20 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                            const LoadICParameters* p, Label* slow,
                            UseStubCache use_stub_cache = kUseStubCache);
 
+  // Like NameDictionaryLookup on the properties of an object with the given
+  // dictionary map, but consults the DictionaryLookupCache first and records
+  // the index found there.
+  template <typename Dictionary>
+  void CachedNameDictionaryLookup(TNode<Map> map, TNode<Dictionary> dictionary,
+                                  TNode<Name> name, Label* if_found,
+                                  TVariable<IntPtrT>* var_name_index,
+                                  Label* if_not_found);
+
   // Low-level helpers.
 
+  TNode<IntPtrT> DictionaryLookupCacheEntryOffset(TNode<Map> map,
+                                                  TNode<Name> name);
+
   using OnCodeHandler = std::function<void(TNode<CodeT> code_handler)>;
   using OnFoundOnLookupStartObject = std::function<void(
       TNode<PropertyDictionary> properties, TNode<IntPtrT> name_index)>;
@@ -523,8 +541,12 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   // including stub cache header.
   enum StubCacheTable : int;
 
-  TNode<IntPtrT> StubCachePrimaryOffset(TNode<Name> name, TNode<Map> map);
-  TNode<IntPtrT> StubCacheSecondaryOffset(TNode<Name> name, TNode<Map> map);
+  TNode<Uint32T> LoadStubCacheMask(StubCache* stub_cache,
+                                   StubCacheTable table_id);
+  TNode<IntPtrT> StubCachePrimaryOffset(StubCache* stub_cache,
+                                        TNode<Name> name, TNode<Map> map);
+  TNode<IntPtrT> StubCacheSecondaryOffset(StubCache* stub_cache,
+                                          TNode<Name> name, TNode<Map> map);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
                               TNode<IntPtrT> entry_offset, TNode<Object> name,
@@ -5,7 +5,6 @@
 #include "src/ic/stub-cache.h"
 
 #include "src/ast/ast.h"
-#include "src/base/bits.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
 #include "src/logging/counters.h"
@@ -18,18 +17,53 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  AllocateTables(
+      std::max(1, std::min(FLAG_stub_cache_primary_table_bits, kMaxTableBits)),
+      std::max(1,
+               std::min(FLAG_stub_cache_secondary_table_bits, kMaxTableBits)));
 }
 
-void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
+StubCache::~StubCache() {
+  delete[] primary_;
+  delete[] secondary_;
+}
+
+void StubCache::Initialize() { Clear(); }
+
+void StubCache::AllocateTables(int primary_bits, int secondary_bits) {
+  DCHECK_LE(1, primary_bits);
+  DCHECK_LE(primary_bits, kMaxTableBits);
+  DCHECK_LE(1, secondary_bits);
+  DCHECK_LE(secondary_bits, kMaxTableBits);
+  delete[] primary_;
+  delete[] secondary_;
+  primary_bits_ = primary_bits;
+  secondary_bits_ = secondary_bits;
+  primary_ = new Entry[table_size(kPrimary)];
+  secondary_ = new Entry[table_size(kSecondary)];
+  primary_mask_ = (table_size(kPrimary) - 1) << kCacheIndexShift;
+  secondary_mask_ = (table_size(kSecondary) - 1) << kCacheIndexShift;
+}
+
+void StubCache::MaybeGrow() {
+  // Growing is considered once every primary entry has on average been
+  // retired to the secondary table and evicted from there again since the
+  // last mark-compact, which means that the working set of the megamorphic
+  // accesses does not fit into the stub cache.
+  if (!FLAG_adaptive_stub_cache || evictions_ < table_size(kPrimary)) return;
+  int max_bits =
+      std::min(FLAG_stub_cache_max_primary_table_bits, kMaxTableBits);
+  if (primary_bits_ >= max_bits) return;
+  AllocateTables(primary_bits_ + 1,
+                 std::min(secondary_bits_ + 1, kMaxTableBits));
   Clear();
+  isolate()->counters()->megamorphic_stub_cache_resizes()->Increment();
 }
 
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
-int StubCache::PrimaryOffset(Name name, Map map) {
+int StubCache::PrimaryOffset(Name name, Map map) const {
   // Compute the hash of the name (use entire hash field).
   DCHECK(name.HasHashCode());
   uint32_t field = name.raw_hash_field();
@@ -40,19 +74,19 @@ int StubCache::PrimaryOffset(Name name, Map map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kMapKeyShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
 // assembler. This hash should be sufficiently different from the primary one
 // in order to avoid collisions for minified code with short names.
 // Returns an index into the table that is scaled by 1 << kCacheIndexShift.
-int StubCache::SecondaryOffset(Name name, Map old_map) {
+int StubCache::SecondaryOffset(Name name, Map old_map) const {
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryKeyShift);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -82,6 +116,7 @@ bool CommonStubCacheChecks(StubCache* stub_cache, Name name, Map map,
 
 void StubCache::Set(Name name, Map map, MaybeObject handler) {
   DCHECK(CommonStubCacheChecks(this, name, map, handler));
+  MaybeGrow();
 
   // Compute the primary entry.
   int primary_offset = PrimaryOffset(name, map);
@@ -99,6 +134,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key));
     int secondary_offset = SecondaryOffset(old_name, old_map);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (!secondary->map.IsSmi()) evictions_++;
     *secondary = *primary;
   }
 
@@ -128,16 +164,17 @@ void StubCache::Clear() {
   MaybeObject empty =
       MaybeObject::FromObject(isolate_->builtins()->code(Builtin::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < table_size(kPrimary); i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < table_size(kSecondary); j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
   }
+  evictions_ = 0;
 }
 
 }  // namespace internal
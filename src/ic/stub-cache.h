@@ -15,6 +15,11 @@ namespace internal {
 // It maps (map, name, type) to property access handlers. The cache does not
 // need explicit invalidation when a prototype chain is modified, since the
 // handlers verify the chain.
+//
+// The sizes of the tables are configurable, and with --adaptive-stub-cache
+// the tables grow when many live entries get evicted between two mark-compact
+// collections. Generated code therefore loads the tables and their masks from
+// the StubCache instead of embedding them as constants.
 
 
 class SCTableReference {
@@ -51,19 +56,28 @@ class V8_EXPORT_PRIVATE StubCache {
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
-  }
-
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
+  // Reference to the pointer to the first entry of the {table}, which
+  // changes when the stub cache grows.
+  SCTableReference table_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_));
+    }
+    UNREACHABLE();
   }
 
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  // Reference to the uint32_t mask which turns a hash into an offset into the
+  // {table}, see PrimaryOffset() and SecondaryOffset().
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
   }
 
   StubCache::Entry* first_entry(StubCache::Table table) {
@@ -76,6 +90,16 @@ class V8_EXPORT_PRIVATE StubCache {
     UNREACHABLE();
   }
 
+  int table_size(StubCache::Table table) const {
+    switch (table) {
+      case StubCache::kPrimary:
+        return 1 << primary_bits_;
+      case StubCache::kSecondary:
+        return 1 << secondary_bits_;
+    }
+    UNREACHABLE();
+  }
+
   Isolate* isolate() { return isolate_; }
 
   // Setting kCacheIndexShift to Name::HashBits::kShift is convenient because it
@@ -85,21 +109,28 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // Default sizes of the tables, see --stub-cache-primary-table-bits and
+  // --stub-cache-secondary-table-bits.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
+  // Upper bound for the size of the tables, such that the masks still fit
+  // into 32 bits with room to spare.
+  static constexpr int kMaxTableBits = 20;
+
   // Used to introduce more entropy from the higher bits of the Map address.
   // This should fill in the masked out kCacheIndexShift-bits.
   static const int kMapKeyShift = kPrimaryTableBits + kCacheIndexShift;
   static const int kSecondaryKeyShift = kSecondaryTableBits + kCacheIndexShift;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, Map map);
+  int PrimaryOffsetForTesting(Name name, Map map);
+  int SecondaryOffsetForTesting(Name name, Map map);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -114,12 +145,20 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map) const;
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, Map map);
+  int SecondaryOffset(Name name, Map map) const;
+
+  // (Re)allocates both tables with the given sizes. Callers have to Clear()
+  // the new tables before they are used.
+  void AllocateTables(int primary_bits, int secondary_bits);
+
+  // Doubles the size of both tables if many live entries have been evicted
+  // since the last Clear(), and --adaptive-stub-cache is enabled.
+  void MaybeGrow();
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -136,8 +175,15 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_ = nullptr;
+  Entry* secondary_ = nullptr;
+  uint32_t primary_mask_ = 0;
+  uint32_t secondary_mask_ = 0;
+  int primary_bits_ = 0;
+  int secondary_bits_ = 0;
+  // Number of live entries dropped from the secondary table since the last
+  // Clear().
+  int evictions_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
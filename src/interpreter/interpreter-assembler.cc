@@ -1219,6 +1219,69 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::JumpIfBooleanDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  // Test bytecodes in a test context are almost always followed by one of the
+  // immediate-operand boolean jumps, so inline those to save a dispatch on
+  // every loop condition and if-statement.
+  TNode<Int32T> next_bytecode = TruncateWordToInt32(target_bytecode);
+  TNode<Int32T> jump_if_true_bytecode =
+      Int32Constant(static_cast<int>(Bytecode::kJumpIfTrue));
+  TNode<Int32T> jump_if_false_bytecode =
+      Int32Constant(static_cast<int>(Bytecode::kJumpIfFalse));
+  GotoIf(Word32Equal(next_bytecode, jump_if_true_bytecode),
+         &do_inline_jump_if_true);
+  Branch(Word32Equal(next_bytecode, jump_if_false_bytecode),
+         &do_inline_jump_if_false, &done);
+
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIfBoolean(Bytecode::kJumpIfTrue, target_bytecode);
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIfBoolean(Bytecode::kJumpIfFalse, target_bytecode);
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIfBoolean(Bytecode jump_bytecode,
+                                               TNode<WordT> target_bytecode) {
+  DCHECK(jump_bytecode == Bytecode::kJumpIfTrue ||
+         jump_bytecode == Bytecode::kJumpIfFalse);
+
+  // Keep the dispatch counters meaningful by recording the elided dispatch.
+  if (V8_IGNITION_DISPATCH_COUNTING_BOOL) {
+    TraceBytecodeDispatch(target_bytecode);
+  }
+
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  // Mirrors the JumpIfTrue and JumpIfFalse handlers; both the taken and the
+  // fall-through paths end in their own dispatch.
+  TNode<Object> accumulator = GetAccumulator();
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+  TNode<Oddball> expected = jump_bytecode == Bytecode::kJumpIfTrue
+                               ? TNode<Oddball>(TrueConstant())
+                               : TNode<Oddball>(FalseConstant());
+  JumpIfTaggedEqual(accumulator, expected, 0);
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1232,6 +1295,9 @@ void InterpreterAssembler::DispatchToBytecodeWithOptionalStarLookahead(
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     StarDispatchLookahead(target_bytecode);
   }
+  if (Bytecodes::IsJumpIfBooleanLookahead(bytecode_, operand_scale_)) {
+    JumpIfBooleanDispatchLookahead(target_bytecode);
+  }
   DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
 
@@ -250,7 +250,8 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
 
   // Dispatches to |target_bytecode| at BytecodeOffset(). Includes short-star
   // lookahead if the current bytecode_ is likely followed by a short-star
-  // instruction.
+  // instruction, and JumpIfTrue/JumpIfFalse lookahead if it is a test that is
+  // likely followed by a conditional jump.
   void DispatchToBytecodeWithOptionalStarLookahead(
       TNode<WordT> target_bytecode);
 
@@ -403,6 +404,16 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue and JumpIfFalse and inline them in a branch,
+  // including subsequent dispatch. Anything after this point can assume that
+  // the following instruction was neither of these jumps.
+  void JumpIfBooleanDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for the boolean conditional jump |jump_bytecode| at the current
+  // BytecodeOffset(), including the dispatch to whichever bytecode follows.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode,
+                           TNode<WordT> target_bytecode);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -9,6 +9,7 @@
 #include "src/common/message-template.h"
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
+#include "src/heap/pretenuring-sampler.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/field-type.h"
@@ -685,23 +686,32 @@ Handle<Object> JsonParser<Char>::BuildJsonArray(
     }
   }
 
-  Handle<JSArray> array = factory()->NewJSArray(kind, length, length);
+  RuntimeAllocationSiteScope site_scope(isolate_->heap(),
+                                        RuntimeAllocationSite::kJsonArray);
+  const AllocationType allocation = site_scope.allocation();
+  Handle<FixedArrayBase> elements;
   if (kind == PACKED_DOUBLE_ELEMENTS) {
+    elements = factory()->NewFixedDoubleArray(length, allocation);
     DisallowGarbageCollection no_gc;
-    FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
+    FixedDoubleArray raw_elements = FixedDoubleArray::cast(*elements);
     for (int i = 0; i < length; i++) {
-      elements.set(i, element_stack[start + i]->Number());
+      raw_elements.set(i, element_stack[start + i]->Number());
     }
   } else {
+    elements = factory()->NewFixedArray(length, allocation);
     DisallowGarbageCollection no_gc;
-    FixedArray elements = FixedArray::cast(array->elements());
+    FixedArray raw_elements = FixedArray::cast(*elements);
     WriteBarrierMode mode = kind == PACKED_SMI_ELEMENTS
                                 ? SKIP_WRITE_BARRIER
-                                : elements.GetWriteBarrierMode(no_gc);
+                                : raw_elements.GetWriteBarrierMode(no_gc);
     for (int i = 0; i < length; i++) {
-      elements.set(i, *element_stack[start + i], mode);
+      raw_elements.set(i, *element_stack[start + i], mode);
     }
   }
+  Handle<JSArray> array =
+      factory()->NewJSArrayWithElements(elements, kind, length, allocation);
+  site_scope.RecordAllocation(array->Size() +
+                              (length > 0 ? elements->Size() : 0));
   return array;
 }
 
@@ -1042,15 +1052,23 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
     return factory()->InternalizeString(chars, string.needs_conversion());
   }
 
+  RuntimeAllocationSiteScope site_scope(isolate_->heap(),
+                                        RuntimeAllocationSite::kJsonString);
   if (sizeof(Char) == 1 ? V8_LIKELY(!string.needs_conversion())
                         : string.needs_conversion()) {
     Handle<SeqOneByteString> intermediate =
-        factory()->NewRawOneByteString(string.length()).ToHandleChecked();
+        factory()
+            ->NewRawOneByteString(string.length(), site_scope.allocation())
+            .ToHandleChecked();
+    site_scope.RecordAllocation(intermediate->Size());
     return DecodeString(string, intermediate, hint);
   }
 
   Handle<SeqTwoByteString> intermediate =
-      factory()->NewRawTwoByteString(string.length()).ToHandleChecked();
+      factory()
+          ->NewRawTwoByteString(string.length(), site_scope.allocation())
+          .ToHandleChecked();
+  site_scope.RecordAllocation(intermediate->Size());
   return DecodeString(string, intermediate, hint);
 }
 
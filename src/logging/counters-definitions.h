@@ -207,6 +207,11 @@ namespace internal {
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_total_time,                                                  \
      V8.TurboFanOptimizeForOnStackReplacementTotalTime, 10000000, MICROSECOND) \
+  /* Maglev timers. */                                                         \
+  HT(maglev_concurrent_queue_wait, V8.MaglevConcurrentQueueWait, 10000000,     \
+     MICROSECOND)                                                              \
+  HT(maglev_concurrent_execute, V8.MaglevConcurrentExecute, 1000000,           \
+     MICROSECOND)                                                              \
   /* Wasm timers. */                                                           \
   HT(wasm_compile_asm_module_time, V8.WasmCompileModuleMicroSeconds.asm,       \
      10000000, MICROSECOND)                                                    \
@@ -334,6 +339,7 @@ namespace internal {
   SC(cow_arrays_converted, V8.COWArraysConverted)                              \
   SC(constructed_objects_runtime, V8.ConstructedObjectsRuntime)                \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_resizes, V8.MegamorphicStubCacheResizes)           \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(string_add_runtime, V8.StringAddRuntime)                                  \
@@ -356,10 +362,25 @@ namespace internal {
   SC(lo_space_bytes_available, V8.MemoryLoSpaceBytesAvailable)                 \
   SC(lo_space_bytes_committed, V8.MemoryLoSpaceBytesCommitted)                 \
   SC(lo_space_bytes_used, V8.MemoryLoSpaceBytesUsed)                           \
+  /* Bytes allocated in old space by pretenured runtime allocation sites. */   \
+  SC(pretenured_runtime_bytes, V8.PretenuredRuntimeBytes)                      \
+  /* Estimated bytes the young generation GC did not have to copy. */          \
+  SC(pretenuring_copied_bytes_saved, V8.PretenuringCopiedBytesSaved)           \
+  /* Time the heap spent above the embedder's memory budget. */               \
+  SC(memory_budget_exceeded_ms, V8.MemoryBudgetExceededMs)                     \
+  /* Number of GCs started to stay below the memory budget. */                 \
+  SC(memory_budget_gcs, V8.MemoryBudgetGCs)                                    \
   /* Total code size (including metadata) of baseline code or bytecode. */     \
   SC(total_baseline_code_size, V8.TotalBaselineCodeSize)                       \
   /* Total count of functions compiled using the baseline compiler. */         \
   SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)               \
+  /* Total code size of baseline code deserialized from the code cache. */     \
+  SC(total_baseline_code_size_deserialized,                                    \
+     V8.TotalBaselineCodeSizeDeserialized)                                     \
+  /* Total count of functions compiled using Maglev. */                        \
+  SC(maglev_compiled_functions, V8.MaglevCompiledFunctions)                    \
+  /* Total count of Maglev compilations that bailed out. */                    \
+  SC(maglev_compile_bailouts, V8.MaglevCompileBailouts)                        \
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                      \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)
@@ -188,32 +188,15 @@ class MaglevCodeGeneratingNodeProcessor {
 
 class MaglevCodeGeneratorImpl final {
  public:
-  static Handle<Code> Generate(MaglevCompilationUnit* compilation_unit,
-                               Graph* graph) {
-    return MaglevCodeGeneratorImpl(compilation_unit, graph).Generate();
-  }
-
- private:
   MaglevCodeGeneratorImpl(MaglevCompilationUnit* compilation_unit, Graph* graph)
       : safepoint_table_builder_(compilation_unit->zone()),
         code_gen_state_(compilation_unit, safepoint_table_builder()),
         processor_(compilation_unit, &code_gen_state_),
         graph_(graph) {}
 
-  Handle<Code> Generate() {
+  void Assemble() {
     EmitCode();
     EmitMetadata();
-    return BuildCodeObject();
-  }
-
-  void EmitCode() { processor_.ProcessGraph(graph_); }
-
-  void EmitMetadata() {
-    // Final alignment before starting on the metadata section.
-    masm()->Align(Code::kMetadataAlignment);
-
-    safepoint_table_builder()->Emit(masm(),
-                                    stack_slot_count_with_fixed_frame());
   }
 
   Handle<Code> BuildCodeObject() {
@@ -226,6 +209,17 @@ class MaglevCodeGeneratorImpl final {
         .Build();
   }
 
+ private:
+  void EmitCode() { processor_.ProcessGraph(graph_); }
+
+  void EmitMetadata() {
+    // Final alignment before starting on the metadata section.
+    masm()->Align(Code::kMetadataAlignment);
+
+    safepoint_table_builder()->Emit(masm(),
+                                    stack_slot_count_with_fixed_frame());
+  }
+
   int stack_slot_count() const { return code_gen_state_.vreg_slots(); }
   int stack_slot_count_with_fixed_frame() const {
     return stack_slot_count() + StandardFrameConstants::kFixedSlotCount;
@@ -245,10 +239,17 @@ class MaglevCodeGeneratorImpl final {
   Graph* const graph_;
 };
 
-// static
-Handle<Code> MaglevCodeGenerator::Generate(
-    MaglevCompilationUnit* compilation_unit, Graph* graph) {
-  return MaglevCodeGeneratorImpl::Generate(compilation_unit, graph);
+MaglevCodeGenerator::MaglevCodeGenerator(
+    MaglevCompilationUnit* compilation_unit, Graph* graph)
+    : impl_(std::make_unique<MaglevCodeGeneratorImpl>(compilation_unit,
+                                                      graph)) {}
+
+MaglevCodeGenerator::~MaglevCodeGenerator() = default;
+
+void MaglevCodeGenerator::Assemble() { impl_->Assemble(); }
+
+Handle<Code> MaglevCodeGenerator::Generate() {
+  return impl_->BuildCodeObject();
 }
 
 }  // namespace maglev
@@ -5,6 +5,8 @@
 #ifndef V8_MAGLEV_MAGLEV_CODE_GENERATOR_H_
 #define V8_MAGLEV_MAGLEV_CODE_GENERATOR_H_
 
+#include <memory>
+
 #include "src/common/globals.h"
 
 namespace v8 {
@@ -12,12 +14,25 @@ namespace internal {
 namespace maglev {
 
 class Graph;
+class MaglevCodeGeneratorImpl;
 struct MaglevCompilationUnit;
 
-class MaglevCodeGenerator : public AllStatic {
+class MaglevCodeGenerator final {
  public:
-  static Handle<Code> Generate(MaglevCompilationUnit* compilation_unit,
-                               Graph* graph);
+  MaglevCodeGenerator(MaglevCompilationUnit* compilation_unit, Graph* graph);
+  ~MaglevCodeGenerator();
+  MaglevCodeGenerator(const MaglevCodeGenerator&) = delete;
+  MaglevCodeGenerator& operator=(const MaglevCodeGenerator&) = delete;
+
+  // Emits the machine code and its metadata into the assembler buffer. Does
+  // not touch the heap and may run on a background thread.
+  void Assemble();
+
+  // Allocates the Code object for the assembled code. Main thread only.
+  Handle<Code> Generate();
+
+ private:
+  std::unique_ptr<MaglevCodeGeneratorImpl> impl_;
 };
 
 }  // namespace maglev
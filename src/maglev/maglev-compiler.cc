@@ -24,6 +24,7 @@
 #include "src/compiler/js-heap-broker.h"
 #include "src/execution/frames.h"
 #include "src/ic/handler-configuration.h"
+#include "src/logging/counters.h"
 #include "src/maglev/maglev-basic-block.h"
 #include "src/maglev/maglev-code-generator.h"
 #include "src/maglev/maglev-compilation-data.h"
@@ -123,6 +124,9 @@ class UseMarkingProcessor {
     if (checkpoint_state->accumulator()) {
       checkpoint_state->accumulator()->mark_use(use_id, nullptr);
     }
+    ValueNode* context =
+        checkpoint_state->get(interpreter::Register::current_context());
+    if (context) context->mark_use(use_id, nullptr);
   }
 };
 
@@ -131,7 +135,9 @@ MaglevCompiler::MaglevCompiler(compiler::JSHeapBroker* broker,
     : compilation_data_(broker),
       toplevel_compilation_unit_(&compilation_data_, function) {}
 
-Handle<Code> MaglevCompiler::Compile() {
+MaglevCompiler::~MaglevCompiler() = default;
+
+bool MaglevCompiler::Compile() {
   // Build graph.
   if (FLAG_print_maglev_code || FLAG_code_comments || FLAG_print_maglev_graph ||
       FLAG_trace_maglev_regalloc) {
@@ -142,6 +148,11 @@ Handle<Code> MaglevCompiler::Compile() {
 
   graph_builder.Build();
 
+  if (graph_builder.found_unsupported_bytecode()) {
+    isolate()->counters()->maglev_compile_bailouts()->Increment();
+    return false;
+  }
+
   if (FLAG_print_maglev_graph) {
     std::cout << "After graph buiding" << std::endl;
     PrintGraph(std::cout, &toplevel_compilation_unit_, graph_builder.graph());
@@ -167,12 +178,18 @@ Handle<Code> MaglevCompiler::Compile() {
     PrintGraph(std::cout, &toplevel_compilation_unit_, graph_builder.graph());
   }
 
-  Handle<Code> code = MaglevCodeGenerator::Generate(&toplevel_compilation_unit_,
-                                                    graph_builder.graph());
+  code_generator_ = std::make_unique<MaglevCodeGenerator>(
+      &toplevel_compilation_unit_, graph_builder.graph());
+  code_generator_->Assemble();
+  isolate()->counters()->maglev_compiled_functions()->Increment();
+  return true;
+}
+
+MaybeHandle<Code> MaglevCompiler::GenerateCode() {
+  DCHECK_NOT_NULL(code_generator_);
+  Handle<Code> code = code_generator_->Generate();
 
-  const bool deps_committed_successfully =
-      broker()->dependencies()->Commit(code);
-  CHECK(deps_committed_successfully);
+  if (!broker()->dependencies()->Commit(code)) return {};
 
   if (FLAG_print_maglev_code) {
     code->Print();
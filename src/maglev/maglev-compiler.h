@@ -5,6 +5,8 @@
 #ifndef V8_MAGLEV_MAGLEV_COMPILER_H_
 #define V8_MAGLEV_MAGLEV_COMPILER_H_
 
+#include <memory>
+
 #include "src/common/globals.h"
 #include "src/compiler/bytecode-analysis.h"
 #include "src/compiler/heap-refs.h"
@@ -19,12 +21,23 @@ class JSHeapBroker;
 
 namespace maglev {
 
+class MaglevCodeGenerator;
+
 class MaglevCompiler {
  public:
   explicit MaglevCompiler(compiler::JSHeapBroker* broker,
                           Handle<JSFunction> function);
+  ~MaglevCompiler();
+
+  // Builds the graph, allocates registers and assembles the code. Only reads
+  // the heap through the broker, so it may run on a background thread.
+  // Returns false if the function uses bytecodes Maglev doesn't support yet.
+  bool Compile();
 
-  Handle<Code> Compile();
+  // Allocates the Code object and commits the compilation dependencies. Main
+  // thread only. Returns an empty handle if the dependencies were invalidated
+  // since the job was prepared.
+  MaybeHandle<Code> GenerateCode();
 
   compiler::JSHeapBroker* broker() const { return compilation_data_.broker; }
   Zone* zone() { return &compilation_data_.zone; }
@@ -33,6 +46,7 @@ class MaglevCompiler {
  private:
   MaglevCompilationData compilation_data_;
   MaglevCompilationUnit toplevel_compilation_unit_;
+  std::unique_ptr<MaglevCodeGenerator> code_generator_;
 };
 
 }  // namespace maglev
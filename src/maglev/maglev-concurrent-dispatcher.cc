@@ -0,0 +1,204 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/maglev/maglev-concurrent-dispatcher.h"
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/compiler/compilation-dependencies.h"
+#include "src/compiler/js-heap-broker.h"
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate.h"
+#include "src/flags/flags.h"
+#include "src/handles/local-handles-inl.h"
+#include "src/handles/persistent-handles.h"
+#include "src/heap/local-heap.h"
+#include "src/heap/parked-scope.h"
+#include "src/init/v8.h"
+#include "src/logging/runtime-call-stats-scope.h"
+#include "src/maglev/maglev-compiler.h"
+#include "src/objects/js-function-inl.h"
+#include "src/tracing/trace-event.h"
+#include "src/utils/locked-queue-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+// static
+std::unique_ptr<MaglevCompilationJob> MaglevCompilationJob::New(
+    Isolate* isolate, Handle<JSFunction> function) {
+  return std::unique_ptr<MaglevCompilationJob>(
+      new MaglevCompilationJob(isolate, function));
+}
+
+MaglevCompilationJob::MaglevCompilationJob(Isolate* isolate,
+                                           Handle<JSFunction> function)
+    // Note that the OptimizedCompilationInfo is not initialized at the time
+    // we pass it to the CompilationJob constructor, but it is not
+    // dereferenced there.
+    : OptimizedCompilationJob(&compilation_info_, "Maglev"),
+      zone_(isolate->allocator(), "maglev-compilation-job-zone"),
+      compilation_info_(&zone_, isolate, handle(function->shared(), isolate),
+                        function, CodeKind::MAGLEV),
+      broker_(std::make_unique<compiler::JSHeapBroker>(
+          isolate, &zone_, FLAG_trace_heap_broker, CodeKind::MAGLEV)) {}
+
+MaglevCompilationJob::~MaglevCompilationJob() = default;
+
+CompilationJob::Status MaglevCompilationJob::PrepareJobImpl(Isolate* isolate) {
+  // Initializing the broker may already use IsPendingAllocation.
+  isolate->heap()->PublishPendingAllocations();
+
+  compiler::CompilationDependencies* deps =
+      zone_.New<compiler::CompilationDependencies>(broker_.get(), &zone_);
+  USE(deps);  // The deps register themselves in the heap broker.
+
+  broker_->SetTargetNativeContextRef(
+      handle(compilation_info_.closure()->native_context(), isolate));
+  broker_->InitializeAndStartSerializing();
+  broker_->StopSerializing();
+
+  // Creates the refs to the bytecode and feedback vector and analyzes the
+  // bytecode.
+  compiler_ = std::make_unique<MaglevCompiler>(broker_.get(),
+                                               compilation_info_.closure());
+
+  // Serialization may have allocated.
+  isolate->heap()->PublishPendingAllocations();
+
+  return SUCCEEDED;
+}
+
+CompilationJob::Status MaglevCompilationJob::ExecuteJobImpl(
+    RuntimeCallStats* stats, LocalIsolate* local_isolate) {
+  base::ElapsedTimer timer;
+  timer.Start();
+  broker_->AttachLocalIsolate(&compilation_info_, local_isolate);
+  bool success;
+  {
+    compiler::UnparkedScopeIfNeeded unparked_scope(broker_.get());
+    LocalHandleScope handle_scope(local_isolate);
+    success = compiler_->Compile();
+  }
+  broker_->DetachLocalIsolate(&compilation_info_);
+  compile_time_ = timer.Elapsed();
+  if (!success) return RetryOptimization(BailoutReason::kGraphBuildingFailed);
+  return SUCCEEDED;
+}
+
+CompilationJob::Status MaglevCompilationJob::FinalizeJobImpl(Isolate* isolate) {
+  Handle<Code> code;
+  if (!compiler_->GenerateCode().ToHandle(&code)) {
+    return RetryOptimization(BailoutReason::kBailedOutDueToDependencyChange);
+  }
+  compilation_info_.SetCode(code);
+  return SUCCEEDED;
+}
+
+class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
+ public:
+  explicit JobTask(MaglevConcurrentDispatcher* dispatcher)
+      : dispatcher_(dispatcher) {}
+
+  void Run(JobDelegate* delegate) override {
+    Isolate* isolate = dispatcher_->isolate_;
+    LocalIsolate local_isolate(isolate, ThreadKind::kBackground);
+    DCHECK(local_isolate.heap()->IsParked());
+
+    while (!incoming_queue()->IsEmpty() && !delegate->ShouldYield()) {
+      std::unique_ptr<MaglevCompilationJob> job;
+      if (!incoming_queue()->Dequeue(&job)) break;
+      DCHECK_NOT_NULL(job);
+      job->queue_wait_time_ = base::TimeTicks::Now() - job->enqueue_time_;
+      {
+        RCS_SCOPE(&local_isolate,
+                  RuntimeCallCounterId::kMaglevBackgroundDispatcherJob);
+        TRACE_EVENT_WITH_FLOW1(
+            TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.MaglevBackground",
+            job.get(), TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT,
+            "queue_wait_us", job->queue_wait_time_.InMicroseconds());
+        CompilationJob::Status status =
+            job->ExecuteJob(local_isolate.runtime_call_stats(), &local_isolate);
+        // Failed jobs are finalized as well, to clear the optimization marker
+        // of their function.
+        USE(status);
+      }
+      outgoing_queue()->Enqueue(std::move(job));
+      isolate->stack_guard()->RequestInstallMaglevCode();
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return incoming_queue()->size();
+  }
+
+ private:
+  LockedQueue<std::unique_ptr<MaglevCompilationJob>>* incoming_queue() const {
+    return &dispatcher_->incoming_queue_;
+  }
+  LockedQueue<std::unique_ptr<MaglevCompilationJob>>* outgoing_queue() const {
+    return &dispatcher_->outgoing_queue_;
+  }
+
+  MaglevConcurrentDispatcher* const dispatcher_;
+};
+
+MaglevConcurrentDispatcher::MaglevConcurrentDispatcher(Isolate* isolate)
+    : isolate_(isolate) {
+  if (FLAG_concurrent_recompilation && FLAG_maglev) {
+    job_handle_ = PostJob();
+  }
+}
+
+MaglevConcurrentDispatcher::~MaglevConcurrentDispatcher() {
+  if (is_enabled() && job_handle_->IsValid()) {
+    // Wait for the job handle to complete, so that we know the queue
+    // pointers are safe.
+    job_handle_->Cancel();
+  }
+}
+
+std::unique_ptr<JobHandle> MaglevConcurrentDispatcher::PostJob() {
+  return V8::GetCurrentPlatform()->PostJob(TaskPriority::kUserVisible,
+                                           std::make_unique<JobTask>(this));
+}
+
+void MaglevConcurrentDispatcher::EnqueueJob(
+    std::unique_ptr<MaglevCompilationJob> job) {
+  DCHECK(is_enabled());
+  DCHECK_EQ(job->state(), CompilationJob::State::kReadyToExecute);
+  TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                         "V8.MaglevEnqueueJob", job.get(),
+                         TRACE_EVENT_FLAG_FLOW_OUT);
+  job->MarkEnqueued();
+  incoming_queue_.Enqueue(std::move(job));
+  job_handle_->NotifyConcurrencyIncrease();
+}
+
+void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
+  HandleScope handle_scope(isolate_);
+  while (!outgoing_queue_.IsEmpty()) {
+    std::unique_ptr<MaglevCompilationJob> job;
+    if (!outgoing_queue_.Dequeue(&job)) break;
+    Compiler::FinalizeMaglevCompilationJob(job.get(), isolate_);
+  }
+}
+
+void MaglevConcurrentDispatcher::AwaitCompileJobs() {
+  DCHECK(is_enabled());
+  {
+    // Join contributes this thread to the job and returns once the incoming
+    // queue has been drained. Park meanwhile so that we don't block
+    // safepoints.
+    ParkedScope parked_scope(isolate_->main_thread_local_isolate());
+    job_handle_->Join();
+  }
+  // Join invalidates the job handle, post a new job for later work.
+  job_handle_ = PostJob();
+  DCHECK(incoming_queue_.IsEmpty());
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
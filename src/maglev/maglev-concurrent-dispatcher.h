@@ -0,0 +1,109 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_MAGLEV_MAGLEV_CONCURRENT_DISPATCHER_H_
+#define V8_MAGLEV_MAGLEV_CONCURRENT_DISPATCHER_H_
+
+#ifdef V8_ENABLE_MAGLEV
+
+#include <memory>
+
+#include "src/base/platform/time.h"
+#include "src/codegen/compiler.h"
+#include "src/codegen/optimized-compilation-info.h"
+#include "src/utils/locked-queue.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+
+class JobHandle;
+
+namespace internal {
+
+namespace compiler {
+class JSHeapBroker;
+}  // namespace compiler
+
+namespace maglev {
+
+class MaglevCompiler;
+
+// A Maglev compilation that is prepared on the main thread, compiled on a
+// background thread and finalized on the main thread again. The heap is only
+// read through the JSHeapBroker while executing, whose handles are kept in
+// the PersistentHandles of the compilation info between the phases.
+class MaglevCompilationJob final : public OptimizedCompilationJob {
+ public:
+  static std::unique_ptr<MaglevCompilationJob> New(Isolate* isolate,
+                                                   Handle<JSFunction> function);
+  ~MaglevCompilationJob() override;
+
+  // Time spent in the incoming queue of the dispatcher.
+  base::TimeDelta queue_wait_time() const { return queue_wait_time_; }
+  // Time spent compiling on the background thread.
+  base::TimeDelta compile_time() const { return compile_time_; }
+
+ protected:
+  Status PrepareJobImpl(Isolate* isolate) override;
+  Status ExecuteJobImpl(RuntimeCallStats* stats,
+                        LocalIsolate* local_isolate) override;
+  Status FinalizeJobImpl(Isolate* isolate) override;
+
+ private:
+  MaglevCompilationJob(Isolate* isolate, Handle<JSFunction> function);
+
+  void MarkEnqueued() { enqueue_time_ = base::TimeTicks::Now(); }
+
+  Zone zone_;
+  OptimizedCompilationInfo compilation_info_;
+  std::unique_ptr<compiler::JSHeapBroker> broker_;
+  std::unique_ptr<MaglevCompiler> compiler_;
+  base::TimeTicks enqueue_time_;
+  base::TimeDelta queue_wait_time_;
+  base::TimeDelta compile_time_;
+
+  friend class MaglevConcurrentDispatcher;
+};
+
+// Runs MaglevCompilationJobs on background threads. Finished jobs are handed
+// back to the main thread through an INSTALL_MAGLEV_CODE interrupt, which
+// finalizes them and installs their code.
+class MaglevConcurrentDispatcher final {
+ public:
+  explicit MaglevConcurrentDispatcher(Isolate* isolate);
+  ~MaglevConcurrentDispatcher();
+  MaglevConcurrentDispatcher(const MaglevConcurrentDispatcher&) = delete;
+  MaglevConcurrentDispatcher& operator=(const MaglevConcurrentDispatcher&) =
+      delete;
+
+  // Background compilation is only available with concurrent recompilation.
+  bool is_enabled() const { return static_cast<bool>(job_handle_); }
+
+  // Takes ownership of a prepared job and schedules it for compilation. Main
+  // thread only.
+  void EnqueueJob(std::unique_ptr<MaglevCompilationJob> job);
+
+  // Finalizes all jobs that finished compiling. Main thread only.
+  void FinalizeFinishedJobs();
+
+  // Blocks until all enqueued jobs finished compiling. For testing.
+  void AwaitCompileJobs();
+
+ private:
+  class JobTask;
+
+  std::unique_ptr<JobHandle> PostJob();
+
+  Isolate* const isolate_;
+  std::unique_ptr<JobHandle> job_handle_;
+  LockedQueue<std::unique_ptr<MaglevCompilationJob>> incoming_queue_;
+  LockedQueue<std::unique_ptr<MaglevCompilationJob>> outgoing_queue_;
+};
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ENABLE_MAGLEV
+#endif  // V8_MAGLEV_MAGLEV_CONCURRENT_DISPATCHER_H_
@@ -6,17 +6,240 @@
 
 #include "src/compiler/feedback-source.h"
 #include "src/compiler/heap-refs.h"
+#include "src/flags/flags.h"
 #include "src/handles/maybe-handles-inl.h"
 #include "src/ic/handler-configuration.h"
+#include "src/interpreter/bytecode-flags.h"
+#include "src/objects/contexts.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/slots-inl.h"
+#include "src/utils/ostreams.h"
 
 namespace v8 {
 namespace internal {
 
 namespace maglev {
 
+namespace {
+
+template <Operation kOperation>
+struct NodeForOperationHelper;
+
+#define NODE_FOR_OPERATION_HELPER(Name)               \
+  template <>                                         \
+  struct NodeForOperationHelper<Operation::k##Name> { \
+    using generic_type = Generic##Name;               \
+  };
+OPERATION_LIST(NODE_FOR_OPERATION_HELPER)
+#undef NODE_FOR_OPERATION_HELPER
+
+template <Operation kOperation>
+using GenericNodeForOperation =
+    typename NodeForOperationHelper<kOperation>::generic_type;
+
+}  // namespace
+
+// Bytecodes that aren't supported yet make the graph builder bail out, so
+// that the function simply stays in the lower tiers.
+#define MAGLEV_UNIMPLEMENTED_BYTECODE(Name) \
+  void MaglevGraphBuilder::Visit##Name() { MarkBytecodeUnsupported(#Name); }
+
+void MaglevGraphBuilder::MarkBytecodeUnsupported(const char* bytecode_name) {
+  if (FLAG_trace_maglev_bailouts) {
+    StdoutStream{} << "[maglev] bailing out, unsupported bytecode "
+                   << bytecode_name << " at offset "
+                   << iterator_.current_offset() << std::endl;
+  }
+  found_unsupported_bytecode_ = true;
+}
+
+ValueNode* MaglevGraphBuilder::BuildContextAtDepth(ValueNode* context,
+                                                   size_t depth) {
+  for (size_t i = 0; i < depth; ++i) {
+    context = AddNewNode<LoadTaggedField>(
+        {context}, Context::OffsetOfElementAt(Context::PREVIOUS_INDEX));
+  }
+  return context;
+}
+
+void MaglevGraphBuilder::BuildLoadContextSlot(ValueNode* context,
+                                              size_t depth, int slot_index) {
+  context = BuildContextAtDepth(context, depth);
+  SetAccumulator(AddNewNode<LoadTaggedField>(
+      {context}, Context::OffsetOfElementAt(slot_index)));
+}
+
+void MaglevGraphBuilder::BuildStoreContextSlot(ValueNode* context,
+                                               size_t depth, int slot_index) {
+  context = BuildContextAtDepth(context, depth);
+  AddNewNode<StoreTaggedFieldWithWriteBarrier>(
+      {context, GetAccumulator()}, Context::OffsetOfElementAt(slot_index));
+  MarkPossibleSideEffect();
+}
+
+bool MaglevGraphBuilder::TryBuildFieldLoad(ValueNode* object,
+                                           const FeedbackNexus& nexus) {
+  std::vector<MapAndHandler> maps_and_handlers;
+  nexus.ExtractMapsAndHandlers(&maps_and_handlers);
+  if (maps_and_handlers.empty()) return false;
+
+  // All maps have to share the same field handler, so that a single load
+  // works for all of them after the map check.
+  ZoneVector<compiler::MapRef> maps(zone());
+  base::Optional<int> handler;
+  for (MapAndHandler& map_and_handler : maps_and_handlers) {
+    if (!map_and_handler.second->IsSmi()) return false;
+    int current_handler = map_and_handler.second->ToSmi().value();
+    if (handler.has_value() && handler.value() != current_handler) {
+      return false;
+    }
+    handler = current_handler;
+    maps.push_back(MakeRef(broker(), map_and_handler.first));
+  }
+
+  LoadHandler::Kind kind = LoadHandler::KindBits::decode(handler.value());
+  if (kind != LoadHandler::Kind::kField ||
+      LoadHandler::IsWasmStructBits::decode(handler.value()) ||
+      !LoadHandler::IsInobjectBits::decode(handler.value()) ||
+      LoadHandler::IsDoubleBits::decode(handler.value())) {
+    return false;
+  }
+
+  if (maps.size() == 1) {
+    EnsureCheckpoint();
+    AddNewNode<CheckMaps>({object}, maps[0]);
+  } else {
+    // Polymorphic map checks don't try to migrate deprecated instances.
+    for (const compiler::MapRef& map : maps) {
+      if (map.is_migration_target()) return false;
+    }
+    EnsureCheckpoint();
+    AddNewNode<CheckMapsPolymorphic>({object}, std::move(maps));
+  }
+  SetAccumulator(AddNewNode<LoadField>({object}, handler.value()));
+  return true;
+}
+
+void MaglevGraphBuilder::BuildCallFromRegisterList(
+    ConvertReceiverMode receiver_mode) {
+  ValueNode* function = LoadRegister(0);
+  interpreter::RegisterList args = iterator_.GetRegisterListOperand(1);
+  ValueNode* context = GetContext();
+
+  // An undefined receiver is implicit, and not part of the register list.
+  ValueNode* undefined_receiver = nullptr;
+  size_t input_count = args.register_count() + Call::kFixedInputCount;
+  if (receiver_mode == ConvertReceiverMode::kNullOrUndefined) {
+    undefined_receiver =
+        AddNewNode<RootConstant>({}, RootIndex::kUndefinedValue);
+    input_count++;
+  }
+
+  Call* call = AddNewNode<Call>(input_count, receiver_mode, function, context);
+  int arg_index = 0;
+  if (undefined_receiver != nullptr) {
+    call->set_arg(arg_index++, undefined_receiver);
+  }
+  for (int i = 0; i < args.register_count(); ++i) {
+    call->set_arg(arg_index++, current_interpreter_frame_.get(args[i]));
+  }
+
+  SetAccumulator(call);
+  MarkPossibleSideEffect();
+}
+
+void MaglevGraphBuilder::BuildCallFromRegisters(
+    int argc_count, ConvertReceiverMode receiver_mode) {
+  // The function is the first register operand, followed by the arguments
+  // (including the receiver, unless it is implicitly undefined).
+  ValueNode* function = LoadRegister(0);
+  ValueNode* context = GetContext();
+
+  // An explicit receiver is passed in a register ahead of the arguments.
+  int register_count = argc_count;
+  ValueNode* undefined_receiver = nullptr;
+  if (receiver_mode == ConvertReceiverMode::kNullOrUndefined) {
+    undefined_receiver =
+        AddNewNode<RootConstant>({}, RootIndex::kUndefinedValue);
+  } else {
+    register_count++;
+  }
+  size_t input_count = argc_count + 1 + Call::kFixedInputCount;
+
+  Call* call = AddNewNode<Call>(input_count, receiver_mode, function, context);
+  int arg_index = 0;
+  if (undefined_receiver != nullptr) {
+    call->set_arg(arg_index++, undefined_receiver);
+  }
+  for (int i = 0; i < register_count; ++i) {
+    call->set_arg(arg_index++, LoadRegister(i + 1));
+  }
+
+  SetAccumulator(call);
+  MarkPossibleSideEffect();
+}
+
+void MaglevGraphBuilder::BuildCallRuntime(
+    Runtime::FunctionId function_id, std::initializer_list<ValueNode*> args) {
+  ValueNode* context = GetContext();
+  CallRuntime* call_runtime = AddNewNode<CallRuntime>(
+      args.size() + CallRuntime::kFixedInputCount, function_id, context);
+  int arg_index = 0;
+  for (ValueNode* arg : args) {
+    call_runtime->set_arg(arg_index++, arg);
+  }
+
+  SetAccumulator(call_runtime);
+  MarkPossibleSideEffect();
+}
+
+template <Operation kOperation>
+void MaglevGraphBuilder::BuildGenericUnaryOperationNode() {
+  FeedbackSlot slot_index = GetSlotOperand(0);
+  ValueNode* value = GetAccumulator();
+  SetAccumulator(AddNewNode<GenericNodeForOperation<kOperation>>(
+      {value}, compiler::FeedbackSource{feedback(), slot_index}));
+  MarkPossibleSideEffect();
+}
+
+template <Operation kOperation>
+void MaglevGraphBuilder::BuildGenericBinaryOperationNode() {
+  ValueNode* left = LoadRegister(0);
+  FeedbackSlot slot_index = GetSlotOperand(1);
+  ValueNode* right = GetAccumulator();
+  SetAccumulator(AddNewNode<GenericNodeForOperation<kOperation>>(
+      {left, right}, compiler::FeedbackSource{feedback(), slot_index}));
+  MarkPossibleSideEffect();
+}
+
+template <Operation kOperation>
+void MaglevGraphBuilder::BuildGenericBinarySmiOperationNode() {
+  ValueNode* left = GetAccumulator();
+  Smi constant = Smi::FromInt(iterator_.GetImmediateOperand(0));
+  ValueNode* right = AddNewNode<SmiConstant>({}, constant);
+  FeedbackSlot slot_index = GetSlotOperand(1);
+  SetAccumulator(AddNewNode<GenericNodeForOperation<kOperation>>(
+      {left, right}, compiler::FeedbackSource{feedback(), slot_index}));
+  MarkPossibleSideEffect();
+}
+
+// TODO(v8:7700): Use the type feedback to emit specialized operations.
+template <Operation kOperation>
+void MaglevGraphBuilder::VisitUnaryOperation() {
+  BuildGenericUnaryOperationNode<kOperation>();
+}
+
+template <Operation kOperation>
+void MaglevGraphBuilder::VisitBinaryOperation() {
+  BuildGenericBinaryOperationNode<kOperation>();
+}
+
+template <Operation kOperation>
+void MaglevGraphBuilder::VisitBinarySmiOperation() {
+  BuildGenericBinarySmiOperationNode<kOperation>();
+}
+
 void MaglevGraphBuilder::VisitLdar() { SetAccumulator(LoadRegister(0)); }
 
 void MaglevGraphBuilder::VisitLdaZero() {
@@ -41,12 +264,34 @@ void MaglevGraphBuilder::VisitLdaTrue() {
 void MaglevGraphBuilder::VisitLdaFalse() {
   SetAccumulator(AddNewNode<RootConstant>({}, RootIndex::kFalseValue));
 }
-void MaglevGraphBuilder::VisitLdaConstant() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaContextSlot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaImmutableContextSlot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaCurrentContextSlot() { UNREACHABLE(); }
+void MaglevGraphBuilder::VisitLdaConstant() {
+  // LdaConstant <idx>
+  compiler::ObjectRef constant = GetRefOperand<Object>(0);
+  if (constant.IsSmi()) {
+    SetAccumulator(
+        AddNewNode<SmiConstant>({}, Smi::FromInt(constant.AsSmi())));
+  } else {
+    SetAccumulator(AddNewNode<Constant>({}, constant.AsHeapObject()));
+  }
+}
+void MaglevGraphBuilder::VisitLdaContextSlot() {
+  // LdaContextSlot <context> <slot_index> <depth>
+  ValueNode* context = LoadRegister(0);
+  int slot_index = iterator_.GetIndexOperand(1);
+  size_t depth = iterator_.GetUnsignedImmediateOperand(2);
+  BuildLoadContextSlot(context, depth, slot_index);
+}
+void MaglevGraphBuilder::VisitLdaImmutableContextSlot() {
+  // TODO(v8:7700): Constant-fold immutable slots of known contexts.
+  VisitLdaContextSlot();
+}
+void MaglevGraphBuilder::VisitLdaCurrentContextSlot() {
+  // LdaCurrentContextSlot <slot_index>
+  int slot_index = iterator_.GetIndexOperand(0);
+  BuildLoadContextSlot(GetContext(), 0, slot_index);
+}
 void MaglevGraphBuilder::VisitLdaImmutableCurrentContextSlot() {
-  UNREACHABLE();
+  VisitLdaCurrentContextSlot();
 }
 void MaglevGraphBuilder::VisitStar() {
   StoreRegister(
@@ -58,13 +303,21 @@ void MaglevGraphBuilder::VisitMov() {
       iterator_.GetRegisterOperand(1), LoadRegister(0),
       bytecode_analysis().GetOutLivenessFor(iterator_.current_offset()));
 }
-void MaglevGraphBuilder::VisitPushContext() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitPopContext() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestReferenceEqual() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestUndetectable() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestNull() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestUndefined() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestTypeOf() { UNREACHABLE(); }
+void MaglevGraphBuilder::VisitPushContext() {
+  // PushContext <context>
+  StoreRegister(iterator_.GetRegisterOperand(0), GetContext(),
+                GetOutLiveness());
+  SetContext(GetAccumulator());
+}
+void MaglevGraphBuilder::VisitPopContext() {
+  // PopContext <context>
+  SetContext(LoadRegister(0));
+}
+MAGLEV_UNIMPLEMENTED_BYTECODE(TestReferenceEqual)
+MAGLEV_UNIMPLEMENTED_BYTECODE(TestUndetectable)
+MAGLEV_UNIMPLEMENTED_BYTECODE(TestNull)
+MAGLEV_UNIMPLEMENTED_BYTECODE(TestUndefined)
+MAGLEV_UNIMPLEMENTED_BYTECODE(TestTypeOf)
 void MaglevGraphBuilder::VisitLdaGlobal() {
   // LdaGlobal <name_index> <slot>
 
@@ -80,215 +333,393 @@ void MaglevGraphBuilder::VisitLdaGlobal() {
   SetAccumulator(AddNewNode<LoadGlobal>({context}, name));
   MarkPossibleSideEffect();
 }
-void MaglevGraphBuilder::VisitLdaGlobalInsideTypeof() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaGlobal() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaContextSlot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaCurrentContextSlot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaLookupSlot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaLookupContextSlot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaLookupGlobalSlot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaLookupSlotInsideTypeof() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaLookupContextSlotInsideTypeof() {
-  UNREACHABLE();
-}
-void MaglevGraphBuilder::VisitLdaLookupGlobalSlotInsideTypeof() {
-  UNREACHABLE();
-}
-void MaglevGraphBuilder::VisitStaLookupSlot() { UNREACHABLE(); }
+MAGLEV_UNIMPLEMENTED_BYTECODE(LdaGlobalInsideTypeof)
+MAGLEV_UNIMPLEMENTED_BYTECODE(StaGlobal)
+void MaglevGraphBuilder::VisitStaContextSlot() {
+  // StaContextSlot <context> <slot_index> <depth>
+  ValueNode* context = LoadRegister(0);
+  int slot_index = iterator_.GetIndexOperand(1);
+  size_t depth = iterator_.GetUnsignedImmediateOperand(2);
+  BuildStoreContextSlot(context, depth, slot_index);
+}
+void MaglevGraphBuilder::VisitStaCurrentContextSlot() {
+  // StaCurrentContextSlot <slot_index>
+  int slot_index = iterator_.GetIndexOperand(0);
+  BuildStoreContextSlot(GetContext(), 0, slot_index);
+}
+MAGLEV_UNIMPLEMENTED_BYTECODE(LdaLookupSlot)
+MAGLEV_UNIMPLEMENTED_BYTECODE(LdaLookupContextSlot)
+MAGLEV_UNIMPLEMENTED_BYTECODE(LdaLookupGlobalSlot)
+MAGLEV_UNIMPLEMENTED_BYTECODE(LdaLookupSlotInsideTypeof)
+MAGLEV_UNIMPLEMENTED_BYTECODE(LdaLookupContextSlotInsideTypeof)
+MAGLEV_UNIMPLEMENTED_BYTECODE(LdaLookupGlobalSlotInsideTypeof)
+MAGLEV_UNIMPLEMENTED_BYTECODE(StaLookupSlot)
 void MaglevGraphBuilder::VisitLdaNamedProperty() {
   // LdaNamedProperty <object> <name_index> <slot>
   ValueNode* object = LoadRegister(0);
+  compiler::NameRef name = GetRefOperand<Name>(1);
+  FeedbackSlot slot_index = GetSlotOperand(2);
 
-  // TODO(leszeks): Use JSHeapBroker here.
-  FeedbackNexus nexus(feedback().object() /* TODO(v8:7700) */,
-                      GetSlotOperand(2));
+  // Read the feedback through the broker's nexus config, so that handles for
+  // the maps are created in the local heap when running off the main thread.
+  FeedbackNexus nexus(feedback().object(), slot_index,
+                      broker()->feedback_nexus_config());
 
   if (nexus.ic_state() == InlineCacheState::UNINITIALIZED) {
     EnsureCheckpoint();
     AddNewNode<SoftDeopt>({});
+  } else if (nexus.ic_state() == InlineCacheState::MONOMORPHIC ||
+             nexus.ic_state() == InlineCacheState::POLYMORPHIC) {
+    if (TryBuildFieldLoad(object, nexus)) return;
   }
 
-  if (nexus.ic_state() == InlineCacheState::MONOMORPHIC) {
-    std::vector<MapAndHandler> maps_and_handlers;
-    nexus.ExtractMapsAndHandlers(&maps_and_handlers);
-    DCHECK_EQ(maps_and_handlers.size(), 1);
-    MapAndHandler& map_and_handler = maps_and_handlers[0];
-    if (map_and_handler.second->IsSmi()) {
-      int handler = map_and_handler.second->ToSmi().value();
-      LoadHandler::Kind kind = LoadHandler::KindBits::decode(handler);
-      if (kind == LoadHandler::Kind::kField &&
-          !LoadHandler::IsWasmStructBits::decode(handler)) {
-        EnsureCheckpoint();
-        AddNewNode<CheckMaps>({object},
-                              MakeRef(broker(), map_and_handler.first));
-        SetAccumulator(AddNewNode<LoadField>({object}, handler));
-        return;
-      }
-    }
-  }
+  ValueNode* context = GetContext();
+  SetAccumulator(AddNewNode<LoadNamedGeneric>(
+      {context, object}, name,
+      compiler::FeedbackSource{feedback(), slot_index}));
+  MarkPossibleSideEffect();
+}
+MAGLEV_UNIMPLEMENTED_BYTECODE(LdaNamedPropertyFromSuper)
+void MaglevGraphBuilder::VisitLdaKeyedProperty() {
+  // LdaKeyedProperty <object> <slot>
+  ValueNode* object = LoadRegister(0);
+  ValueNode* key = GetAccumulator();
+  FeedbackSlot slot_index = GetSlotOperand(1);
+  ValueNode* context = GetContext();
 
-  compiler::NameRef name = GetRefOperand<Name>(1);
-  SetAccumulator(AddNewNode<LoadNamedGeneric>({object}, name));
+  // TODO(v8:7700): Use the element access feedback.
+  SetAccumulator(AddNewNode<LoadKeyedGeneric>(
+      {context, object, key},
+      compiler::FeedbackSource{feedback(), slot_index}));
   MarkPossibleSideEffect();
 }
-void MaglevGraphBuilder::VisitLdaNamedPropertyFromSuper() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaKeyedProperty() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLdaModuleVariable() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaModuleVariable() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaNamedProperty() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaNamedOwnProperty() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaKeyedProperty() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaKeyedPropertyAsDefine() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaInArrayLiteral() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitStaDataPropertyInLiteral() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCollectTypeProfile() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitAdd() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitSub() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitMul() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitDiv() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitMod() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitExp() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitBitwiseOr() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitBitwiseXor() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitBitwiseAnd() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitShiftLeft() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitShiftRight() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitShiftRightLogical() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitAddSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitSubSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitMulSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitDivSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitModSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitExpSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitBitwiseOrSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitBitwiseXorSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitBitwiseAndSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitShiftLeftSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitShiftRightSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitShiftRightLogicalSmi() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitInc() {
-  // Inc <slot>
+MAGLEV_UNIMPLEMENTED_BYTECODE(LdaModuleVariable)
+MAGLEV_UNIMPLEMENTED_BYTECODE(StaModuleVariable)
+void MaglevGraphBuilder::VisitStaNamedProperty() {
+  // StaNamedProperty <object> <name_index> <slot>
+  ValueNode* object = LoadRegister(0);
+  compiler::NameRef name = GetRefOperand<Name>(1);
+  FeedbackSlot slot_index = GetSlotOperand(2);
+  ValueNode* context = GetContext();
 
-  FeedbackSlot slot_index = GetSlotOperand(0);
-  ValueNode* value = GetAccumulator();
+  // TODO(v8:7700): Use the feedback to emit field stores.
+  AddNewNode<StoreNamedGeneric>(
+      {context, object, GetAccumulator()}, name,
+      compiler::FeedbackSource{feedback(), slot_index});
+  MarkPossibleSideEffect();
+}
+MAGLEV_UNIMPLEMENTED_BYTECODE(StaNamedOwnProperty)
+void MaglevGraphBuilder::VisitStaKeyedProperty() {
+  // StaKeyedProperty <object> <key> <slot>
+  ValueNode* object = LoadRegister(0);
+  ValueNode* key = LoadRegister(1);
+  FeedbackSlot slot_index = GetSlotOperand(2);
+  ValueNode* context = GetContext();
 
-  ValueNode* node = AddNewNode<Increment>(
-      {value}, compiler::FeedbackSource{feedback(), slot_index});
-  SetAccumulator(node);
+  AddNewNode<StoreKeyedGeneric>(
+      {context, object, key, GetAccumulator()},
+      compiler::FeedbackSource{feedback(), slot_index});
   MarkPossibleSideEffect();
 }
-void MaglevGraphBuilder::VisitDec() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitNegate() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitBitwiseNot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitToBooleanLogicalNot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitLogicalNot() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTypeOf() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitDeletePropertyStrict() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitDeletePropertySloppy() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitGetSuperConstructor() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCallAnyReceiver() { UNREACHABLE(); }
+MAGLEV_UNIMPLEMENTED_BYTECODE(StaKeyedPropertyAsDefine)
+MAGLEV_UNIMPLEMENTED_BYTECODE(StaInArrayLiteral)
+MAGLEV_UNIMPLEMENTED_BYTECODE(StaDataPropertyInLiteral)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CollectTypeProfile)
+void MaglevGraphBuilder::VisitAdd() {
+  VisitBinaryOperation<Operation::kAdd>();
+}
+void MaglevGraphBuilder::VisitSub() {
+  VisitBinaryOperation<Operation::kSubtract>();
+}
+void MaglevGraphBuilder::VisitMul() {
+  VisitBinaryOperation<Operation::kMultiply>();
+}
+void MaglevGraphBuilder::VisitDiv() {
+  VisitBinaryOperation<Operation::kDivide>();
+}
+void MaglevGraphBuilder::VisitMod() {
+  VisitBinaryOperation<Operation::kModulus>();
+}
+void MaglevGraphBuilder::VisitExp() {
+  VisitBinaryOperation<Operation::kExponentiate>();
+}
+void MaglevGraphBuilder::VisitBitwiseOr() {
+  VisitBinaryOperation<Operation::kBitwiseOr>();
+}
+void MaglevGraphBuilder::VisitBitwiseXor() {
+  VisitBinaryOperation<Operation::kBitwiseXor>();
+}
+void MaglevGraphBuilder::VisitBitwiseAnd() {
+  VisitBinaryOperation<Operation::kBitwiseAnd>();
+}
+void MaglevGraphBuilder::VisitShiftLeft() {
+  VisitBinaryOperation<Operation::kShiftLeft>();
+}
+void MaglevGraphBuilder::VisitShiftRight() {
+  VisitBinaryOperation<Operation::kShiftRight>();
+}
+void MaglevGraphBuilder::VisitShiftRightLogical() {
+  VisitBinaryOperation<Operation::kShiftRightLogical>();
+}
+void MaglevGraphBuilder::VisitAddSmi() {
+  VisitBinarySmiOperation<Operation::kAdd>();
+}
+void MaglevGraphBuilder::VisitSubSmi() {
+  VisitBinarySmiOperation<Operation::kSubtract>();
+}
+void MaglevGraphBuilder::VisitMulSmi() {
+  VisitBinarySmiOperation<Operation::kMultiply>();
+}
+void MaglevGraphBuilder::VisitDivSmi() {
+  VisitBinarySmiOperation<Operation::kDivide>();
+}
+void MaglevGraphBuilder::VisitModSmi() {
+  VisitBinarySmiOperation<Operation::kModulus>();
+}
+void MaglevGraphBuilder::VisitExpSmi() {
+  VisitBinarySmiOperation<Operation::kExponentiate>();
+}
+void MaglevGraphBuilder::VisitBitwiseOrSmi() {
+  VisitBinarySmiOperation<Operation::kBitwiseOr>();
+}
+void MaglevGraphBuilder::VisitBitwiseXorSmi() {
+  VisitBinarySmiOperation<Operation::kBitwiseXor>();
+}
+void MaglevGraphBuilder::VisitBitwiseAndSmi() {
+  VisitBinarySmiOperation<Operation::kBitwiseAnd>();
+}
+void MaglevGraphBuilder::VisitShiftLeftSmi() {
+  VisitBinarySmiOperation<Operation::kShiftLeft>();
+}
+void MaglevGraphBuilder::VisitShiftRightSmi() {
+  VisitBinarySmiOperation<Operation::kShiftRight>();
+}
+void MaglevGraphBuilder::VisitShiftRightLogicalSmi() {
+  VisitBinarySmiOperation<Operation::kShiftRightLogical>();
+}
+void MaglevGraphBuilder::VisitInc() {
+  VisitUnaryOperation<Operation::kIncrement>();
+}
+void MaglevGraphBuilder::VisitDec() {
+  VisitUnaryOperation<Operation::kDecrement>();
+}
+void MaglevGraphBuilder::VisitNegate() {
+  VisitUnaryOperation<Operation::kNegate>();
+}
+void MaglevGraphBuilder::VisitBitwiseNot() {
+  VisitUnaryOperation<Operation::kBitwiseNot>();
+}
+MAGLEV_UNIMPLEMENTED_BYTECODE(ToBooleanLogicalNot)
+MAGLEV_UNIMPLEMENTED_BYTECODE(LogicalNot)
+MAGLEV_UNIMPLEMENTED_BYTECODE(TypeOf)
+MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertyStrict)
+MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertySloppy)
+MAGLEV_UNIMPLEMENTED_BYTECODE(GetSuperConstructor)
+void MaglevGraphBuilder::VisitCallAnyReceiver() {
+  BuildCallFromRegisterList(ConvertReceiverMode::kAny);
+}
 
 // TODO(leszeks): For all of these:
 //   a) Read feedback and implement inlining
 //   b) Wrap in a helper.
 void MaglevGraphBuilder::VisitCallProperty() {
+  BuildCallFromRegisterList(ConvertReceiverMode::kNotNullOrUndefined);
+}
+void MaglevGraphBuilder::VisitCallProperty0() {
+  BuildCallFromRegisters(0, ConvertReceiverMode::kNotNullOrUndefined);
+}
+void MaglevGraphBuilder::VisitCallProperty1() {
+  BuildCallFromRegisters(1, ConvertReceiverMode::kNotNullOrUndefined);
+}
+void MaglevGraphBuilder::VisitCallProperty2() {
+  BuildCallFromRegisters(2, ConvertReceiverMode::kNotNullOrUndefined);
+}
+void MaglevGraphBuilder::VisitCallUndefinedReceiver() {
+  BuildCallFromRegisterList(ConvertReceiverMode::kNullOrUndefined);
+}
+void MaglevGraphBuilder::VisitCallUndefinedReceiver0() {
+  BuildCallFromRegisters(0, ConvertReceiverMode::kNullOrUndefined);
+}
+void MaglevGraphBuilder::VisitCallUndefinedReceiver1() {
+  BuildCallFromRegisters(1, ConvertReceiverMode::kNullOrUndefined);
+}
+void MaglevGraphBuilder::VisitCallUndefinedReceiver2() {
+  BuildCallFromRegisters(2, ConvertReceiverMode::kNullOrUndefined);
+}
+void MaglevGraphBuilder::VisitCallWithSpread() {
+  // CallWithSpread <callable> <first_arg> <arg_count> <slot>
   ValueNode* function = LoadRegister(0);
-
   interpreter::RegisterList args = iterator_.GetRegisterListOperand(1);
   ValueNode* context = GetContext();
 
-  static constexpr int kTheContext = 1;
-  CallProperty* call_property = AddNewNode<CallProperty>(
-      args.register_count() + kTheContext, function, context);
-  // TODO(leszeks): Move this for loop into the CallProperty constructor,
-  // pre-size the args array.
+  // The register list contains the receiver, and ends with the spread.
+  size_t input_count = args.register_count() + CallWithSpread::kFixedInputCount;
+  CallWithSpread* call =
+      AddNewNode<CallWithSpread>(input_count, function, context);
   for (int i = 0; i < args.register_count(); ++i) {
-    call_property->set_arg(i, current_interpreter_frame_.get(args[i]));
+    call->set_arg(i, current_interpreter_frame_.get(args[i]));
   }
-  SetAccumulator(call_property);
+
+  SetAccumulator(call);
   MarkPossibleSideEffect();
 }
-void MaglevGraphBuilder::VisitCallProperty0() {
-  ValueNode* function = LoadRegister(0);
+void MaglevGraphBuilder::VisitCallRuntime() {
+  // CallRuntime <function_id> <first_arg> <arg_count>
+  Runtime::FunctionId function_id = iterator_.GetRuntimeIdOperand(0);
+  interpreter::RegisterList args = iterator_.GetRegisterListOperand(1);
   ValueNode* context = GetContext();
 
-  CallProperty* call_property =
-      AddNewNode<CallProperty>({function, context, LoadRegister(1)});
-  SetAccumulator(call_property);
+  size_t input_count = args.register_count() + CallRuntime::kFixedInputCount;
+  CallRuntime* call_runtime =
+      AddNewNode<CallRuntime>(input_count, function_id, context);
+  for (int i = 0; i < args.register_count(); ++i) {
+    call_runtime->set_arg(i, current_interpreter_frame_.get(args[i]));
+  }
+
+  SetAccumulator(call_runtime);
   MarkPossibleSideEffect();
 }
-void MaglevGraphBuilder::VisitCallProperty1() {
-  ValueNode* function = LoadRegister(0);
+// TODO(v8:7700): Read the second result with GetSecondReturnedValue, like
+// ForInPrepare does.
+MAGLEV_UNIMPLEMENTED_BYTECODE(CallRuntimeForPair)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CallJSRuntime)
+MAGLEV_UNIMPLEMENTED_BYTECODE(InvokeIntrinsic)
+void MaglevGraphBuilder::VisitConstruct() {
+  // Construct <constructor> <first_arg> <arg_count> <slot>
+  ValueNode* new_target = GetAccumulator();
+  ValueNode* constructor = LoadRegister(0);
+  interpreter::RegisterList args = iterator_.GetRegisterListOperand(1);
   ValueNode* context = GetContext();
 
-  CallProperty* call_property = AddNewNode<CallProperty>(
-      {function, context, LoadRegister(1), LoadRegister(2)});
-  SetAccumulator(call_property);
+  // The receiver slot is not part of the register list, and is filled in by
+  // the construct stub.
+  ValueNode* receiver =
+      AddNewNode<RootConstant>({}, RootIndex::kUndefinedValue);
+  static constexpr int kTheReceiver = 1;
+  size_t input_count =
+      args.register_count() + kTheReceiver + Construct::kFixedInputCount;
+  Construct* construct =
+      AddNewNode<Construct>(input_count, constructor, new_target, context);
+  construct->set_arg(0, receiver);
+  for (int i = 0; i < args.register_count(); ++i) {
+    construct->set_arg(i + kTheReceiver,
+                       current_interpreter_frame_.get(args[i]));
+  }
+  SetAccumulator(construct);
   MarkPossibleSideEffect();
 }
-void MaglevGraphBuilder::VisitCallProperty2() {
-  ValueNode* function = LoadRegister(0);
+void MaglevGraphBuilder::VisitConstructWithSpread() {
+  // ConstructWithSpread <constructor> <first_arg> <arg_count> <slot>
+  ValueNode* new_target = GetAccumulator();
+  ValueNode* constructor = LoadRegister(0);
+  interpreter::RegisterList args = iterator_.GetRegisterListOperand(1);
   ValueNode* context = GetContext();
 
-  CallProperty* call_property = AddNewNode<CallProperty>(
-      {function, context, LoadRegister(1), LoadRegister(2), LoadRegister(3)});
-  SetAccumulator(call_property);
+  // The receiver slot is not part of the register list, and is filled in by
+  // the construct stub. The register list ends with the spread.
+  ValueNode* receiver =
+      AddNewNode<RootConstant>({}, RootIndex::kUndefinedValue);
+  static constexpr int kTheReceiver = 1;
+  size_t input_count = args.register_count() + kTheReceiver +
+                       ConstructWithSpread::kFixedInputCount;
+  ConstructWithSpread* construct = AddNewNode<ConstructWithSpread>(
+      input_count, constructor, new_target, context);
+  construct->set_arg(0, receiver);
+  for (int i = 0; i < args.register_count(); ++i) {
+    construct->set_arg(i + kTheReceiver,
+                       current_interpreter_frame_.get(args[i]));
+  }
+  SetAccumulator(construct);
   MarkPossibleSideEffect();
 }
-void MaglevGraphBuilder::VisitCallUndefinedReceiver() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCallUndefinedReceiver0() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCallUndefinedReceiver1() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCallUndefinedReceiver2() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCallWithSpread() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCallRuntime() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCallRuntimeForPair() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCallJSRuntime() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitInvokeIntrinsic() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitConstruct() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitConstructWithSpread() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestEqual() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestEqualStrict() { UNREACHABLE(); }
+void MaglevGraphBuilder::VisitTestEqual() {
+  VisitBinaryOperation<Operation::kEqual>();
+}
+void MaglevGraphBuilder::VisitTestEqualStrict() {
+  VisitBinaryOperation<Operation::kStrictEqual>();
+}
 void MaglevGraphBuilder::VisitTestLessThan() {
-  // TestLessThan <src> <slot>
-
-  ValueNode* left = LoadRegister(0);
-  FeedbackSlot slot_index = GetSlotOperand(1);
-  ValueNode* right = GetAccumulator();
-
-  USE(slot_index);  // TODO(v8:7700): Use the feedback info.
-
-  ValueNode* node = AddNewNode<LessThan>(
-      {left, right}, compiler::FeedbackSource{feedback(), slot_index});
-  SetAccumulator(node);
+  VisitBinaryOperation<Operation::kLessThan>();
+}
+void MaglevGraphBuilder::VisitTestGreaterThan() {
+  VisitBinaryOperation<Operation::kGreaterThan>();
+}
+void MaglevGraphBuilder::VisitTestLessThanOrEqual() {
+  VisitBinaryOperation<Operation::kLessThanOrEqual>();
+}
+void MaglevGraphBuilder::VisitTestGreaterThanOrEqual() {
+  VisitBinaryOperation<Operation::kGreaterThanOrEqual>();
+}
+MAGLEV_UNIMPLEMENTED_BYTECODE(TestInstanceOf)
+MAGLEV_UNIMPLEMENTED_BYTECODE(TestIn)
+MAGLEV_UNIMPLEMENTED_BYTECODE(ToName)
+MAGLEV_UNIMPLEMENTED_BYTECODE(ToNumber)
+MAGLEV_UNIMPLEMENTED_BYTECODE(ToNumeric)
+void MaglevGraphBuilder::VisitToObject() {
+  // ToObject <dst>
+  ValueNode* value = GetAccumulator();
+  StoreRegister(iterator_.GetRegisterOperand(0),
+                AddNewNode<ToObject>({GetContext(), value}),
+                GetOutLiveness());
   MarkPossibleSideEffect();
 }
-void MaglevGraphBuilder::VisitTestGreaterThan() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestLessThanOrEqual() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestGreaterThanOrEqual() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestInstanceOf() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitTestIn() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitToName() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitToNumber() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitToNumeric() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitToObject() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitToString() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateRegExpLiteral() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateArrayLiteral() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateArrayFromIterable() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateEmptyArrayLiteral() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateObjectLiteral() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateEmptyObjectLiteral() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCloneObject() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitGetTemplateObject() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateClosure() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateBlockContext() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateCatchContext() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateFunctionContext() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateEvalContext() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateWithContext() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateMappedArguments() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateUnmappedArguments() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitCreateRestParameter() { UNREACHABLE(); }
+MAGLEV_UNIMPLEMENTED_BYTECODE(ToString)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateRegExpLiteral)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateArrayLiteral)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateArrayFromIterable)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateEmptyArrayLiteral)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateObjectLiteral)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateEmptyObjectLiteral)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CloneObject)
+MAGLEV_UNIMPLEMENTED_BYTECODE(GetTemplateObject)
+void MaglevGraphBuilder::VisitCreateClosure() {
+  // CreateClosure <sfi_index> <feedback_cell_index> <flags>
+  compiler::SharedFunctionInfoRef shared_function_info =
+      GetRefOperand<SharedFunctionInfo>(0);
+  compiler::FeedbackCellRef feedback_cell =
+      feedback().GetClosureFeedbackCell(iterator_.GetIndexOperand(1));
+  uint32_t flags = iterator_.GetFlagOperand(2);
+
+  if (interpreter::CreateClosureFlags::FastNewClosureBit::decode(flags)) {
+    SetAccumulator(AddNewNode<FastCreateClosure>(
+        {GetContext()}, shared_function_info, feedback_cell));
+  } else {
+    bool pretenured =
+        interpreter::CreateClosureFlags::PretenuredBit::decode(flags);
+    SetAccumulator(AddNewNode<CreateClosure>(
+        {GetContext()}, shared_function_info, feedback_cell, pretenured));
+  }
+}
+void MaglevGraphBuilder::VisitCreateBlockContext() {
+  // CreateBlockContext <scope_info_idx>
+  BuildCallRuntime(Runtime::kPushBlockContext,
+                   {AddNewNode<Constant>({}, GetRefOperand<ScopeInfo>(0))});
+}
+// TODO(v8:7700): Catch contexts only show up in exception handlers, which
+// Maglev doesn't support yet.
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateCatchContext)
+// TODO(v8:7700): Call the FastNewFunctionContext builtins for small contexts,
+// like Sparkplug does.
+void MaglevGraphBuilder::VisitCreateFunctionContext() {
+  // CreateFunctionContext <scope_info_idx> <slots>
+  BuildCallRuntime(Runtime::kNewFunctionContext,
+                   {AddNewNode<Constant>({}, GetRefOperand<ScopeInfo>(0))});
+}
+void MaglevGraphBuilder::VisitCreateEvalContext() {
+  // CreateEvalContext <scope_info_idx> <slots>
+  BuildCallRuntime(Runtime::kNewFunctionContext,
+                   {AddNewNode<Constant>({}, GetRefOperand<ScopeInfo>(0))});
+}
+void MaglevGraphBuilder::VisitCreateWithContext() {
+  // CreateWithContext <register> <scope_info_idx>
+  ValueNode* object = LoadRegister(0);
+  BuildCallRuntime(
+      Runtime::kPushWithContext,
+      {object, AddNewNode<Constant>({}, GetRefOperand<ScopeInfo>(1))});
+}
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateMappedArguments)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateUnmappedArguments)
+MAGLEV_UNIMPLEMENTED_BYTECODE(CreateRestParameter)
 
 void MaglevGraphBuilder::VisitJumpLoop() {
   int target = iterator_.GetJumpTargetOffset();
@@ -308,7 +739,7 @@ void MaglevGraphBuilder::VisitJump() {
   MergeIntoFrameState(block, iterator_.GetJumpTargetOffset());
   DCHECK_LT(next_offset(), bytecode().length());
 }
-void MaglevGraphBuilder::VisitJumpConstant() { UNREACHABLE(); }
+void MaglevGraphBuilder::VisitJumpConstant() { VisitJump(); }
 void MaglevGraphBuilder::VisitJumpIfNullConstant() { VisitJumpIfNull(); }
 void MaglevGraphBuilder::VisitJumpIfNotNullConstant() { VisitJumpIfNotNull(); }
 void MaglevGraphBuilder::VisitJumpIfUndefinedConstant() {
@@ -384,37 +815,112 @@ void MaglevGraphBuilder::VisitJumpIfFalse() {
   BuildBranchIfTrue(GetAccumulator(), next_offset(),
                     iterator_.GetJumpTargetOffset());
 }
-void MaglevGraphBuilder::VisitJumpIfNull() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitJumpIfNotNull() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitJumpIfUndefined() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitJumpIfNotUndefined() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitJumpIfUndefinedOrNull() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitJumpIfJSReceiver() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitSwitchOnSmiNoFeedback() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitForInEnumerate() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitForInPrepare() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitForInContinue() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitForInNext() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitForInStep() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitSetPendingMessage() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitThrow() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitReThrow() { UNREACHABLE(); }
+void MaglevGraphBuilder::BuildBranchIfRootConstant(ValueNode* node,
+                                                   int true_target,
+                                                   int false_target,
+                                                   RootIndex root_index) {
+  BasicBlock* block = FinishBlock<BranchIfRootConstant>(
+      next_offset(), {node}, &jump_targets_[true_target],
+      &jump_targets_[false_target], root_index);
+  MergeIntoFrameState(block, iterator_.GetJumpTargetOffset());
+}
+void MaglevGraphBuilder::BuildBranchIfUndefinedOrNull(ValueNode* node,
+                                                      int true_target,
+                                                      int false_target) {
+  BasicBlock* block = FinishBlock<BranchIfUndefinedOrNull>(
+      next_offset(), {node}, &jump_targets_[true_target],
+      &jump_targets_[false_target]);
+  MergeIntoFrameState(block, iterator_.GetJumpTargetOffset());
+}
+void MaglevGraphBuilder::VisitJumpIfNull() {
+  BuildBranchIfRootConstant(GetAccumulator(), iterator_.GetJumpTargetOffset(),
+                            next_offset(), RootIndex::kNullValue);
+}
+void MaglevGraphBuilder::VisitJumpIfNotNull() {
+  BuildBranchIfRootConstant(GetAccumulator(), next_offset(),
+                            iterator_.GetJumpTargetOffset(),
+                            RootIndex::kNullValue);
+}
+void MaglevGraphBuilder::VisitJumpIfUndefined() {
+  BuildBranchIfRootConstant(GetAccumulator(), iterator_.GetJumpTargetOffset(),
+                            next_offset(), RootIndex::kUndefinedValue);
+}
+void MaglevGraphBuilder::VisitJumpIfNotUndefined() {
+  BuildBranchIfRootConstant(GetAccumulator(), next_offset(),
+                            iterator_.GetJumpTargetOffset(),
+                            RootIndex::kUndefinedValue);
+}
+void MaglevGraphBuilder::VisitJumpIfUndefinedOrNull() {
+  BuildBranchIfUndefinedOrNull(GetAccumulator(),
+                               iterator_.GetJumpTargetOffset(), next_offset());
+}
+MAGLEV_UNIMPLEMENTED_BYTECODE(JumpIfJSReceiver)
+MAGLEV_UNIMPLEMENTED_BYTECODE(SwitchOnSmiNoFeedback)
+void MaglevGraphBuilder::VisitForInEnumerate() {
+  // ForInEnumerate <receiver>
+  ValueNode* receiver = LoadRegister(0);
+  SetAccumulator(AddNewNode<ForInEnumerate>({GetContext(), receiver}));
+  MarkPossibleSideEffect();
+}
+void MaglevGraphBuilder::VisitForInPrepare() {
+  // ForInPrepare <cache_info_triple> <slot>
+  ValueNode* enumerator = GetAccumulator();
+  FeedbackSlot slot = GetSlotOperand(1);
+  ForInPrepare* cache_array = AddNewNode<ForInPrepare>(
+      {GetContext(), enumerator}, compiler::FeedbackSource{feedback(), slot});
+  ValueNode* cache_length = AddNewNode<GetSecondReturnedValue>({});
+  // The triple holds the cache type (the enumerator itself), the cache array
+  // and the cache length.
+  interpreter::Register first = iterator_.GetRegisterOperand(0);
+  interpreter::Register second(first.index() + 1);
+  interpreter::Register third(first.index() + 2);
+  StoreRegister(first, enumerator, GetOutLiveness());
+  StoreRegister(second, cache_array, GetOutLiveness());
+  StoreRegister(third, cache_length, GetOutLiveness());
+  MarkPossibleSideEffect();
+}
+void MaglevGraphBuilder::VisitForInContinue() {
+  // ForInContinue <index> <cache_length>
+  ValueNode* index = LoadRegister(0);
+  ValueNode* cache_length = LoadRegister(1);
+  SetAccumulator(AddNewNode<TaggedNotEqual>({index, cache_length}));
+}
+void MaglevGraphBuilder::VisitForInNext() {
+  // ForInNext <receiver> <index> <cache_info_pair> <slot>
+  ValueNode* receiver = LoadRegister(0);
+  ValueNode* index = LoadRegister(1);
+  interpreter::Register cache_type_reg, cache_array_reg;
+  std::tie(cache_type_reg, cache_array_reg) =
+      iterator_.GetRegisterPairOperand(2);
+  ValueNode* cache_type = current_interpreter_frame_.get(cache_type_reg);
+  ValueNode* cache_array = current_interpreter_frame_.get(cache_array_reg);
+  FeedbackSlot slot = GetSlotOperand(3);
+  SetAccumulator(AddNewNode<ForInNext>(
+      {GetContext(), receiver, cache_array, cache_type, index},
+      compiler::FeedbackSource{feedback(), slot}));
+  MarkPossibleSideEffect();
+}
+void MaglevGraphBuilder::VisitForInStep() {
+  // ForInStep <index>
+  SetAccumulator(AddNewNode<ForInStep>({LoadRegister(0)}));
+}
+MAGLEV_UNIMPLEMENTED_BYTECODE(SetPendingMessage)
+MAGLEV_UNIMPLEMENTED_BYTECODE(Throw)
+MAGLEV_UNIMPLEMENTED_BYTECODE(ReThrow)
 void MaglevGraphBuilder::VisitReturn() {
   FinishBlock<Return>(next_offset(), {GetAccumulator()});
 }
-void MaglevGraphBuilder::VisitThrowReferenceErrorIfHole() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitThrowSuperNotCalledIfHole() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitThrowSuperAlreadyCalledIfNotHole() {
-  UNREACHABLE();
-}
-void MaglevGraphBuilder::VisitThrowIfNotSuperConstructor() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitSwitchOnGeneratorState() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitSuspendGenerator() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitResumeGenerator() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitGetIterator() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitDebugger() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitIncBlockCounter() { UNREACHABLE(); }
-void MaglevGraphBuilder::VisitAbort() { UNREACHABLE(); }
+MAGLEV_UNIMPLEMENTED_BYTECODE(ThrowReferenceErrorIfHole)
+MAGLEV_UNIMPLEMENTED_BYTECODE(ThrowSuperNotCalledIfHole)
+MAGLEV_UNIMPLEMENTED_BYTECODE(ThrowSuperAlreadyCalledIfNotHole)
+MAGLEV_UNIMPLEMENTED_BYTECODE(ThrowIfNotSuperConstructor)
+MAGLEV_UNIMPLEMENTED_BYTECODE(SwitchOnGeneratorState)
+MAGLEV_UNIMPLEMENTED_BYTECODE(SuspendGenerator)
+MAGLEV_UNIMPLEMENTED_BYTECODE(ResumeGenerator)
+MAGLEV_UNIMPLEMENTED_BYTECODE(GetIterator)
+MAGLEV_UNIMPLEMENTED_BYTECODE(Debugger)
+MAGLEV_UNIMPLEMENTED_BYTECODE(IncBlockCounter)
+MAGLEV_UNIMPLEMENTED_BYTECODE(Abort)
 #define SHORT_STAR_VISITOR(Name, ...)                                         \
   void MaglevGraphBuilder::Visit##Name() {                                    \
     StoreRegister(                                                            \
@@ -433,6 +939,8 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK)
 #undef DEBUG_BREAK
 void MaglevGraphBuilder::VisitIllegal() { UNREACHABLE(); }
 
+#undef MAGLEV_UNIMPLEMENTED_BYTECODE
+
 }  // namespace maglev
 }  // namespace internal
 }  // namespace v8
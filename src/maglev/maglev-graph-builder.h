@@ -15,6 +15,7 @@
 #include "src/maglev/maglev-graph-labeller.h"
 #include "src/maglev/maglev-graph.h"
 #include "src/maglev/maglev-ir.h"
+#include "src/objects/feedback-vector.h"
 #include "src/utils/memcopy.h"
 
 namespace v8 {
@@ -111,11 +112,20 @@ class MaglevGraphBuilder {
   void Build() {
     for (iterator_.Reset(); !iterator_.done(); iterator_.Advance()) {
       VisitSingleBytecode();
+      // The graph is incomplete once we hit a bytecode we can't handle yet,
+      // there's no point in visiting the rest.
+      if (found_unsupported_bytecode()) return;
     }
   }
 
   Graph* graph() { return &graph_; }
 
+  // True if the bytecode uses features that Maglev doesn't support yet, in
+  // which case the graph is unusable and compilation has to bail out.
+  bool found_unsupported_bytecode() const {
+    return found_unsupported_bytecode_;
+  }
+
  private:
   BasicBlock* CreateEmptyBlock(int offset, BasicBlock* predecessor) {
     DCHECK_NULL(current_block_);
@@ -235,6 +245,11 @@ class MaglevGraphBuilder {
         interpreter::Register::current_context());
   }
 
+  void SetContext(ValueNode* context) {
+    StoreRegister(interpreter::Register::current_context(), context,
+                  GetOutLiveness());
+  }
+
   FeedbackSlot GetSlotOperand(int operand_index) {
     return iterator_.GetSlotOperand(operand_index);
   }
@@ -244,7 +259,7 @@ class MaglevGraphBuilder {
   typename compiler::ref_traits<T>::ref_type GetRefOperand(int operand_index) {
     return MakeRef(broker(),
                    Handle<T>::cast(iterator_.GetConstantForIndexOperand(
-                       operand_index, isolate())));
+                       operand_index, local_isolate())));
   }
 
   void SetAccumulator(ValueNode* node) {
@@ -354,10 +369,42 @@ class MaglevGraphBuilder {
     return block;
   }
 
+  void MarkBytecodeUnsupported(const char* bytecode_name);
+
+  ValueNode* BuildContextAtDepth(ValueNode* context, size_t depth);
+  void BuildLoadContextSlot(ValueNode* context, size_t depth, int slot_index);
+  void BuildStoreContextSlot(ValueNode* context, size_t depth, int slot_index);
+
+  bool TryBuildFieldLoad(ValueNode* object, const FeedbackNexus& nexus);
+
+  void BuildCallFromRegisterList(ConvertReceiverMode receiver_mode);
+  void BuildCallFromRegisters(int argc_count,
+                              ConvertReceiverMode receiver_mode);
+  void BuildCallRuntime(Runtime::FunctionId function_id,
+                        std::initializer_list<ValueNode*> args);
+
+  template <Operation kOperation>
+  void BuildGenericUnaryOperationNode();
+  template <Operation kOperation>
+  void BuildGenericBinaryOperationNode();
+  template <Operation kOperation>
+  void BuildGenericBinarySmiOperationNode();
+
+  template <Operation kOperation>
+  void VisitUnaryOperation();
+  template <Operation kOperation>
+  void VisitBinaryOperation();
+  template <Operation kOperation>
+  void VisitBinarySmiOperation();
+
   void MergeIntoFrameState(BasicBlock* block, int target);
   void BuildBranchIfTrue(ValueNode* node, int true_target, int false_target);
   void BuildBranchIfToBooleanTrue(ValueNode* node, int true_target,
                                   int false_target);
+  void BuildBranchIfRootConstant(ValueNode* node, int true_target,
+                                 int false_target, RootIndex root_index);
+  void BuildBranchIfUndefinedOrNull(ValueNode* node, int true_target,
+                                    int false_target);
 
   void CalculatePredecessorCounts() {
     // Add 1 after the end of the bytecode so we can always write to the offset
@@ -401,6 +448,9 @@ class MaglevGraphBuilder {
     return compilation_unit_->bytecode_analysis;
   }
   Isolate* isolate() const { return compilation_unit_->isolate(); }
+  LocalIsolate* local_isolate() const {
+    return broker()->local_isolate_or_isolate();
+  }
   Zone* zone() const { return compilation_unit_->zone(); }
   int parameter_count() const { return compilation_unit_->parameter_count(); }
   int register_count() const { return compilation_unit_->register_count(); }
@@ -419,6 +469,7 @@ class MaglevGraphBuilder {
   BasicBlock* current_block_ = nullptr;
   int block_offset_ = 0;
   bool has_valid_checkpoint_ = false;
+  bool found_unsupported_bytecode_ = false;
 
   BasicBlockRef* jump_targets_;
   MergePointInterpreterFrameState** merge_states_;
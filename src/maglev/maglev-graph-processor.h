@@ -202,6 +202,10 @@ class GraphProcessor {
     PreProcessDeoptingNode();
   }
 
+  void PreProcess(CheckMapsPolymorphic* node, const ProcessingState& state) {
+    PreProcessDeoptingNode();
+  }
+
   void PreProcessDeoptingNode() {
     if (!kNeedsCheckpointStates) return;
 
@@ -75,6 +75,11 @@ class MergePointInterpreterFrameState {
     auto& assignments =
         compilation_unit.bytecode_analysis.GetLoopInfoFor(merge_offset)
             .assignments();
+    if (reg == interpreter::Register::current_context()) {
+      // The context always gets a loop phi, see the loop header constructor.
+      DCHECK(value->Is<Phi>());
+      return;
+    }
     if (reg.is_parameter()) {
       if (!assignments.ContainsParameter(reg.ToParameterIndex())) return;
     } else {
@@ -125,6 +130,11 @@ class MergePointInterpreterFrameState {
       }
       live_registers_and_accumulator_[live_index++] = value;
     });
+    // TODO(v8:7700): Add contexts into assignment analysis, so that loops
+    // which don't push a context don't need a phi for it.
+    live_registers_and_accumulator_[live_index++] =
+        NewLoopPhi(info.zone(), interpreter::Register::current_context(),
+                   merge_offset, nullptr);
     ForEachLocal([&](interpreter::Register reg) {
       ValueNode* value = nullptr;
       if (assignments.ContainsLocal(reg.index())) {
@@ -270,7 +280,8 @@ class MergePointInterpreterFrameState {
   }
   static int SizeFor(const MaglevCompilationUnit& info,
                      const compiler::BytecodeLivenessState* liveness) {
-    return info.parameter_count() + liveness->live_value_count();
+    // Parameters, the current context, and the live locals and accumulator.
+    return info.parameter_count() + 1 + liveness->live_value_count();
   }
 
   template <typename Function>
@@ -308,12 +319,14 @@ class MergePointInterpreterFrameState {
   template <typename Function>
   void ForEachRegister(const MaglevCompilationUnit& info, Function&& f) {
     ForEachParameter(info, f);
+    f(interpreter::Register::current_context());
     ForEachLocal(f);
   }
 
   template <typename Function>
   void ForEachRegister(const MaglevCompilationUnit& info, Function&& f) const {
     ForEachParameter(info, f);
+    f(interpreter::Register::current_context());
     ForEachLocal(f);
   }
 
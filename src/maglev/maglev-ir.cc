@@ -266,6 +266,17 @@ void EmitDeopt(MaglevCodeGenState* code_gen_state, Node* node,
             GetStackSlot(checkpoint_state->accumulator()->spill_slot()));
   }
 
+  // The incoming context is still in the frame's context slot, anything
+  // pushed since has to be written back.
+  ValueNode* context =
+      checkpoint_state->get(interpreter::Register::current_context());
+  if (!context->Is<InitialValue>()) {
+    __ RecordComment("Materialize context");
+    __ movq(kScratchRegister, GetStackSlot(context->spill_slot()));
+    __ movq(MemOperand(rbp, StandardFrameConstants::kContextOffset),
+            kScratchRegister);
+  }
+
   __ RecordComment("Load registers from extra pushed slots");
   int slot = 0;
   for (int i = 0; i < compilation_unit->register_count(); ++i) {
@@ -403,7 +414,7 @@ void Constant::AllocateVreg(MaglevVregAllocationState* vreg_state,
 }
 void Constant::GenerateCode(MaglevCodeGenState* code_gen_state,
                             const ProcessingState& state) {
-  UNREACHABLE();
+  __ Move(ToRegister(result()), object_.object());
 }
 void Constant::PrintParams(std::ostream& os,
                            MaglevGraphLabeller* graph_labeller) const {
@@ -504,7 +515,7 @@ void CheckMaps::GenerateCode(MaglevCodeGenState* code_gen_state,
   __ Cmp(map_tmp, map().object());
 
   // TODO(leszeks): Encode as a bit on CheckMaps.
-  if (map().object()->is_migration_target()) {
+  if (map().is_migration_target()) {
     JumpToDeferredIf(
         not_equal, code_gen_state,
         [](MaglevCodeGenState* code_gen_state, Label* return_label,
@@ -552,6 +563,41 @@ void CheckMaps::PrintParams(std::ostream& os,
   os << "(" << map() << ")";
 }
 
+void CheckMapsPolymorphic::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                        const ProcessingState& state) {
+  UseRegister(actual_map_input());
+  set_temporaries_needed(1);
+}
+void CheckMapsPolymorphic::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                        const ProcessingState& state) {
+  Register object = ToRegister(actual_map_input());
+  RegList temps = temporaries();
+  Register map_tmp =
+      Register::from_code(base::bits::CountTrailingZerosNonZero(temps));
+
+  // The graph builder only emits this node for maps that are not migration
+  // targets, so a mismatch always deopts.
+  Label is_ok;
+  __ LoadMap(map_tmp, object);
+  for (const compiler::MapRef& map : maps()) {
+    __ Cmp(map_tmp, map.object());
+    __ j(equal, &is_ok);
+  }
+  EmitDeopt(code_gen_state, this, state);
+  __ bind(&is_ok);
+}
+void CheckMapsPolymorphic::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(";
+  bool first = true;
+  for (const compiler::MapRef& map : maps()) {
+    if (!first) os << ", ";
+    first = false;
+    os << map;
+  }
+  os << ")";
+}
+
 void LoadField::AllocateVreg(MaglevVregAllocationState* vreg_state,
                              const ProcessingState& state) {
   UseRegister(object_input());
@@ -588,34 +634,134 @@ void LoadField::PrintParams(std::ostream& os,
 
 void LoadNamedGeneric::AllocateVreg(MaglevVregAllocationState* vreg_state,
                                     const ProcessingState& state) {
-  UseRegister(object_input());
-  DefineAsRegister(vreg_state, this);
+  using D = LoadWithVectorDescriptor;
+  UseFixed(context(), kContextRegister);
+  UseFixed(object_input(), D::GetRegisterParameter(D::kReceiver));
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
 }
 void LoadNamedGeneric::GenerateCode(MaglevCodeGenState* code_gen_state,
                                     const ProcessingState& state) {
-  UNREACHABLE();
+  using D = LoadWithVectorDescriptor;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(object_input()), D::GetRegisterParameter(D::kReceiver));
+  __ Move(D::GetRegisterParameter(D::kName), name().object());
+  __ Move(D::GetRegisterParameter(D::kSlot),
+          TaggedIndex::FromIntptr(feedback().index()));
+  __ Move(D::GetRegisterParameter(D::kVector), feedback().vector);
+  __ CallBuiltin(Builtin::kLoadIC);
 }
 void LoadNamedGeneric::PrintParams(std::ostream& os,
                                    MaglevGraphLabeller* graph_labeller) const {
   os << "(" << name_ << ")";
 }
 
-void Increment::AllocateVreg(MaglevVregAllocationState* vreg_state,
-                             const ProcessingState& state) {
-  using D = UnaryOp_WithFeedbackDescriptor;
-  UseFixed(operand_input(), D::GetRegisterParameter(D::kValue));
+void LoadKeyedGeneric::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                    const ProcessingState& state) {
+  using D = KeyedLoadWithVectorDescriptor;
+  UseFixed(context(), kContextRegister);
+  UseFixed(object_input(), D::GetRegisterParameter(D::kReceiver));
+  UseFixed(key_input(), D::GetRegisterParameter(D::kName));
   DefineAsFixed(vreg_state, this, kReturnRegister0);
 }
-void Increment::GenerateCode(MaglevCodeGenState* code_gen_state,
-                             const ProcessingState& state) {
-  using D = UnaryOp_WithFeedbackDescriptor;
-  DCHECK_EQ(ToRegister(operand_input()), D::GetRegisterParameter(D::kValue));
-  __ Move(kContextRegister, code_gen_state->native_context().object());
-  __ Move(D::GetRegisterParameter(D::kSlot), Immediate(feedback().index()));
-  __ Move(D::GetRegisterParameter(D::kFeedbackVector), feedback().vector);
+void LoadKeyedGeneric::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                    const ProcessingState& state) {
+  using D = KeyedLoadWithVectorDescriptor;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(object_input()), D::GetRegisterParameter(D::kReceiver));
+  DCHECK_EQ(ToRegister(key_input()), D::GetRegisterParameter(D::kName));
+  __ Move(D::GetRegisterParameter(D::kSlot),
+          TaggedIndex::FromIntptr(feedback().index()));
+  __ Move(D::GetRegisterParameter(D::kVector), feedback().vector);
+  __ CallBuiltin(Builtin::kKeyedLoadIC);
+}
+
+void LoadTaggedField::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                   const ProcessingState& state) {
+  UseRegister(object_input());
+  DefineAsRegister(vreg_state, this);
+}
+void LoadTaggedField::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                   const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  __ DecompressAnyTagged(ToRegister(result()), FieldOperand(object, offset()));
+}
+void LoadTaggedField::PrintParams(std::ostream& os,
+                                  MaglevGraphLabeller* graph_labeller) const {
+  os << "(0x" << std::hex << offset() << std::dec << ")";
+}
+
+void StoreNamedGeneric::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                     const ProcessingState& state) {
+  using D = StoreWithVectorDescriptor;
+  UseFixed(context(), kContextRegister);
+  UseFixed(object_input(), D::GetRegisterParameter(D::kReceiver));
+  UseFixed(value_input(), D::GetRegisterParameter(D::kValue));
+}
+void StoreNamedGeneric::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                     const ProcessingState& state) {
+  using D = StoreWithVectorDescriptor;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(object_input()), D::GetRegisterParameter(D::kReceiver));
+  DCHECK_EQ(ToRegister(value_input()), D::GetRegisterParameter(D::kValue));
+  __ Move(D::GetRegisterParameter(D::kName), name().object());
+  __ Move(D::GetRegisterParameter(D::kSlot),
+          TaggedIndex::FromIntptr(feedback().index()));
+  __ Move(D::GetRegisterParameter(D::kVector), feedback().vector);
+  __ CallBuiltin(Builtin::kStoreIC);
+}
+void StoreNamedGeneric::PrintParams(std::ostream& os,
+                                    MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << name_ << ")";
+}
+
+void StoreKeyedGeneric::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                     const ProcessingState& state) {
+  using D = StoreWithVectorDescriptor;
+  UseFixed(context(), kContextRegister);
+  UseFixed(object_input(), D::GetRegisterParameter(D::kReceiver));
+  UseFixed(key_input(), D::GetRegisterParameter(D::kName));
+  UseFixed(value_input(), D::GetRegisterParameter(D::kValue));
+}
+void StoreKeyedGeneric::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                     const ProcessingState& state) {
+  using D = StoreWithVectorDescriptor;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(object_input()), D::GetRegisterParameter(D::kReceiver));
+  DCHECK_EQ(ToRegister(key_input()), D::GetRegisterParameter(D::kName));
+  DCHECK_EQ(ToRegister(value_input()), D::GetRegisterParameter(D::kValue));
+  __ Move(D::GetRegisterParameter(D::kSlot),
+          TaggedIndex::FromIntptr(feedback().index()));
+  __ Move(D::GetRegisterParameter(D::kVector), feedback().vector);
+  __ CallBuiltin(Builtin::kKeyedStoreIC);
+}
+
+void StoreTaggedFieldWithWriteBarrier::AllocateVreg(
+    MaglevVregAllocationState* vreg_state, const ProcessingState& state) {
+  UseRegister(object_input());
+  UseRegister(value_input());
+  // RecordWriteField clobbers both the value and the slot address, so work on
+  // a copy of the value.
+  set_temporaries_needed(2);
+}
+void StoreTaggedFieldWithWriteBarrier::GenerateCode(
+    MaglevCodeGenState* code_gen_state, const ProcessingState& state) {
+  Register object = ToRegister(object_input());
+  Register value = ToRegister(value_input());
+  RegList temps = temporaries();
+  Register value_tmp =
+      Register::from_code(base::bits::CountTrailingZerosNonZero(temps));
+  temps &= ~value_tmp.bit();
+  Register slot_tmp =
+      Register::from_code(base::bits::CountTrailingZerosNonZero(temps));
 
-  // TODO(leszeks): Implement full handling.
-  __ CallBuiltin(Builtin::kIncrement_WithFeedback);
+  __ StoreTaggedField(FieldOperand(object, offset()), value);
+  __ movq(value_tmp, value);
+  __ RecordWriteField(object, offset(), value_tmp, slot_tmp,
+                      SaveFPRegsMode::kSave);
+}
+void StoreTaggedFieldWithWriteBarrier::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(0x" << std::hex << offset() << std::dec << ")";
 }
 
 void StoreToFrame::AllocateVreg(MaglevVregAllocationState* vreg_state,
@@ -656,37 +802,74 @@ void GapMove::PrintParams(std::ostream& os,
   os << "(" << source() << " → " << target() << ")";
 }
 
-void Add::AllocateVreg(MaglevVregAllocationState* vreg_state,
-                       const ProcessingState& state) {
-  UseRegister(left_input());
-  UseRegister(right_input());
-  DefineSameAsFirst(vreg_state, this);
-}
-void Add::GenerateCode(MaglevCodeGenState* code_gen_state,
-                       const ProcessingState& state) {
+namespace {
+
+Builtin BuiltinFor(Operation operation) {
+  switch (operation) {
+#define CASE(name)         \
+  case Operation::k##name: \
+    return Builtin::k##name##_WithFeedback;
+    OPERATION_LIST(CASE)
+#undef CASE
+  }
   UNREACHABLE();
 }
 
-void LessThan::AllocateVreg(MaglevVregAllocationState* vreg_state,
-                            const ProcessingState& state) {
+}  // namespace
+
+template <class Derived, Operation kOperation>
+void UnaryWithFeedbackNode<Derived, kOperation>::AllocateVreg(
+    MaglevVregAllocationState* vreg_state, const ProcessingState& state) {
+  using D = UnaryOp_WithFeedbackDescriptor;
+  UseFixed(operand_input(), D::GetRegisterParameter(D::kValue));
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+
+template <class Derived, Operation kOperation>
+void UnaryWithFeedbackNode<Derived, kOperation>::GenerateCode(
+    MaglevCodeGenState* code_gen_state, const ProcessingState& state) {
+  using D = UnaryOp_WithFeedbackDescriptor;
+  DCHECK_EQ(ToRegister(operand_input()), D::GetRegisterParameter(D::kValue));
+  __ Move(kContextRegister, code_gen_state->native_context().object());
+  __ Move(D::GetRegisterParameter(D::kSlot), Immediate(feedback().index()));
+  __ Move(D::GetRegisterParameter(D::kFeedbackVector), feedback().vector);
+  __ CallBuiltin(BuiltinFor(kOperation));
+}
+
+template <class Derived, Operation kOperation>
+void BinaryWithFeedbackNode<Derived, kOperation>::AllocateVreg(
+    MaglevVregAllocationState* vreg_state, const ProcessingState& state) {
   using D = BinaryOp_WithFeedbackDescriptor;
   UseFixed(left_input(), D::GetRegisterParameter(D::kLeft));
   UseFixed(right_input(), D::GetRegisterParameter(D::kRight));
   DefineAsFixed(vreg_state, this, kReturnRegister0);
 }
-void LessThan::GenerateCode(MaglevCodeGenState* code_gen_state,
-                            const ProcessingState& state) {
+
+template <class Derived, Operation kOperation>
+void BinaryWithFeedbackNode<Derived, kOperation>::GenerateCode(
+    MaglevCodeGenState* code_gen_state, const ProcessingState& state) {
+  // Compare_WithFeedback has the same register layout.
   using D = BinaryOp_WithFeedbackDescriptor;
   DCHECK_EQ(ToRegister(left_input()), D::GetRegisterParameter(D::kLeft));
   DCHECK_EQ(ToRegister(right_input()), D::GetRegisterParameter(D::kRight));
   __ Move(kContextRegister, code_gen_state->native_context().object());
   __ Move(D::GetRegisterParameter(D::kSlot), Immediate(feedback().index()));
   __ Move(D::GetRegisterParameter(D::kFeedbackVector), feedback().vector);
-
-  // TODO(jgruber): Implement full handling.
-  __ CallBuiltin(Builtin::kLessThan_WithFeedback);
+  __ CallBuiltin(BuiltinFor(kOperation));
 }
 
+#define DEF_OPERATION(Name)                                      \
+  void Name::AllocateVreg(MaglevVregAllocationState* vreg_state, \
+                          const ProcessingState& state) {        \
+    Base::AllocateVreg(vreg_state, state);                       \
+  }                                                              \
+  void Name::GenerateCode(MaglevCodeGenState* code_gen_state,    \
+                          const ProcessingState& state) {        \
+    Base::GenerateCode(code_gen_state, state);                   \
+  }
+GENERIC_OPERATIONS_NODE_LIST(DEF_OPERATION)
+#undef DEF_OPERATION
+
 void Phi::AllocateVreg(MaglevVregAllocationState* vreg_state,
                        const ProcessingState& state) {
   // Phi inputs are processed in the post-process, once loop phis' inputs'
@@ -710,8 +893,8 @@ void Phi::PrintParams(std::ostream& os,
   os << "(" << owner().ToString() << ")";
 }
 
-void CallProperty::AllocateVreg(MaglevVregAllocationState* vreg_state,
-                                const ProcessingState& state) {
+void Call::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                        const ProcessingState& state) {
   UseFixed(function(), CallTrampolineDescriptor::GetRegisterParameter(
                            CallTrampolineDescriptor::kFunction));
   UseFixed(context(), kContextRegister);
@@ -720,8 +903,8 @@ void CallProperty::AllocateVreg(MaglevVregAllocationState* vreg_state,
   }
   DefineAsFixed(vreg_state, this, kReturnRegister0);
 }
-void CallProperty::GenerateCode(MaglevCodeGenState* code_gen_state,
-                                const ProcessingState& state) {
+void Call::GenerateCode(MaglevCodeGenState* code_gen_state,
+                        const ProcessingState& state) {
   // TODO(leszeks): Port the nice Sparkplug CallBuiltin helper.
 
   DCHECK_EQ(ToRegister(function()),
@@ -740,16 +923,308 @@ void CallProperty::GenerateCode(MaglevCodeGenState* code_gen_state,
 
   // TODO(leszeks): This doesn't collect feedback yet, either pass in the
   // feedback vector by Handle.
-  __ CallBuiltin(Builtin::kCall_ReceiverIsNotNullOrUndefined);
+  switch (receiver_mode_) {
+    case ConvertReceiverMode::kNullOrUndefined:
+      __ CallBuiltin(Builtin::kCall_ReceiverIsNullOrUndefined);
+      break;
+    case ConvertReceiverMode::kNotNullOrUndefined:
+      __ CallBuiltin(Builtin::kCall_ReceiverIsNotNullOrUndefined);
+      break;
+    case ConvertReceiverMode::kAny:
+      __ CallBuiltin(Builtin::kCall_ReceiverIsAny);
+      break;
+  }
+}
+void Call::PrintParams(std::ostream& os,
+                       MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << receiver_mode_ << ")";
 }
 
-void CallUndefinedReceiver::AllocateVreg(MaglevVregAllocationState* vreg_state,
-                                         const ProcessingState& state) {
-  UNREACHABLE();
+void Construct::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                             const ProcessingState& state) {
+  using D = JSTrampolineDescriptor;
+  UseFixed(function(), D::GetRegisterParameter(D::kTarget));
+  UseFixed(new_target(), D::GetRegisterParameter(D::kNewTarget));
+  UseFixed(context(), kContextRegister);
+  for (int i = 0; i < num_args(); i++) {
+    UseAny(arg(i));
+  }
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
 }
-void CallUndefinedReceiver::GenerateCode(MaglevCodeGenState* code_gen_state,
-                                         const ProcessingState& state) {
-  UNREACHABLE();
+void Construct::GenerateCode(MaglevCodeGenState* code_gen_state,
+                             const ProcessingState& state) {
+  using D = JSTrampolineDescriptor;
+  DCHECK_EQ(ToRegister(function()), D::GetRegisterParameter(D::kTarget));
+  DCHECK_EQ(ToRegister(new_target()), D::GetRegisterParameter(D::kNewTarget));
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+
+  for (int i = num_args() - 1; i >= 0; --i) {
+    PushInput(code_gen_state, arg(i));
+  }
+
+  uint32_t arg_count = num_args();
+  __ Move(D::GetRegisterParameter(D::kActualArgumentsCount),
+          Immediate(arg_count));
+
+  // TODO(v8:7700): Use Construct_WithFeedback to collect feedback.
+  __ CallBuiltin(Builtin::kConstruct);
+}
+
+void CallWithSpread::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                  const ProcessingState& state) {
+  using D = CallWithSpreadDescriptor;
+  UseFixed(function(), D::GetRegisterParameter(D::kTarget));
+  UseFixed(context(), kContextRegister);
+  for (int i = 0; i < num_args_no_spread(); i++) {
+    UseAny(arg(i));
+  }
+  UseFixed(spread(), D::GetRegisterParameter(D::kSpread));
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void CallWithSpread::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                  const ProcessingState& state) {
+  using D = CallWithSpreadDescriptor;
+  DCHECK_EQ(ToRegister(function()), D::GetRegisterParameter(D::kTarget));
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(spread()), D::GetRegisterParameter(D::kSpread));
+
+  // The spread is passed in a register, so it is not pushed.
+  for (int i = num_args_no_spread() - 1; i >= 0; --i) {
+    PushInput(code_gen_state, arg(i));
+  }
+
+  uint32_t arg_count = num_args_no_spread();
+  __ Move(D::GetRegisterParameter(D::kArgumentsCount), Immediate(arg_count));
+
+  // TODO(v8:7700): Use CallWithSpread_WithFeedback to collect feedback.
+  __ CallBuiltin(Builtin::kCallWithSpread);
+}
+
+void ConstructWithSpread::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                       const ProcessingState& state) {
+  using D = ConstructWithSpreadDescriptor;
+  UseFixed(function(), D::GetRegisterParameter(D::kTarget));
+  UseFixed(new_target(), D::GetRegisterParameter(D::kNewTarget));
+  UseFixed(context(), kContextRegister);
+  for (int i = 0; i < num_args_no_spread(); i++) {
+    UseAny(arg(i));
+  }
+  UseFixed(spread(), D::GetRegisterParameter(D::kSpread));
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void ConstructWithSpread::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                       const ProcessingState& state) {
+  using D = ConstructWithSpreadDescriptor;
+  DCHECK_EQ(ToRegister(function()), D::GetRegisterParameter(D::kTarget));
+  DCHECK_EQ(ToRegister(new_target()), D::GetRegisterParameter(D::kNewTarget));
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(spread()), D::GetRegisterParameter(D::kSpread));
+
+  // The spread is passed in a register, so it is not pushed.
+  for (int i = num_args_no_spread() - 1; i >= 0; --i) {
+    PushInput(code_gen_state, arg(i));
+  }
+
+  uint32_t arg_count = num_args_no_spread();
+  __ Move(D::GetRegisterParameter(D::kActualArgumentsCount),
+          Immediate(arg_count));
+
+  // TODO(v8:7700): Use ConstructWithSpread_WithFeedback to collect feedback.
+  __ CallBuiltin(Builtin::kConstructWithSpread);
+}
+
+void CallRuntime::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                               const ProcessingState& state) {
+  UseFixed(context(), kContextRegister);
+  for (int i = 0; i < num_args(); i++) {
+    UseAny(arg(i));
+  }
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void CallRuntime::GenerateCode(MaglevCodeGenState* code_gen_state,
+                               const ProcessingState& state) {
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  // Runtime arguments are pushed in order, unlike JS arguments.
+  for (int i = 0; i < num_args(); i++) {
+    PushInput(code_gen_state, arg(i));
+  }
+  __ CallRuntime(function_id(), num_args());
+}
+void CallRuntime::PrintParams(std::ostream& os,
+                              MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << Runtime::FunctionForId(function_id())->name << ")";
+}
+
+void FastCreateClosure::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                     const ProcessingState& state) {
+  UseFixed(context(), kContextRegister);
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void FastCreateClosure::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                     const ProcessingState& state) {
+  using D = CallInterfaceDescriptorFor<Builtin::kFastNewClosure>::type;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  __ Move(D::GetRegisterParameter(D::kSharedFunctionInfo),
+          shared_function_info().object());
+  __ Move(D::GetRegisterParameter(D::kFeedbackCell), feedback_cell().object());
+  __ CallBuiltin(Builtin::kFastNewClosure);
+}
+void FastCreateClosure::PrintParams(std::ostream& os,
+                                    MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << shared_function_info_ << ", " << feedback_cell_ << ")";
+}
+
+void CreateClosure::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                 const ProcessingState& state) {
+  UseFixed(context(), kContextRegister);
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void CreateClosure::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                 const ProcessingState& state) {
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  Runtime::FunctionId function_id =
+      pretenured() ? Runtime::kNewClosure_Tenured : Runtime::kNewClosure;
+  __ Push(shared_function_info().object());
+  __ Push(feedback_cell().object());
+  __ CallRuntime(function_id);
+}
+void CreateClosure::PrintParams(std::ostream& os,
+                                MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << shared_function_info_ << ", " << feedback_cell_;
+  if (pretenured()) os << ", pretenured";
+  os << ")";
+}
+
+void ToObject::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                            const ProcessingState& state) {
+  using D = CallInterfaceDescriptorFor<Builtin::kToObject>::type;
+  UseFixed(context(), kContextRegister);
+  UseFixed(value_input(), D::GetRegisterParameter(D::kInput));
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void ToObject::GenerateCode(MaglevCodeGenState* code_gen_state,
+                            const ProcessingState& state) {
+  using D = CallInterfaceDescriptorFor<Builtin::kToObject>::type;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(value_input()), D::GetRegisterParameter(D::kInput));
+  __ CallBuiltin(Builtin::kToObject);
+}
+
+void ForInEnumerate::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                  const ProcessingState& state) {
+  using D = CallInterfaceDescriptorFor<Builtin::kForInEnumerate>::type;
+  UseFixed(context(), kContextRegister);
+  UseFixed(receiver_input(), D::GetRegisterParameter(D::kReceiver));
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void ForInEnumerate::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                  const ProcessingState& state) {
+  using D = CallInterfaceDescriptorFor<Builtin::kForInEnumerate>::type;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(receiver_input()),
+            D::GetRegisterParameter(D::kReceiver));
+  __ CallBuiltin(Builtin::kForInEnumerate);
+}
+
+void ForInPrepare::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                const ProcessingState& state) {
+  using D = ForInPrepareDescriptor;
+  UseFixed(context(), kContextRegister);
+  UseFixed(enumerator(), D::GetRegisterParameter(D::kEnumerator));
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void ForInPrepare::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                const ProcessingState& state) {
+  using D = ForInPrepareDescriptor;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(enumerator()), D::GetRegisterParameter(D::kEnumerator));
+  __ Move(D::GetRegisterParameter(D::kVectorIndex),
+          TaggedIndex::FromIntptr(feedback().index()));
+  __ Move(D::GetRegisterParameter(D::kFeedbackVector), feedback().vector);
+  __ CallBuiltin(Builtin::kForInPrepare);
+}
+
+void ForInNext::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                             const ProcessingState& state) {
+  using D = CallInterfaceDescriptorFor<Builtin::kForInNext>::type;
+  UseFixed(context(), kContextRegister);
+  UseFixed(receiver(), D::GetRegisterParameter(D::kReceiver));
+  UseFixed(cache_array(), D::GetRegisterParameter(D::kCacheArray));
+  UseFixed(cache_type(), D::GetRegisterParameter(D::kCacheType));
+  UseFixed(cache_index(), D::GetRegisterParameter(D::kCacheIndex));
+  DefineAsFixed(vreg_state, this, kReturnRegister0);
+}
+void ForInNext::GenerateCode(MaglevCodeGenState* code_gen_state,
+                             const ProcessingState& state) {
+  using D = CallInterfaceDescriptorFor<Builtin::kForInNext>::type;
+  DCHECK_EQ(ToRegister(context()), kContextRegister);
+  DCHECK_EQ(ToRegister(receiver()), D::GetRegisterParameter(D::kReceiver));
+  DCHECK_EQ(ToRegister(cache_array()), D::GetRegisterParameter(D::kCacheArray));
+  DCHECK_EQ(ToRegister(cache_type()), D::GetRegisterParameter(D::kCacheType));
+  DCHECK_EQ(ToRegister(cache_index()), D::GetRegisterParameter(D::kCacheIndex));
+  __ Move(D::GetRegisterParameter(D::kSlot), Immediate(feedback().index()));
+  // The feedback vector is the only stack parameter.
+  DCHECK_EQ(D::GetRegisterParameterCount(), D::kFeedbackVector);
+  DCHECK_EQ(D::GetStackParameterCount(), 1);
+  __ Push(feedback().vector);
+  __ CallBuiltin(Builtin::kForInNext);
+}
+
+void ForInStep::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                             const ProcessingState& state) {
+  UseRegister(index_input());
+  DefineAsRegister(vreg_state, this);
+}
+void ForInStep::GenerateCode(MaglevCodeGenState* code_gen_state,
+                             const ProcessingState& state) {
+  Register index = ToRegister(index_input());
+  Register result = ToRegister(this->result());
+  if (index != result) __ movq(result, index);
+  if (SmiValuesAre31Bits()) {
+    __ addl(result, Immediate(Smi::FromInt(1)));
+  } else {
+    __ Move(kScratchRegister, Smi::FromInt(1));
+    __ addq(result, kScratchRegister);
+  }
+}
+
+void TaggedNotEqual::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                  const ProcessingState& state) {
+  UseRegister(left_input());
+  UseRegister(right_input());
+  DefineAsRegister(vreg_state, this);
+}
+void TaggedNotEqual::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                  const ProcessingState& state) {
+  Register result = ToRegister(this->result());
+  Label done;
+  // The result register may alias an input, so compare first; LoadRoot
+  // doesn't clobber the flags.
+  __ cmp_tagged(ToRegister(left_input()), ToRegister(right_input()));
+  __ LoadRoot(result, RootIndex::kTrueValue);
+  __ j(not_equal, &done, Label::kNear);
+  __ LoadRoot(result, RootIndex::kFalseValue);
+  __ bind(&done);
+}
+
+void GetSecondReturnedValue::AllocateVreg(
+    MaglevVregAllocationState* vreg_state, const ProcessingState& state) {
+  DefineAsFixed(vreg_state, this, kReturnRegister1);
+}
+void GetSecondReturnedValue::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                          const ProcessingState& state) {
+  // No-op, the value is already in kReturnRegister1. The preceding node is a
+  // call, so the register allocator can't have handed out kReturnRegister1 in
+  // between.
+#ifdef DEBUG
+  Node* previous = nullptr;
+  for (Node* node : state.block()->nodes()) {
+    if (node == this) break;
+    previous = node;
+  }
+  DCHECK_NOT_NULL(previous);
+  DCHECK(previous->properties().is_call());
+#endif  // DEBUG
 }
 
 // ---
@@ -843,6 +1318,50 @@ void BranchIfToBooleanTrue::GenerateCode(MaglevCodeGenState* code_gen_state,
   }
 }
 
+void BranchIfRootConstant::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                        const ProcessingState& state) {
+  UseRegister(condition_input());
+}
+void BranchIfRootConstant::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                        const ProcessingState& state) {
+  Register value = ToRegister(condition_input());
+
+  auto* next_block = state.next_block();
+
+  // We don't have any branch probability information, so try to jump
+  // over whatever the next block emitted is.
+  if (if_false() == next_block) {
+    // Jump over the false block if equal, otherwise fall through into it.
+    __ JumpIfRoot(value, root_index(), if_true()->label());
+  } else {
+    // Jump to the false block if not equal.
+    __ JumpIfNotRoot(value, root_index(), if_false()->label());
+    // Jump to the true block if it's not the next block.
+    if (if_true() != next_block) {
+      __ jmp(if_true()->label());
+    }
+  }
+}
+void BranchIfRootConstant::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << RootsTable::name(root_index()) << ")";
+}
+
+void BranchIfUndefinedOrNull::AllocateVreg(
+    MaglevVregAllocationState* vreg_state, const ProcessingState& state) {
+  UseRegister(condition_input());
+}
+void BranchIfUndefinedOrNull::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                           const ProcessingState& state) {
+  Register value = ToRegister(condition_input());
+  __ JumpIfRoot(value, RootIndex::kUndefinedValue, if_true()->label());
+  __ JumpIfRoot(value, RootIndex::kNullValue, if_true()->label());
+  auto* next_block = state.next_block();
+  if (if_false() != next_block) {
+    __ jmp(if_false()->label());
+  }
+}
+
 }  // namespace maglev
 }  // namespace internal
 }  // namespace v8
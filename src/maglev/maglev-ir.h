@@ -11,10 +11,13 @@
 #include "src/base/threaded-list.h"
 #include "src/common/globals.h"
 #include "src/compiler/backend/instruction.h"
+#include "src/compiler/feedback-source.h"
 #include "src/compiler/heap-refs.h"
 #include "src/interpreter/bytecode-register.h"
 #include "src/objects/smi.h"
 #include "src/roots/roots.h"
+#include "src/runtime/runtime.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
 
 namespace v8 {
@@ -34,33 +37,108 @@ class MaglevVregAllocationState;
 //
 // The macro lists below must match the node class hierarchy.
 
-#define VALUE_NODE_LIST(V) \
-  V(Add)                   \
-  V(CallProperty)          \
-  V(CallUndefinedReceiver) \
-  V(Constant)              \
-  V(Increment)             \
-  V(InitialValue)          \
-  V(LessThan)              \
-  V(LoadField)             \
-  V(LoadGlobal)            \
-  V(LoadNamedGeneric)      \
-  V(Phi)                   \
-  V(RegisterInput)         \
-  V(RootConstant)          \
-  V(SmiConstant)
-
-#define NODE_LIST(V) \
-  V(Checkpoint)      \
-  V(CheckMaps)       \
-  V(SoftDeopt)       \
-  V(StoreToFrame)    \
-  V(GapMove)         \
+#define ARITHMETIC_OPERATION_LIST(V) \
+  V(Add)                             \
+  V(Subtract)                        \
+  V(Multiply)                        \
+  V(Divide)                          \
+  V(Modulus)                         \
+  V(Exponentiate)                    \
+  V(BitwiseAnd)                      \
+  V(BitwiseOr)                       \
+  V(BitwiseXor)                      \
+  V(ShiftLeft)                       \
+  V(ShiftRight)                      \
+  V(ShiftRightLogical)
+
+#define UNARY_OPERATION_LIST(V) \
+  V(BitwiseNot)                 \
+  V(Negate)                     \
+  V(Increment)                  \
+  V(Decrement)
+
+#define COMPARISON_OPERATION_LIST(V) \
+  V(Equal)                           \
+  V(StrictEqual)                     \
+  V(LessThan)                        \
+  V(LessThanOrEqual)                 \
+  V(GreaterThan)                     \
+  V(GreaterThanOrEqual)
+
+#define OPERATION_LIST(V)    \
+  ARITHMETIC_OPERATION_LIST(V) \
+  UNARY_OPERATION_LIST(V)      \
+  COMPARISON_OPERATION_LIST(V)
+
+#define GENERIC_OPERATIONS_NODE_LIST(V) \
+  V(GenericAdd)                         \
+  V(GenericSubtract)                    \
+  V(GenericMultiply)                    \
+  V(GenericDivide)                      \
+  V(GenericModulus)                     \
+  V(GenericExponentiate)                \
+  V(GenericBitwiseAnd)                  \
+  V(GenericBitwiseOr)                   \
+  V(GenericBitwiseXor)                  \
+  V(GenericShiftLeft)                   \
+  V(GenericShiftRight)                  \
+  V(GenericShiftRightLogical)           \
+  V(GenericBitwiseNot)                  \
+  V(GenericNegate)                      \
+  V(GenericIncrement)                   \
+  V(GenericDecrement)                   \
+  V(GenericEqual)                       \
+  V(GenericStrictEqual)                 \
+  V(GenericLessThan)                    \
+  V(GenericLessThanOrEqual)             \
+  V(GenericGreaterThan)                 \
+  V(GenericGreaterThanOrEqual)
+
+#define VALUE_NODE_LIST(V)  \
+  V(Call)                   \
+  V(CallRuntime)            \
+  V(CallWithSpread)         \
+  V(Constant)               \
+  V(Construct)              \
+  V(ConstructWithSpread)    \
+  V(CreateClosure)          \
+  V(FastCreateClosure)      \
+  V(ForInEnumerate)         \
+  V(ForInNext)              \
+  V(ForInPrepare)           \
+  V(ForInStep)              \
+  V(GetSecondReturnedValue) \
+  V(InitialValue)           \
+  V(LoadField)              \
+  V(LoadGlobal)             \
+  V(LoadKeyedGeneric)       \
+  V(LoadNamedGeneric)       \
+  V(LoadTaggedField)        \
+  V(Phi)                    \
+  V(RegisterInput)          \
+  V(RootConstant)           \
+  V(SmiConstant)            \
+  V(TaggedNotEqual)         \
+  V(ToObject)               \
+  GENERIC_OPERATIONS_NODE_LIST(V)
+
+#define NODE_LIST(V)                  \
+  V(Checkpoint)                       \
+  V(CheckMaps)                        \
+  V(CheckMapsPolymorphic)             \
+  V(SoftDeopt)                        \
+  V(StoreKeyedGeneric)                \
+  V(StoreNamedGeneric)                \
+  V(StoreTaggedFieldWithWriteBarrier) \
+  V(StoreToFrame)                     \
+  V(GapMove)                          \
   VALUE_NODE_LIST(V)
 
 #define CONDITIONAL_CONTROL_NODE_LIST(V) \
   V(BranchIfTrue)                        \
-  V(BranchIfToBooleanTrue)
+  V(BranchIfToBooleanTrue)               \
+  V(BranchIfRootConstant)                \
+  V(BranchIfUndefinedOrNull)
 
 #define UNCONDITIONAL_CONTROL_NODE_LIST(V) \
   V(Jump)                                  \
@@ -653,11 +731,16 @@ class FixedInputValueNodeT : public ValueNodeT<Derived> {
   }
 };
 
-template <class Derived>
+template <class Derived, Operation kOperation>
 class UnaryWithFeedbackNode : public FixedInputValueNodeT<1, Derived> {
   using Base = FixedInputValueNodeT<1, Derived>;
 
  public:
+  // The implementation currently calls runtime.
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  static constexpr int kOperandIndex = 0;
+  Input& operand_input() { return Node::input(kOperandIndex); }
   compiler::FeedbackSource feedback() const { return feedback_; }
 
  protected:
@@ -665,30 +748,64 @@ class UnaryWithFeedbackNode : public FixedInputValueNodeT<1, Derived> {
                                  const compiler::FeedbackSource& feedback)
       : Base(input_count), feedback_(feedback) {}
 
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+
   const compiler::FeedbackSource feedback_;
 };
 
-template <class Derived>
+template <class Derived, Operation kOperation>
 class BinaryWithFeedbackNode : public FixedInputValueNodeT<2, Derived> {
   using Base = FixedInputValueNodeT<2, Derived>;
 
  public:
-  compiler::FeedbackSource feedback() const { return feedback_; }
+  // The implementation currently calls runtime.
+  static constexpr OpProperties kProperties = OpProperties::Call();
 
   static constexpr int kLeftIndex = 0;
   static constexpr int kRightIndex = 1;
   Input& left_input() { return Node::input(kLeftIndex); }
   Input& right_input() { return Node::input(kRightIndex); }
+  compiler::FeedbackSource feedback() const { return feedback_; }
 
  protected:
   BinaryWithFeedbackNode(size_t input_count,
                          const compiler::FeedbackSource& feedback)
       : Base(input_count), feedback_(feedback) {}
 
- protected:
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+
   const compiler::FeedbackSource feedback_;
 };
 
+// Generic operations call the *_WithFeedback builtin of the operation, which
+// also records type feedback into the given slot.
+#define DEF_OPERATION_NODE(Name, Super, OpName)                            \
+  class Name : public Super<Name, Operation::k##OpName> {                  \
+    using Base = Super<Name, Operation::k##OpName>;                        \
+                                                                           \
+   public:                                                                 \
+    Name(size_t input_count, const compiler::FeedbackSource& feedback)     \
+        : Base(input_count, feedback) {}                                   \
+    void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&); \
+    void GenerateCode(MaglevCodeGenState*, const ProcessingState&);        \
+    void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}         \
+  };
+
+#define DEF_UNARY_WITH_FEEDBACK_NODE(Name) \
+  DEF_OPERATION_NODE(Generic##Name, UnaryWithFeedbackNode, Name)
+#define DEF_BINARY_WITH_FEEDBACK_NODE(Name) \
+  DEF_OPERATION_NODE(Generic##Name, BinaryWithFeedbackNode, Name)
+UNARY_OPERATION_LIST(DEF_UNARY_WITH_FEEDBACK_NODE)
+ARITHMETIC_OPERATION_LIST(DEF_BINARY_WITH_FEEDBACK_NODE)
+COMPARISON_OPERATION_LIST(DEF_BINARY_WITH_FEEDBACK_NODE)
+#undef DEF_UNARY_WITH_FEEDBACK_NODE
+#undef DEF_BINARY_WITH_FEEDBACK_NODE
+#undef DEF_OPERATION_NODE
+
 class InitialValue : public FixedInputValueNodeT<0, InitialValue> {
   using Base = FixedInputValueNodeT<0, InitialValue>;
 
@@ -833,6 +950,29 @@ class CheckMaps : public FixedInputNodeT<1, CheckMaps> {
   const compiler::MapRef map_;
 };
 
+class CheckMapsPolymorphic : public FixedInputNodeT<1, CheckMapsPolymorphic> {
+  using Base = FixedInputNodeT<1, CheckMapsPolymorphic>;
+
+ public:
+  explicit CheckMapsPolymorphic(size_t input_count,
+                                ZoneVector<compiler::MapRef>&& maps)
+      : Base(input_count), maps_(std::move(maps)) {}
+
+  static constexpr OpProperties kProperties = OpProperties::Deopt();
+
+  const ZoneVector<compiler::MapRef>& maps() const { return maps_; }
+
+  static constexpr int kActualMapIndex = 0;
+  Input& actual_map_input() { return input(kActualMapIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const ZoneVector<compiler::MapRef> maps_;
+};
+
 class LoadField : public FixedInputValueNodeT<1, LoadField> {
   using Base = FixedInputValueNodeT<1, LoadField>;
 
@@ -877,17 +1017,73 @@ class LoadGlobal : public FixedInputValueNodeT<1, LoadGlobal> {
   const compiler::NameRef name_;
 };
 
-class LoadNamedGeneric : public FixedInputValueNodeT<1, LoadNamedGeneric> {
-  using Base = FixedInputValueNodeT<1, LoadNamedGeneric>;
+class LoadNamedGeneric : public FixedInputValueNodeT<2, LoadNamedGeneric> {
+  using Base = FixedInputValueNodeT<2, LoadNamedGeneric>;
 
  public:
-  explicit LoadNamedGeneric(size_t input_count, const compiler::NameRef& name)
-      : Base(input_count), name_(name) {}
+  explicit LoadNamedGeneric(size_t input_count, const compiler::NameRef& name,
+                            const compiler::FeedbackSource& feedback)
+      : Base(input_count), name_(name), feedback_(feedback) {}
 
   // The implementation currently calls runtime.
   static constexpr OpProperties kProperties = OpProperties::Call();
 
   compiler::NameRef name() const { return name_; }
+  compiler::FeedbackSource feedback() const { return feedback_; }
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kObjectIndex = 1;
+  Input& context() { return input(kContextIndex); }
+  Input& object_input() { return input(kObjectIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::NameRef name_;
+  const compiler::FeedbackSource feedback_;
+};
+
+class LoadKeyedGeneric : public FixedInputValueNodeT<3, LoadKeyedGeneric> {
+  using Base = FixedInputValueNodeT<3, LoadKeyedGeneric>;
+
+ public:
+  explicit LoadKeyedGeneric(size_t input_count,
+                            const compiler::FeedbackSource& feedback)
+      : Base(input_count), feedback_(feedback) {}
+
+  // The implementation currently calls runtime.
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  compiler::FeedbackSource feedback() const { return feedback_; }
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kObjectIndex = 1;
+  static constexpr int kKeyIndex = 2;
+  Input& context() { return input(kContextIndex); }
+  Input& object_input() { return input(kObjectIndex); }
+  Input& key_input() { return input(kKeyIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+
+ private:
+  const compiler::FeedbackSource feedback_;
+};
+
+// Loads a tagged field at a fixed offset, e.g. a context slot.
+class LoadTaggedField : public FixedInputValueNodeT<1, LoadTaggedField> {
+  using Base = FixedInputValueNodeT<1, LoadTaggedField>;
+
+ public:
+  explicit LoadTaggedField(size_t input_count, int offset)
+      : Base(input_count), offset_(offset) {}
+
+  static constexpr OpProperties kProperties = OpProperties::Reading();
+
+  int offset() const { return offset_; }
 
   static constexpr int kObjectIndex = 0;
   Input& object_input() { return input(kObjectIndex); }
@@ -896,26 +1092,95 @@ class LoadNamedGeneric : public FixedInputValueNodeT<1, LoadNamedGeneric> {
   void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
   void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
 
+ private:
+  const int offset_;
+};
+
+class StoreNamedGeneric : public FixedInputNodeT<3, StoreNamedGeneric> {
+  using Base = FixedInputNodeT<3, StoreNamedGeneric>;
+
+ public:
+  explicit StoreNamedGeneric(size_t input_count, const compiler::NameRef& name,
+                             const compiler::FeedbackSource& feedback)
+      : Base(input_count), name_(name), feedback_(feedback) {}
+
+  // The implementation currently calls runtime.
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  compiler::NameRef name() const { return name_; }
+  compiler::FeedbackSource feedback() const { return feedback_; }
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kObjectIndex = 1;
+  static constexpr int kValueIndex = 2;
+  Input& context() { return input(kContextIndex); }
+  Input& object_input() { return input(kObjectIndex); }
+  Input& value_input() { return input(kValueIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
  private:
   const compiler::NameRef name_;
+  const compiler::FeedbackSource feedback_;
 };
 
-class Increment : public UnaryWithFeedbackNode<Increment> {
-  using Base = UnaryWithFeedbackNode<Increment>;
+class StoreKeyedGeneric : public FixedInputNodeT<4, StoreKeyedGeneric> {
+  using Base = FixedInputNodeT<4, StoreKeyedGeneric>;
 
  public:
-  Increment(size_t input_count, const compiler::FeedbackSource& feedback)
-      : Base(input_count, feedback) {}
+  explicit StoreKeyedGeneric(size_t input_count,
+                             const compiler::FeedbackSource& feedback)
+      : Base(input_count), feedback_(feedback) {}
 
   // The implementation currently calls runtime.
   static constexpr OpProperties kProperties = OpProperties::Call();
 
-  static constexpr int kOperandIndex = 0;
-  Input& operand_input() { return input(kOperandIndex); }
+  compiler::FeedbackSource feedback() const { return feedback_; }
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kObjectIndex = 1;
+  static constexpr int kKeyIndex = 2;
+  static constexpr int kValueIndex = 3;
+  Input& context() { return input(kContextIndex); }
+  Input& object_input() { return input(kObjectIndex); }
+  Input& key_input() { return input(kKeyIndex); }
+  Input& value_input() { return input(kValueIndex); }
 
   void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
   void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
   void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+
+ private:
+  const compiler::FeedbackSource feedback_;
+};
+
+// Stores a tagged value at a fixed offset, e.g. a context slot, and emits the
+// write barrier for it.
+class StoreTaggedFieldWithWriteBarrier
+    : public FixedInputNodeT<2, StoreTaggedFieldWithWriteBarrier> {
+  using Base = FixedInputNodeT<2, StoreTaggedFieldWithWriteBarrier>;
+
+ public:
+  explicit StoreTaggedFieldWithWriteBarrier(size_t input_count, int offset)
+      : Base(input_count), offset_(offset) {}
+
+  static constexpr OpProperties kProperties = OpProperties::Writing();
+
+  int offset() const { return offset_; }
+
+  static constexpr int kObjectIndex = 0;
+  static constexpr int kValueIndex = 1;
+  Input& object_input() { return input(kObjectIndex); }
+  Input& value_input() { return input(kValueIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const int offset_;
 };
 
 class StoreToFrame : public FixedInputNodeT<0, StoreToFrame> {
@@ -958,33 +1223,6 @@ class GapMove : public FixedInputNodeT<0, GapMove> {
   compiler::AllocatedOperand target_;
 };
 
-class Add : public BinaryWithFeedbackNode<Add> {
-  using Base = BinaryWithFeedbackNode<Add>;
-
- public:
-  explicit Add(size_t input_count, const compiler::FeedbackSource& feedback)
-      : Base(input_count, feedback) {}
-
-  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
-  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
-  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
-};
-
-class LessThan : public BinaryWithFeedbackNode<LessThan> {
-  using Base = BinaryWithFeedbackNode<LessThan>;
-
- public:
-  LessThan(size_t input_count, const compiler::FeedbackSource& feedback)
-      : Base(input_count, feedback) {}
-
-  // The implementation currently calls runtime.
-  static constexpr OpProperties kProperties = OpProperties::Call();
-
-  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
-  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
-  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
-};
-
 // TODO(verwaest): It may make more sense to buffer phis in merged_states until
 // we set up the interpreter frame state for code generation. At that point we
 // can generate correctly-sized phis.
@@ -1018,50 +1256,407 @@ class Phi : public ValueNodeT<Phi> {
   friend base::ThreadedListTraits<Phi>;
 };
 
-class CallProperty : public ValueNodeT<CallProperty> {
-  using Base = ValueNodeT<CallProperty>;
+class Call : public ValueNodeT<Call> {
+  using Base = ValueNodeT<Call>;
+
+ public:
+  // We assume function and context as fixed inputs.
+  static constexpr int kFunctionIndex = 0;
+  static constexpr int kContextIndex = 1;
+  static constexpr int kFixedInputCount = 2;
+
+  // This ctor is used when for variable input counts.
+  // Inputs must be initialized manually.
+  Call(size_t input_count, ConvertReceiverMode mode, ValueNode* function,
+       ValueNode* context)
+      : Base(input_count), receiver_mode_(mode) {
+    set_input(kFunctionIndex, function);
+    set_input(kContextIndex, context);
+  }
+
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  ConvertReceiverMode receiver_mode() const { return receiver_mode_; }
+
+  Input& function() { return input(kFunctionIndex); }
+  const Input& function() const { return input(kFunctionIndex); }
+  Input& context() { return input(kContextIndex); }
+  const Input& context() const { return input(kContextIndex); }
+  // The arguments include the receiver.
+  int num_args() const { return input_count() - kFixedInputCount; }
+  Input& arg(int i) { return input(i + kFixedInputCount); }
+  void set_arg(int i, ValueNode* node) {
+    set_input(i + kFixedInputCount, node);
+  }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const ConvertReceiverMode receiver_mode_;
+};
+
+class Construct : public ValueNodeT<Construct> {
+  using Base = ValueNodeT<Construct>;
+
+ public:
+  // We assume function, new target and context as fixed inputs.
+  static constexpr int kFunctionIndex = 0;
+  static constexpr int kNewTargetIndex = 1;
+  static constexpr int kContextIndex = 2;
+  static constexpr int kFixedInputCount = 3;
+
+  // This ctor is used when for variable input counts.
+  // Inputs must be initialized manually.
+  Construct(size_t input_count, ValueNode* function, ValueNode* new_target,
+            ValueNode* context)
+      : Base(input_count) {
+    set_input(kFunctionIndex, function);
+    set_input(kNewTargetIndex, new_target);
+    set_input(kContextIndex, context);
+  }
+
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  Input& function() { return input(kFunctionIndex); }
+  const Input& function() const { return input(kFunctionIndex); }
+  Input& new_target() { return input(kNewTargetIndex); }
+  const Input& new_target() const { return input(kNewTargetIndex); }
+  Input& context() { return input(kContextIndex); }
+  const Input& context() const { return input(kContextIndex); }
+  // The arguments include the receiver slot.
+  int num_args() const { return input_count() - kFixedInputCount; }
+  Input& arg(int i) { return input(i + kFixedInputCount); }
+  void set_arg(int i, ValueNode* node) {
+    set_input(i + kFixedInputCount, node);
+  }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+class CallWithSpread : public ValueNodeT<CallWithSpread> {
+  using Base = ValueNodeT<CallWithSpread>;
+
+ public:
+  // We assume function and context as fixed inputs.
+  static constexpr int kFunctionIndex = 0;
+  static constexpr int kContextIndex = 1;
+  static constexpr int kFixedInputCount = 2;
+
+  // This ctor is used when for variable input counts.
+  // Inputs must be initialized manually.
+  CallWithSpread(size_t input_count, ValueNode* function, ValueNode* context)
+      : Base(input_count) {
+    set_input(kFunctionIndex, function);
+    set_input(kContextIndex, context);
+  }
+
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  Input& function() { return input(kFunctionIndex); }
+  const Input& function() const { return input(kFunctionIndex); }
+  Input& context() { return input(kContextIndex); }
+  const Input& context() const { return input(kContextIndex); }
+  // The arguments include the receiver and end with the spread, which is
+  // passed in a register instead of on the stack.
+  int num_args() const { return input_count() - kFixedInputCount; }
+  int num_args_no_spread() const { return num_args() - 1; }
+  Input& arg(int i) { return input(i + kFixedInputCount); }
+  void set_arg(int i, ValueNode* node) {
+    set_input(i + kFixedInputCount, node);
+  }
+  Input& spread() { return input(input_count() - 1); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+class ConstructWithSpread : public ValueNodeT<ConstructWithSpread> {
+  using Base = ValueNodeT<ConstructWithSpread>;
 
  public:
-  explicit CallProperty(size_t input_count) : Base(input_count) {}
+  // We assume function, new target and context as fixed inputs.
+  static constexpr int kFunctionIndex = 0;
+  static constexpr int kNewTargetIndex = 1;
+  static constexpr int kContextIndex = 2;
+  static constexpr int kFixedInputCount = 3;
 
   // This ctor is used when for variable input counts.
   // Inputs must be initialized manually.
-  CallProperty(size_t input_count, ValueNode* function, ValueNode* context)
+  ConstructWithSpread(size_t input_count, ValueNode* function,
+                      ValueNode* new_target, ValueNode* context)
       : Base(input_count) {
-    set_input(0, function);
-    set_input(1, context);
+    set_input(kFunctionIndex, function);
+    set_input(kNewTargetIndex, new_target);
+    set_input(kContextIndex, context);
   }
 
   static constexpr OpProperties kProperties = OpProperties::Call();
 
-  Input& function() { return input(0); }
-  const Input& function() const { return input(0); }
-  Input& context() { return input(1); }
-  const Input& context() const { return input(1); }
-  int num_args() const { return input_count() - 2; }
-  Input& arg(int i) { return input(i + 2); }
-  void set_arg(int i, ValueNode* node) { set_input(i + 2, node); }
+  Input& function() { return input(kFunctionIndex); }
+  const Input& function() const { return input(kFunctionIndex); }
+  Input& new_target() { return input(kNewTargetIndex); }
+  const Input& new_target() const { return input(kNewTargetIndex); }
+  Input& context() { return input(kContextIndex); }
+  const Input& context() const { return input(kContextIndex); }
+  // The arguments include the receiver slot and end with the spread, which is
+  // passed in a register instead of on the stack.
+  int num_args() const { return input_count() - kFixedInputCount; }
+  int num_args_no_spread() const { return num_args() - 1; }
+  Input& arg(int i) { return input(i + kFixedInputCount); }
+  void set_arg(int i, ValueNode* node) {
+    set_input(i + kFixedInputCount, node);
+  }
+  Input& spread() { return input(input_count() - 1); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+class CallRuntime : public ValueNodeT<CallRuntime> {
+  using Base = ValueNodeT<CallRuntime>;
+
+ public:
+  // We assume the context as fixed input.
+  static constexpr int kContextIndex = 0;
+  static constexpr int kFixedInputCount = 1;
+
+  // This ctor is used when for variable input counts.
+  // Inputs must be initialized manually.
+  CallRuntime(size_t input_count, Runtime::FunctionId function_id,
+              ValueNode* context)
+      : Base(input_count), function_id_(function_id) {
+    set_input(kContextIndex, context);
+  }
+
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  Runtime::FunctionId function_id() const { return function_id_; }
+
+  Input& context() { return input(kContextIndex); }
+  const Input& context() const { return input(kContextIndex); }
+  int num_args() const { return input_count() - kFixedInputCount; }
+  Input& arg(int i) { return input(i + kFixedInputCount); }
+  void set_arg(int i, ValueNode* node) {
+    set_input(i + kFixedInputCount, node);
+  }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const Runtime::FunctionId function_id_;
+};
+
+class FastCreateClosure : public FixedInputValueNodeT<1, FastCreateClosure> {
+  using Base = FixedInputValueNodeT<1, FastCreateClosure>;
+
+ public:
+  explicit FastCreateClosure(
+      size_t input_count,
+      const compiler::SharedFunctionInfoRef& shared_function_info,
+      const compiler::FeedbackCellRef& feedback_cell)
+      : Base(input_count),
+        shared_function_info_(shared_function_info),
+        feedback_cell_(feedback_cell) {}
+
+  // The implementation currently calls a builtin.
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  compiler::SharedFunctionInfoRef shared_function_info() const {
+    return shared_function_info_;
+  }
+  compiler::FeedbackCellRef feedback_cell() const { return feedback_cell_; }
+
+  Input& context() { return input(0); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::SharedFunctionInfoRef shared_function_info_;
+  const compiler::FeedbackCellRef feedback_cell_;
+};
+
+class CreateClosure : public FixedInputValueNodeT<1, CreateClosure> {
+  using Base = FixedInputValueNodeT<1, CreateClosure>;
+
+ public:
+  explicit CreateClosure(
+      size_t input_count,
+      const compiler::SharedFunctionInfoRef& shared_function_info,
+      const compiler::FeedbackCellRef& feedback_cell, bool pretenured)
+      : Base(input_count),
+        shared_function_info_(shared_function_info),
+        feedback_cell_(feedback_cell),
+        pretenured_(pretenured) {}
+
+  // The implementation currently calls runtime.
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  compiler::SharedFunctionInfoRef shared_function_info() const {
+    return shared_function_info_;
+  }
+  compiler::FeedbackCellRef feedback_cell() const { return feedback_cell_; }
+  bool pretenured() const { return pretenured_; }
+
+  Input& context() { return input(0); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::SharedFunctionInfoRef shared_function_info_;
+  const compiler::FeedbackCellRef feedback_cell_;
+  const bool pretenured_;
+};
+
+class ToObject : public FixedInputValueNodeT<2, ToObject> {
+  using Base = FixedInputValueNodeT<2, ToObject>;
+
+ public:
+  explicit ToObject(size_t input_count) : Base(input_count) {}
+
+  // The implementation currently calls a builtin.
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kValueIndex = 1;
+  Input& context() { return input(kContextIndex); }
+  Input& value_input() { return input(kValueIndex); }
 
   void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
   void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
   void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
 };
 
-class CallUndefinedReceiver : public ValueNodeT<CallUndefinedReceiver> {
-  using Base = ValueNodeT<CallUndefinedReceiver>;
+class ForInEnumerate : public FixedInputValueNodeT<2, ForInEnumerate> {
+  using Base = FixedInputValueNodeT<2, ForInEnumerate>;
 
  public:
-  explicit CallUndefinedReceiver(size_t input_count) : Base(input_count) {}
+  explicit ForInEnumerate(size_t input_count) : Base(input_count) {}
 
+  // The implementation currently calls a builtin.
   static constexpr OpProperties kProperties = OpProperties::Call();
 
-  Input& function() { return input(0); }
-  const Input& function() const { return input(0); }
-  Input& context() { return input(1); }
-  const Input& context() const { return input(1); }
-  int num_args() const { return input_count() - 2; }
-  Input& arg(int i) { return input(i + 2); }
-  void set_arg(int i, ValueNode* node) { set_input(i + 2, node); }
+  static constexpr int kContextIndex = 0;
+  static constexpr int kReceiverIndex = 1;
+  Input& context() { return input(kContextIndex); }
+  Input& receiver_input() { return input(kReceiverIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+// Returns the cache array, and the cache length as a second value which has to
+// be read by a GetSecondReturnedValue node right after this one.
+class ForInPrepare : public FixedInputValueNodeT<2, ForInPrepare> {
+  using Base = FixedInputValueNodeT<2, ForInPrepare>;
+
+ public:
+  explicit ForInPrepare(size_t input_count,
+                        const compiler::FeedbackSource& feedback)
+      : Base(input_count), feedback_(feedback) {}
+
+  // The implementation currently calls a builtin.
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  compiler::FeedbackSource feedback() const { return feedback_; }
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kEnumeratorIndex = 1;
+  Input& context() { return input(kContextIndex); }
+  Input& enumerator() { return input(kEnumeratorIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+
+ private:
+  const compiler::FeedbackSource feedback_;
+};
+
+class ForInNext : public FixedInputValueNodeT<5, ForInNext> {
+  using Base = FixedInputValueNodeT<5, ForInNext>;
+
+ public:
+  explicit ForInNext(size_t input_count,
+                     const compiler::FeedbackSource& feedback)
+      : Base(input_count), feedback_(feedback) {}
+
+  // The implementation currently calls a builtin.
+  static constexpr OpProperties kProperties = OpProperties::Call();
+
+  compiler::FeedbackSource feedback() const { return feedback_; }
+
+  static constexpr int kContextIndex = 0;
+  static constexpr int kReceiverIndex = 1;
+  static constexpr int kCacheArrayIndex = 2;
+  static constexpr int kCacheTypeIndex = 3;
+  static constexpr int kCacheIndexIndex = 4;
+  Input& context() { return input(kContextIndex); }
+  Input& receiver() { return input(kReceiverIndex); }
+  Input& cache_array() { return input(kCacheArrayIndex); }
+  Input& cache_type() { return input(kCacheTypeIndex); }
+  Input& cache_index() { return input(kCacheIndexIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+
+ private:
+  const compiler::FeedbackSource feedback_;
+};
+
+// Increments the Smi for-in index.
+class ForInStep : public FixedInputValueNodeT<1, ForInStep> {
+  using Base = FixedInputValueNodeT<1, ForInStep>;
+
+ public:
+  explicit ForInStep(size_t input_count) : Base(input_count) {}
+
+  static constexpr int kIndexIndex = 0;
+  Input& index_input() { return input(kIndexIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+// Produces true if the two inputs are not the same tagged value.
+class TaggedNotEqual : public FixedInputValueNodeT<2, TaggedNotEqual> {
+  using Base = FixedInputValueNodeT<2, TaggedNotEqual>;
+
+ public:
+  explicit TaggedNotEqual(size_t input_count) : Base(input_count) {}
+
+  static constexpr int kLeftIndex = 0;
+  static constexpr int kRightIndex = 1;
+  Input& left_input() { return input(kLeftIndex); }
+  Input& right_input() { return input(kRightIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
+// Picks up the second return register of the call node immediately preceding
+// it, e.g. the cache length of ForInPrepare.
+class GetSecondReturnedValue
+    : public FixedInputValueNodeT<0, GetSecondReturnedValue> {
+  using Base = FixedInputValueNodeT<0, GetSecondReturnedValue>;
+
+ public:
+  explicit GetSecondReturnedValue(size_t input_count) : Base(input_count) {}
 
   void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
   void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
@@ -1346,6 +1941,43 @@ class BranchIfToBooleanTrue
   void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
 };
 
+class BranchIfRootConstant
+    : public ConditionalControlNodeT<BranchIfRootConstant> {
+  using Base = ConditionalControlNodeT<BranchIfRootConstant>;
+
+ public:
+  explicit BranchIfRootConstant(size_t input_count,
+                                BasicBlockRef* if_true_refs,
+                                BasicBlockRef* if_false_refs,
+                                RootIndex root_index)
+      : Base(input_count, if_true_refs, if_false_refs),
+        root_index_(root_index) {}
+
+  RootIndex root_index() const { return root_index_; }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const RootIndex root_index_;
+};
+
+class BranchIfUndefinedOrNull
+    : public ConditionalControlNodeT<BranchIfUndefinedOrNull> {
+  using Base = ConditionalControlNodeT<BranchIfUndefinedOrNull>;
+
+ public:
+  explicit BranchIfUndefinedOrNull(size_t input_count,
+                                   BasicBlockRef* if_true_refs,
+                                   BasicBlockRef* if_false_refs)
+      : Base(input_count, if_true_refs, if_false_refs) {}
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+};
+
 const OpProperties& NodeBase::properties() const {
   switch (opcode()) {
 #define V(Name)         \
@@ -280,6 +280,9 @@ void StraightForwardRegisterAllocator::AllocateRegisters(Graph* graph) {
         if (phi->result().operand().IsAllocated()) continue;
         LiveNodeInfo& info = values_[phi];
         AllocateSpillSlot(&info);
+        // Record the slot as the phi's spill slot too, so that deopts can
+        // read the phi from it.
+        phi->Spill(info.stack_slot->slot);
         // TODO(verwaest): Will this be used at all?
         phi->result().SetAllocated(info.stack_slot->slot);
         if (FLAG_trace_maglev_regalloc) {
@@ -30,7 +30,10 @@ MaybeHandle<CodeT> Maglev::Compile(Isolate* isolate,
   broker.StopSerializing();
 
   maglev::MaglevCompiler compiler(&broker, function);
-  return ToCodeT(compiler.Compile(), isolate);
+  if (!compiler.Compile()) return {};
+  // Nothing can invalidate the dependencies between compilation and code
+  // generation on the main thread.
+  return ToCodeT(compiler.GenerateCode().ToHandleChecked(), isolate);
 }
 
 }  // namespace internal
@@ -156,6 +156,14 @@ void FeedbackVector::set_maybe_has_optimized_code(bool value) {
   set_flags(MaybeHasOptimizedCodeBit::update(flags(), value));
 }
 
+bool FeedbackVector::osr_compilation_in_progress() const {
+  return OsrCompilationInProgressBit::decode(flags());
+}
+
+void FeedbackVector::set_osr_compilation_in_progress(bool value) {
+  set_flags(OsrCompilationInProgressBit::update(flags(), value));
+}
+
 bool FeedbackVector::has_optimization_marker() const {
   return optimization_marker() != OptimizationMarker::kNone;
 }
@@ -239,6 +239,11 @@ class FeedbackVector
   inline bool maybe_has_optimized_code() const;
   inline void set_maybe_has_optimized_code(bool value);
 
+  // Whether a concurrent OSR job for the function has been queued and not
+  // finalized yet. Keeps back edges from queueing more jobs meanwhile.
+  inline bool osr_compilation_in_progress() const;
+  inline void set_osr_compilation_in_progress(bool value);
+
   inline bool has_optimization_marker() const;
   inline OptimizationMarker optimization_marker() const;
   void EvictOptimizedCodeMarkedForDeoptimization(SharedFunctionInfo shared,
@@ -30,6 +30,7 @@
 #include "src/objects/heap-object.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/lookup-cache-inl.h"
 #include "src/objects/lookup.h"
 #include "src/objects/map-updater.h"
 #include "src/objects/objects-inl.h"
@@ -856,6 +857,8 @@ void JSReceiver::DeleteNormalizedProperty(Handle<JSReceiver> object,
     } else {
       Handle<NameDictionary> dictionary(object->property_dictionary(), isolate);
 
+      isolate->dictionary_lookup_cache()->Invalidate(object->map(),
+                                                     dictionary->NameAt(entry));
       dictionary = NameDictionary::DeleteEntry(isolate, dictionary, entry);
       object->SetProperties(*dictionary);
     }
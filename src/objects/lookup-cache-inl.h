@@ -37,6 +37,22 @@ void DescriptorLookupCache::Update(Map source, Name name, int result) {
   results_[index] = result;
 }
 
+// static
+int DictionaryLookupCache::Hash(Map map, Name name) {
+  DCHECK(name.IsUniqueName());
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t map_hash = static_cast<uint32_t>(map.ptr()) >> kTaggedSizeLog2;
+  uint32_t name_hash = name.hash();
+  return (map_hash ^ name_hash) & (kLength - 1);
+}
+
+void DictionaryLookupCache::Invalidate(Map map, Name name) {
+  Entry& entry = entries_[Hash(map, name)];
+  if (entry.map == map.ptr() && entry.name == name.ptr()) {
+    entry.map = kNullAddress;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
 
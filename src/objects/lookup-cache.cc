@@ -11,5 +11,11 @@ void DescriptorLookupCache::Clear() {
   for (int index = 0; index < kLength; index++) keys_[index].source = Map();
 }
 
+void DictionaryLookupCache::Clear() {
+  for (int index = 0; index < kLength; index++) {
+    entries_[index].map = kNullAddress;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
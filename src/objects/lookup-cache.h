@@ -55,6 +55,50 @@ class DescriptorLookupCache {
   friend class Isolate;
 };
 
+// Cache for mapping (map, property name) into the key index of the property
+// in the NameDictionary of a dictionary-mode object. It is filled and read by
+// the generic keyed load in generated code (see
+// AccessorAssembler::CachedNameDictionaryLookup).
+//
+// Dictionary-mode maps are shared between objects, so a hit is only used
+// after checking that the key at the cached index of the object's dictionary
+// is the name. Deleting a property invalidates its entry; added properties
+// don't move the others, and growing or shrinking a dictionary allocates a new
+// one. Cleared at startup and prior to any gc.
+class DictionaryLookupCache {
+ public:
+  DictionaryLookupCache(const DictionaryLookupCache&) = delete;
+  DictionaryLookupCache& operator=(const DictionaryLookupCache&) = delete;
+
+  // The keys are stored as full (untagged) words, they are never
+  // dereferenced and only used for identity checks.
+  struct Entry {
+    Address map;
+    Address name;
+    intptr_t name_index;
+  };
+
+  // Drop the entry for (map, name), if there is one.
+  inline void Invalidate(Map map, Name name);
+
+  // Clear the cache.
+  void Clear();
+
+  Address address() { return reinterpret_cast<Address>(entries_); }
+
+  // Generated code computes the same hash.
+  static inline int Hash(Map map, Name name);
+
+  static const int kLength = 256;
+
+ private:
+  DictionaryLookupCache() { Clear(); }
+
+  Entry entries_[kLength];
+
+  friend class Isolate;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -6,6 +6,7 @@
 
 #include <utility>
 
+#include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/base/optional.h"
 #include "src/base/vector.h"
@@ -15,6 +16,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/api-callbacks.h"
@@ -2608,8 +2610,12 @@ class OutputStreamWriter {
     AddSubstring(s, static_cast<int>(len));
   }
   void AddSubstring(const char* s, int n) {
-    if (n <= 0) return;
     DCHECK_LE(n, strlen(s));
+    AddBytes(s, n);
+  }
+  // Unlike AddSubstring, |s| may contain \0 bytes.
+  void AddBytes(const char* s, int n) {
+    if (n <= 0) return;
     const char* s_end = s + n;
     while (s < s_end) {
       int s_chunk_size =
@@ -2791,75 +2797,241 @@ static int utoa(T value, const base::Vector<char>& buffer, int buffer_pos) {
   return utoa_impl(unsigned_value, buffer, buffer_pos);
 }
 
-void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
-                                               bool first_edge) {
-  // The buffer needs space for 3 unsigned ints, 3 commas, \n and \0
-  static const int kBufferSize =
-      MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned * 3 + 3 + 2;
-  base::EmbeddedVector<char, kBufferSize> buffer;
-  int edge_name_or_index = edge->type() == HeapGraphEdge::kElement
-      || edge->type() == HeapGraphEdge::kHidden
-      ? edge->index() : GetStringId(edge->name());
+namespace {
+
+// The buffer needs space for 3 unsigned ints, 3 commas, \n and \0
+constexpr int kMaxEdgeLength =
+    MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned * 3 + 3 + 2;
+// The buffer needs space for 5 unsigned ints, 1 size_t, 1 uint8_t, 7 commas,
+// \n and \0
+constexpr int kMaxNodeLength =
+    5 * MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned +
+    MaxDecimalDigitsIn<sizeof(size_t)>::kUnsigned +
+    MaxDecimalDigitsIn<sizeof(uint8_t)>::kUnsigned + 7 + 1 + 1;
+
+}  // namespace
+
+struct HeapSnapshotJSONSerializer::Batch {
+  enum class State { kPending, kFormatting, kDone };
+
+  BatchKind kind = BatchKind::kNodes;
+  size_t begin = 0;
+  size_t end = 0;
+  // Name string ids of nodes, or name string ids resp. indices of edges.
+  std::vector<int> ids;
+  // Formatted text, terminated by \0.
+  std::vector<char> text;
+  int length = 0;
+  std::atomic<State> state{State::kDone};
+};
+
+class HeapSnapshotJSONSerializer::FormatBatchesJob final : public JobTask {
+ public:
+  explicit FormatBatchesJob(HeapSnapshotJSONSerializer* serializer)
+      : serializer_(serializer) {}
+
+  void Run(JobDelegate* delegate) final {
+    while (!delegate->ShouldYield()) {
+      Batch* batch = serializer_->ClaimPendingBatch();
+      if (batch == nullptr) return;
+      serializer_->FormatBatch(batch);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const final {
+    return serializer_->pending_batches_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  HeapSnapshotJSONSerializer* const serializer_;
+};
+
+// static
+int HeapSnapshotJSONSerializer::FormatEdge(const HeapGraphEdge* edge,
+                                           int edge_name_or_index,
+                                           bool first_edge, char* buffer) {
+  base::Vector<char> vector(buffer, kMaxEdgeLength);
   int buffer_pos = 0;
   if (!first_edge) {
-    buffer[buffer_pos++] = ',';
+    vector[buffer_pos++] = ',';
+  }
+  buffer_pos = utoa(edge->type(), vector, buffer_pos);
+  vector[buffer_pos++] = ',';
+  buffer_pos = utoa(edge_name_or_index, vector, buffer_pos);
+  vector[buffer_pos++] = ',';
+  buffer_pos = utoa(to_node_index(edge->to()), vector, buffer_pos);
+  vector[buffer_pos++] = '\n';
+  return buffer_pos;
+}
+
+// static
+int HeapSnapshotJSONSerializer::FormatNode(const HeapEntry* entry, int name_id,
+                                           char* buffer) {
+  base::Vector<char> vector(buffer, kMaxNodeLength);
+  int buffer_pos = 0;
+  if (to_node_index(entry) != 0) {
+    vector[buffer_pos++] = ',';
+  }
+  buffer_pos = utoa(entry->type(), vector, buffer_pos);
+  vector[buffer_pos++] = ',';
+  buffer_pos = utoa(name_id, vector, buffer_pos);
+  vector[buffer_pos++] = ',';
+  buffer_pos = utoa(entry->id(), vector, buffer_pos);
+  vector[buffer_pos++] = ',';
+  buffer_pos = utoa(entry->self_size(), vector, buffer_pos);
+  vector[buffer_pos++] = ',';
+  buffer_pos = utoa(entry->children_count(), vector, buffer_pos);
+  vector[buffer_pos++] = ',';
+  buffer_pos = utoa(entry->trace_node_id(), vector, buffer_pos);
+  vector[buffer_pos++] = ',';
+  buffer_pos = utoa(entry->detachedness(), vector, buffer_pos);
+  vector[buffer_pos++] = '\n';
+  return buffer_pos;
+}
+
+void HeapSnapshotJSONSerializer::PrepareBatch(Batch* batch, size_t begin,
+                                              size_t end) {
+  DCHECK_EQ(Batch::State::kDone, batch->state.load(std::memory_order_relaxed));
+  batch->begin = begin;
+  batch->end = end;
+  batch->ids.clear();
+  // String ids are handed out in serialization order, which keeps the output
+  // independent of how batches are formatted.
+  if (batch->kind == BatchKind::kNodes) {
+    const std::deque<HeapEntry>& entries = snapshot_->entries();
+    for (size_t i = begin; i < end; ++i) {
+      batch->ids.push_back(GetStringId(entries[i].name()));
+    }
+  } else {
+    const std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+    for (size_t i = begin; i < end; ++i) {
+      const HeapGraphEdge* edge = edges[i];
+      DCHECK(i == 0 || edges[i - 1]->from()->index() <= edge->from()->index());
+      batch->ids.push_back(edge->type() == HeapGraphEdge::kElement ||
+                                   edge->type() == HeapGraphEdge::kHidden
+                               ? edge->index()
+                               : GetStringId(edge->name()));
+    }
+  }
+}
+
+void HeapSnapshotJSONSerializer::FormatBatch(Batch* batch) {
+  DCHECK_EQ(Batch::State::kFormatting,
+            batch->state.load(std::memory_order_relaxed));
+  const size_t max_length = batch->kind == BatchKind::kNodes ? kMaxNodeLength
+                                                             : kMaxEdgeLength;
+  batch->text.resize((batch->end - batch->begin) * max_length + 1);
+  char* buffer = batch->text.data();
+  int length = 0;
+  if (batch->kind == BatchKind::kNodes) {
+    const std::deque<HeapEntry>& entries = snapshot_->entries();
+    for (size_t i = batch->begin; i < batch->end; ++i) {
+      length += FormatNode(&entries[i], batch->ids[i - batch->begin],
+                           buffer + length);
+    }
+  } else {
+    const std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+    for (size_t i = batch->begin; i < batch->end; ++i) {
+      length += FormatEdge(edges[i], batch->ids[i - batch->begin], i == 0,
+                           buffer + length);
+    }
   }
-  buffer_pos = utoa(edge->type(), buffer, buffer_pos);
-  buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(edge_name_or_index, buffer, buffer_pos);
-  buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(to_node_index(edge->to()), buffer, buffer_pos);
-  buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[length] = '\0';
+  batch->length = length;
+  {
+    base::MutexGuard guard(&batch_mutex_);
+    batch->state.store(Batch::State::kDone, std::memory_order_release);
+  }
+  batch_done_.NotifyAll();
 }
 
-void HeapSnapshotJSONSerializer::SerializeEdges() {
-  std::vector<HeapGraphEdge*>& edges = snapshot_->children();
-  for (size_t i = 0; i < edges.size(); ++i) {
-    DCHECK(i == 0 ||
-           edges[i - 1]->from()->index() <= edges[i]->from()->index());
-    SerializeEdge(edges[i], i == 0);
-    if (writer_->aborted()) return;
+HeapSnapshotJSONSerializer::Batch*
+HeapSnapshotJSONSerializer::ClaimPendingBatch() {
+  for (std::unique_ptr<Batch>& batch : batches_) {
+    Batch::State expected = Batch::State::kPending;
+    if (batch->state.compare_exchange_strong(expected,
+                                             Batch::State::kFormatting,
+                                             std::memory_order_acq_rel)) {
+      pending_batches_.fetch_sub(1, std::memory_order_relaxed);
+      return batch.get();
+    }
   }
+  return nullptr;
 }
 
-void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
-  // The buffer needs space for 5 unsigned ints, 1 size_t, 1 uint8_t, 7 commas,
-  // \n and \0
-  static const int kBufferSize =
-      5 * MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned +
-      MaxDecimalDigitsIn<sizeof(size_t)>::kUnsigned +
-      MaxDecimalDigitsIn<sizeof(uint8_t)>::kUnsigned + 7 + 1 + 1;
-  base::EmbeddedVector<char, kBufferSize> buffer;
-  int buffer_pos = 0;
-  if (to_node_index(entry) != 0) {
-    buffer[buffer_pos++] = ',';
+void HeapSnapshotJSONSerializer::SerializeInBatches(BatchKind kind,
+                                                    size_t count) {
+  const size_t batch_count = (count + kBatchSize - 1) / kBatchSize;
+  const size_t batches_in_flight = std::min(batch_count, kMaxBatchesInFlight);
+  DCHECK(batches_.empty());
+  for (size_t i = 0; i < batches_in_flight; ++i) {
+    batches_.push_back(std::make_unique<Batch>());
+    batches_.back()->kind = kind;
+  }
+  // Workers only help when there is more than one batch in flight.
+  std::unique_ptr<JobHandle> job;
+  if (FLAG_heap_snapshot_parallel_serialization && batches_in_flight > 1) {
+    job = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserBlocking, std::make_unique<FormatBatchesJob>(this));
+  }
+
+  size_t next_to_prepare = 0;
+  for (size_t next_to_write = 0; next_to_write < batch_count;
+       ++next_to_write) {
+    // Keep all batch slots busy so that workers can run ahead of the stream.
+    for (; next_to_prepare < batch_count &&
+           next_to_prepare - next_to_write < batches_in_flight;
+         ++next_to_prepare) {
+      Batch* batch = batches_[next_to_prepare % batches_in_flight].get();
+      PrepareBatch(batch, next_to_prepare * kBatchSize,
+                   std::min(count, (next_to_prepare + 1) * kBatchSize));
+      batch->state.store(Batch::State::kPending, std::memory_order_release);
+      pending_batches_.fetch_add(1, std::memory_order_relaxed);
+      if (job) job->NotifyConcurrencyIncrease();
+    }
+    Batch* batch = batches_[next_to_write % batches_in_flight].get();
+    // Format the batch on the main thread unless a worker already picked it
+    // up. While a worker formats it, help with the batches behind it instead
+    // of blocking, and only wait once none of them is left pending.
+    Batch::State expected = Batch::State::kPending;
+    if (batch->state.compare_exchange_strong(expected,
+                                             Batch::State::kFormatting,
+                                             std::memory_order_acq_rel)) {
+      pending_batches_.fetch_sub(1, std::memory_order_relaxed);
+      FormatBatch(batch);
+    }
+    while (batch->state.load(std::memory_order_acquire) !=
+           Batch::State::kDone) {
+      if (Batch* other = ClaimPendingBatch()) {
+        FormatBatch(other);
+        continue;
+      }
+      base::MutexGuard guard(&batch_mutex_);
+      while (batch->state.load(std::memory_order_acquire) !=
+                 Batch::State::kDone &&
+             pending_batches_.load(std::memory_order_relaxed) == 0) {
+        batch_done_.Wait(&batch_mutex_);
+      }
+    }
+    // The batch goes to the stream as soon as it is formatted; the JSON
+    // layout requires nodes and edges in index order.
+    writer_->AddSubstring(batch->text.data(), batch->length);
+    if (writer_->aborted()) break;
   }
-  buffer_pos = utoa(entry->type(), buffer, buffer_pos);
-  buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(GetStringId(entry->name()), buffer, buffer_pos);
-  buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(entry->id(), buffer, buffer_pos);
-  buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(entry->self_size(), buffer, buffer_pos);
-  buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(entry->children_count(), buffer, buffer_pos);
-  buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(entry->trace_node_id(), buffer, buffer_pos);
-  buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(entry->detachedness(), buffer, buffer_pos);
-  buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+
+  // Waits for workers that are still formatting batches nobody is going to
+  // write after an abort.
+  if (job) job->Cancel();
+  batches_.clear();
+  pending_batches_.store(0, std::memory_order_relaxed);
+}
+
+void HeapSnapshotJSONSerializer::SerializeEdges() {
+  SerializeInBatches(BatchKind::kEdges, snapshot_->children().size());
 }
 
 void HeapSnapshotJSONSerializer::SerializeNodes() {
-  const std::deque<HeapEntry>& entries = snapshot_->entries();
-  for (const HeapEntry& entry : entries) {
-    SerializeNode(&entry);
-    if (writer_->aborted()) return;
-  }
+  SerializeInBatches(BatchKind::kNodes, snapshot_->entries().size());
 }
 
 void HeapSnapshotJSONSerializer::SerializeSnapshot() {
@@ -3170,5 +3342,108 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+void HeapSnapshotBinarySerializer::Serialize(v8::OutputStream* stream) {
+  DCHECK_NULL(writer_);
+  writer_ = new OutputStreamWriter(stream);
+  SerializeImpl();
+  delete writer_;
+  writer_ = nullptr;
+}
+
+void HeapSnapshotBinarySerializer::SerializeImpl() {
+  DCHECK_EQ(0, snapshot_->root()->index());
+  writer_->AddBytes(kMagic, static_cast<int>(strlen(kMagic)));
+  WriteVarint(kVersion);
+  SerializeNodes();
+  if (writer_->aborted()) return;
+  SerializeEdges();
+  if (writer_->aborted()) return;
+  SerializeLocations();
+  if (writer_->aborted()) return;
+  SerializeStrings();
+  if (writer_->aborted()) return;
+  writer_->Finalize();
+}
+
+uint32_t HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  auto result =
+      string_ids_.emplace(s, static_cast<uint32_t>(strings_.size()));
+  if (result.second) strings_.push_back(s);
+  return result.first->second;
+}
+
+void HeapSnapshotBinarySerializer::WriteVarint(uint64_t value) {
+  // Same encoding as base::VLQEncodeUnsigned, widened to 64 bits.
+  char buffer[10];
+  int length = 0;
+  do {
+    uint8_t byte = value & 0x7F;
+    value >>= 7;
+    if (value != 0) byte |= 0x80;
+    buffer[length++] = static_cast<char>(byte);
+  } while (value != 0);
+  writer_->AddBytes(buffer, length);
+}
+
+void HeapSnapshotBinarySerializer::SerializeNodes() {
+  const std::deque<HeapEntry>& entries = snapshot_->entries();
+  WriteVarint(entries.size());
+  SnapshotObjectId previous_id = 0;
+  for (const HeapEntry& entry : entries) {
+    // Ids mostly increase in steps of two, which keeps the deltas at a single
+    // byte.
+    int64_t delta = static_cast<int64_t>(entry.id()) - previous_id;
+    previous_id = entry.id();
+    WriteVarint(entry.type());
+    WriteVarint(GetStringId(entry.name()));
+    WriteVarint((static_cast<uint64_t>(delta) << 1) ^
+                static_cast<uint64_t>(delta >> 63));
+    WriteVarint(entry.self_size());
+    WriteVarint(entry.children_count());
+    WriteVarint(entry.trace_node_id());
+    WriteVarint(entry.detachedness());
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeEdges() {
+  const std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  WriteVarint(edges.size());
+  for (const HeapGraphEdge* edge : edges) {
+    WriteVarint(edge->type());
+    WriteVarint(edge->type() == HeapGraphEdge::kElement ||
+                        edge->type() == HeapGraphEdge::kHidden
+                    ? edge->index()
+                    : GetStringId(edge->name()));
+    WriteVarint(edge->to()->index());
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeLocations() {
+  const std::vector<SourceLocation>& locations = snapshot_->locations();
+  WriteVarint(locations.size());
+  for (const SourceLocation& location : locations) {
+    WriteVarint(static_cast<uint32_t>(location.entry_index));
+    WriteVarint(static_cast<uint32_t>(location.scriptId));
+    DCHECK_GE(location.line, -1);
+    DCHECK_GE(location.col, -1);
+    WriteVarint(static_cast<uint32_t>(location.line + 1));
+    WriteVarint(static_cast<uint32_t>(location.col + 1));
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeStrings() {
+  WriteVarint(strings_.size());
+  for (const char* s : strings_) {
+    size_t length = strlen(s);
+    DCHECK_GE(kMaxInt, length);
+    WriteVarint(length);
+    writer_->AddBytes(s, static_cast<int>(length));
+    if (writer_->aborted()) return;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_PROFILER_HEAP_SNAPSHOT_GENERATOR_H_
 #define V8_PROFILER_HEAP_SNAPSHOT_GENERATOR_H_
 
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <unordered_map>
@@ -12,6 +13,8 @@
 #include <vector>
 
 #include "include/v8-profiler.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
 #include "src/objects/fixed-array.h"
@@ -661,13 +664,37 @@ class HeapSnapshotJSONSerializer {
 
   V8_INLINE static uint32_t StringHash(const void* string);
 
+  // Nodes and edges are serialized in batches of this many items. Formatting a
+  // batch into text does not touch the string table and may happen on a
+  // background thread.
+  static constexpr size_t kBatchSize = 16 * 1024;
+  // Upper bound on the batches that are formatted or waiting to be written to
+  // the stream at any time. This only bounds the text buffered by the
+  // serializer; the snapshot graph itself is fully built before serialization
+  // starts and dominates peak memory.
+  //
+  // Nodes can't be streamed while the graph is being extracted: a node's
+  // edge_count is only known once all of its edges are, and edges refer to
+  // node indices. Extraction also stays on the main thread, since it calls
+  // object accessors and fills the shared entries and object id maps.
+  static constexpr size_t kMaxBatchesInFlight = 8;
+
+  enum class BatchKind { kNodes, kEdges };
+  struct Batch;
+  class FormatBatchesJob;
+
   int GetStringId(const char* s);
-  V8_INLINE int to_node_index(const HeapEntry* e);
-  V8_INLINE int to_node_index(int entry_index);
-  void SerializeEdge(HeapGraphEdge* edge, bool first_edge);
+  V8_INLINE static int to_node_index(const HeapEntry* e);
+  V8_INLINE static int to_node_index(int entry_index);
+  static int FormatEdge(const HeapGraphEdge* edge, int edge_name_or_index,
+                        bool first_edge, char* buffer);
+  static int FormatNode(const HeapEntry* entry, int name_id, char* buffer);
+  void PrepareBatch(Batch* batch, size_t begin, size_t end);
+  void FormatBatch(Batch* batch);
+  Batch* ClaimPendingBatch();
+  void SerializeInBatches(BatchKind kind, size_t count);
   void SerializeEdges();
   void SerializeImpl();
-  void SerializeNode(const HeapEntry* entry);
   void SerializeNodes();
   void SerializeSnapshot();
   void SerializeTraceTree();
@@ -688,10 +715,60 @@ class HeapSnapshotJSONSerializer {
   int next_string_id_;
   OutputStreamWriter* writer_;
 
+  std::vector<std::unique_ptr<Batch>> batches_;
+  std::atomic<size_t> pending_batches_{0};
+  base::Mutex batch_mutex_;
+  base::ConditionVariable batch_done_;
+
   friend class HeapSnapshotJSONSerializerEnumerator;
   friend class HeapSnapshotJSONSerializerIterator;
 };
 
+// Writes a heap snapshot in a compact binary format. All numbers are unsigned
+// LEB128 varints and node references are node indices rather than offsets
+// into the node array. The layout is
+//
+//   "V8HS" version
+//   node_count {type name id_delta self_size edge_count trace_node_id
+//               detachedness}*
+//   edge_count {type name_or_index to_node}*
+//   location_count {node script_id line column}*
+//   string_count {length bytes}*
+//
+// Node ids are zigzag encoded differences to the id of the previous node.
+// Lines and columns are stored plus one, so that an unknown position (-1)
+// takes a single byte. Edges are grouped by their source node in node order.
+// Allocation traces and samples are not serialized.
+// tools/heap-snapshot-binary.py reads the format and converts it to the JSON
+// format.
+class HeapSnapshotBinarySerializer {
+ public:
+  static constexpr char kMagic[] = "V8HS";
+  static constexpr uint32_t kVersion = 1;
+
+  explicit HeapSnapshotBinarySerializer(HeapSnapshot* snapshot)
+      : snapshot_(snapshot) {}
+  HeapSnapshotBinarySerializer(const HeapSnapshotBinarySerializer&) = delete;
+  HeapSnapshotBinarySerializer& operator=(
+      const HeapSnapshotBinarySerializer&) = delete;
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  uint32_t GetStringId(const char* s);
+  void WriteVarint(uint64_t value);
+  void SerializeImpl();
+  void SerializeNodes();
+  void SerializeEdges();
+  void SerializeLocations();
+  void SerializeStrings();
+
+  HeapSnapshot* snapshot_;
+  // Names in a snapshot are interned in the heap profiler's StringsStorage, so
+  // strings are deduplicated by address.
+  std::unordered_map<const char*, uint32_t> string_ids_;
+  std::vector<const char*> strings_;
+  OutputStreamWriter* writer_ = nullptr;
+};
 
 }  // namespace internal
 }  // namespace v8
@@ -299,6 +299,13 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
   BytecodeOffset osr_offset = DetermineEntryAndDisarmOSRForUnoptimized(frame);
   DCHECK(!osr_offset.IsNone());
 
+  // With concurrent OSR, the frame keeps running unoptimized code while the
+  // job runs in the background, and enters the result at a later back edge.
+  const ConcurrencyMode mode =
+      FLAG_concurrent_osr && isolate->concurrent_recompilation_enabled()
+          ? ConcurrencyMode::kConcurrent
+          : ConcurrencyMode::kNotConcurrent;
+
   MaybeHandle<CodeT> maybe_result;
   Handle<JSFunction> function(frame->function(), isolate);
   if (IsSuitableForOnStackReplacement(isolate, function)) {
@@ -306,10 +313,12 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
       PrintF(scope.file(), "[OSR - Compiling: ");
       function->PrintName(scope.file());
-      PrintF(scope.file(), " at OSR bytecode offset %d]\n", osr_offset.ToInt());
+      PrintF(scope.file(), " at OSR bytecode offset %d%s]\n",
+             osr_offset.ToInt(),
+             mode == ConcurrencyMode::kConcurrent ? " (concurrent)" : "");
     }
-    maybe_result =
-        Compiler::GetOptimizedCodeForOSR(isolate, function, osr_offset, frame);
+    maybe_result = Compiler::GetOptimizedCodeForOSR(isolate, function,
+                                                    osr_offset, frame, mode);
   }
 
   // Check whether we ended up with usable optimized code.
@@ -350,22 +359,38 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
       // the optimization occurs concurrently off main thread.
       if (!function->HasAvailableOptimizedCode() &&
           function->feedback_vector().invocation_count() > 1) {
-        // If we're not already optimized, set to optimize non-concurrently on
-        // the next call, otherwise we'd run unoptimized once more and
-        // potentially compile for OSR again.
+        // If we're not already optimized, set to optimize on the next call,
+        // otherwise we'd run unoptimized once more and potentially compile for
+        // OSR again. Concurrent OSR doesn't stall the caller either.
         if (FLAG_trace_osr) {
           CodeTracer::Scope scope(isolate->GetCodeTracer());
           PrintF(scope.file(), "[OSR - Re-marking ");
           function->PrintName(scope.file());
-          PrintF(scope.file(), " for non-concurrent optimization]\n");
+          PrintF(scope.file(), " for %s optimization]\n",
+                 mode == ConcurrencyMode::kConcurrent ? "concurrent"
+                                                      : "non-concurrent");
         }
         function->SetOptimizationMarker(
-            OptimizationMarker::kCompileTurbofan_NotConcurrent);
+            mode == ConcurrencyMode::kConcurrent
+                ? OptimizationMarker::kCompileTurbofan_Concurrent
+                : OptimizationMarker::kCompileTurbofan_NotConcurrent);
       }
       return *result;
     }
   }
 
+  // Keep running unoptimized code while the job is in the background.
+  if (mode == ConcurrencyMode::kConcurrent && function->has_feedback_vector() &&
+      function->feedback_vector().osr_compilation_in_progress()) {
+    if (FLAG_trace_osr) {
+      CodeTracer::Scope scope(isolate->GetCodeTracer());
+      PrintF(scope.file(), "[OSR - Compilation in progress: ");
+      function->PrintName(scope.file());
+      PrintF(scope.file(), " at OSR bytecode offset %d]\n", osr_offset.ToInt());
+    }
+    return Object();
+  }
+
   // Failed.
   if (FLAG_trace_osr) {
     CodeTracer::Scope scope(isolate->GetCodeTracer());
@@ -38,6 +38,7 @@
 #include "src/web-snapshot/web-snapshot.h"
 
 #ifdef V8_ENABLE_MAGLEV
+#include "src/maglev/maglev-concurrent-dispatcher.h"
 #include "src/maglev/maglev.h"
 #endif  // V8_ENABLE_MAGLEV
 
@@ -412,7 +413,10 @@ RUNTIME_FUNCTION(Runtime_BenchMaglev) {
   Handle<CodeT> codet;
   base::ElapsedTimer timer;
   timer.Start();
-  codet = Maglev::Compile(isolate, function).ToHandleChecked();
+  if (!Maglev::Compile(isolate, function).ToHandle(&codet)) {
+    PrintF("Maglev bailed out.\n");
+    return ReadOnlyRoots(isolate).undefined_value();
+  }
   for (int i = 1; i < count; ++i) {
     HandleScope handle_scope(isolate);
     Maglev::Compile(isolate, function);
@@ -434,7 +438,9 @@ RUNTIME_FUNCTION(Runtime_BenchMaglev) {
 #ifdef V8_ENABLE_MAGLEV
 RUNTIME_FUNCTION(Runtime_OptimizeMaglevOnNextCall) {
   HandleScope scope(isolate);
-  DCHECK_EQ(args.length(), 1);
+  if (args.length() != 1 && args.length() != 2) {
+    return CrashUnlessFuzzing(isolate);
+  }
   CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
 
   static constexpr CodeKind kCodeKind = CodeKind::MAGLEV;
@@ -447,8 +453,16 @@ RUNTIME_FUNCTION(Runtime_OptimizeMaglevOnNextCall) {
   DCHECK(is_compiled_scope.is_compiled());
   DCHECK(function->is_compiled());
 
-  // TODO(v8:7700): Support concurrent compiles.
-  const ConcurrencyMode concurrency_mode = ConcurrencyMode::kNotConcurrent;
+  ConcurrencyMode concurrency_mode = ConcurrencyMode::kNotConcurrent;
+  if (args.length() == 2) {
+    CONVERT_ARG_HANDLE_CHECKED(Object, type, 1);
+    if (!type->IsString()) return CrashUnlessFuzzing(isolate);
+    if (Handle<String>::cast(type)->IsOneByteEqualTo(
+            base::StaticCharVector("concurrent")) &&
+        isolate->maglev_concurrent_dispatcher()->is_enabled()) {
+      concurrency_mode = ConcurrencyMode::kConcurrent;
+    }
+  }
 
   if (FLAG_trace_opt) {
     PrintF("[manually marking ");
@@ -735,6 +749,11 @@ RUNTIME_FUNCTION(Runtime_WaitForBackgroundOptimization) {
   if (isolate->concurrent_recompilation_enabled()) {
     isolate->optimizing_compile_dispatcher()->AwaitCompileTasks();
   }
+#ifdef V8_ENABLE_MAGLEV
+  if (isolate->maglev_concurrent_dispatcher()->is_enabled()) {
+    isolate->maglev_concurrent_dispatcher()->AwaitCompileJobs();
+  }
+#endif  // V8_ENABLE_MAGLEV
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
@@ -745,6 +764,12 @@ RUNTIME_FUNCTION(Runtime_FinalizeOptimization) {
     isolate->optimizing_compile_dispatcher()->InstallOptimizedFunctions();
     isolate->optimizing_compile_dispatcher()->set_finalize(true);
   }
+#ifdef V8_ENABLE_MAGLEV
+  if (isolate->maglev_concurrent_dispatcher()->is_enabled()) {
+    isolate->maglev_concurrent_dispatcher()->AwaitCompileJobs();
+    isolate->maglev_concurrent_dispatcher()->FinalizeFinishedJobs();
+  }
+#endif  // V8_ENABLE_MAGLEV
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
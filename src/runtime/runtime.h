@@ -530,7 +530,7 @@ namespace internal {
   F(NeverOptimizeFunction, 1, 1)              \
   F(NewRegExpWithBacktrackLimit, 3, 1)        \
   F(NotifyContextDisposed, 0, 1)              \
-  F(OptimizeMaglevOnNextCall, 1, 1)           \
+  F(OptimizeMaglevOnNextCall, -1, 1)          \
   F(OptimizeFunctionOnNextCall, -1, 1)        \
   F(OptimizeOsr, -1, 1)                       \
   F(PrepareFunctionForOptimization, -1, 1)    \
@@ -84,6 +84,10 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
     double ms = timer.Elapsed().InMillisecondsF();
     int length = cached_data->length();
     PrintF("[Serializing to %d bytes took %0.3f ms]\n", length, ms);
+    if (FLAG_cache_baseline_code) {
+      PrintF("[Serialized %d bytes of baseline code]\n",
+             cs.baseline_code_size_);
+    }
   }
 
   ScriptCompiler::CachedData* result =
@@ -139,7 +143,15 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
 
   if (SerializeReadOnlyObject(obj)) return;
 
-  CHECK(!obj->IsCode(cage_base()));
+  if (obj->IsCode(cage_base())) {
+    // The only code we serialize is baseline code, see
+    // CanSerializeBaselineCode.
+    Handle<Code> code = Handle<Code>::cast(obj);
+    CHECK_EQ(code->kind(), CodeKind::BASELINE);
+    baseline_code_size_ += code->Size();
+    SerializeGeneric(obj);
+    return;
+  }
 
   ReadOnlyRoots roots(isolate());
   if (ElideObject(*obj)) {
@@ -245,6 +257,18 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
   SerializeGeneric(obj);
 }
 
+bool CodeSerializer::CanSerializeBaselineCode(Code code) {
+  if (!FLAG_cache_baseline_code) return false;
+  // Builtins are only referenced through their embedded entry, which is
+  // serialized as a builtin id. Code targets and runtime entries (as used by
+  // short builtin calls) would refer to code of the serializing process.
+  static constexpr int kUnserializableModeMask =
+      RelocInfo::ModeMask(RelocInfo::CODE_TARGET) |
+      RelocInfo::ModeMask(RelocInfo::RELATIVE_CODE_TARGET) |
+      RelocInfo::ModeMask(RelocInfo::RUNTIME_ENTRY);
+  return RelocIterator(code, kUnserializableModeMask).done();
+}
+
 void CodeSerializer::SerializeGeneric(Handle<HeapObject> heap_object) {
   // Object has not yet been serialized.  Serialize it here.
   ObjectSerializer serializer(this, heap_object, &sink_);
@@ -371,13 +395,22 @@ void FinalizeDeserialization(Isolate* isolate,
               script->GetLineNumber(shared_info->StartPosition()) + 1;
           int column_num =
               script->GetColumnNumber(shared_info->StartPosition()) + 1;
-          PROFILE(
-              isolate,
-              CodeCreateEvent(
-                  shared_info->is_toplevel() ? CodeEventListener::SCRIPT_TAG
-                                             : CodeEventListener::FUNCTION_TAG,
-                  handle(shared_info->abstract_code(isolate), isolate),
-                  shared_info, name, line_num, column_num));
+          CodeEventListener::LogEventsAndTags tag =
+              shared_info->is_toplevel() ? CodeEventListener::SCRIPT_TAG
+                                         : CodeEventListener::FUNCTION_TAG;
+          PROFILE(isolate,
+                  CodeCreateEvent(
+                      tag, handle(shared_info->abstract_code(isolate), isolate),
+                      shared_info, name, line_num, column_num));
+          if (shared_info->HasBaselineCode()) {
+            Handle<AbstractCode> baseline_code(
+                AbstractCode::cast(
+                    FromCodeT(shared_info->baseline_code(kAcquireLoad))),
+                isolate);
+            PROFILE(isolate,
+                    CodeCreateEvent(tag, baseline_code, shared_info, name,
+                                    line_num, column_num));
+          }
         }
       }
     }
@@ -401,7 +434,13 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     return thread.Finalize(isolate, source, origin_options);
     // TODO(leszeks): Compare off-thread deserialized data to on-thread.
   }
+  return DeserializeOnMainThread(isolate, cached_data, source, origin_options);
+}
 
+// static
+MaybeHandle<SharedFunctionInfo> CodeSerializer::DeserializeOnMainThread(
+    Isolate* isolate, AlignedCachedData* cached_data, Handle<String> source,
+    ScriptOriginOptions origin_options) {
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization || FLAG_log_function_events) timer.Start();
 
@@ -459,6 +498,13 @@ CodeSerializer::StartDeserializeOffThread(LocalIsolate* local_isolate,
     return result;
   }
 
+  if (scd.HasBaselineCode()) {
+    // Code can't be allocated and flushed from the instruction cache
+    // off-thread. Leave it all to FinishOffThreadDeserialize.
+    result.deserialize_on_main_thread = true;
+    return result;
+  }
+
   MaybeHandle<SharedFunctionInfo> local_maybe_result =
       OffThreadObjectDeserializer::DeserializeSharedFunctionInfo(
           local_isolate, &scd, &result.scripts);
@@ -474,6 +520,11 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
     Isolate* isolate, OffThreadDeserializeData&& data,
     AlignedCachedData* cached_data, Handle<String> source,
     ScriptOriginOptions origin_options) {
+  if (data.deserialize_on_main_thread) {
+    return DeserializeOnMainThread(isolate, cached_data, source,
+                                   origin_options);
+  }
+
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization || FLAG_log_function_events) timer.Start();
 
@@ -570,6 +621,8 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   SetHeaderValue(kSourceHashOffset, cs->source_hash());
   SetHeaderValue(kFlagHashOffset, FlagList::Hash());
   SetHeaderValue(kPayloadLengthOffset, static_cast<uint32_t>(payload->size()));
+  SetHeaderValue(kBaselineCodeSizeOffset,
+                 static_cast<uint32_t>(cs->baseline_code_size()));
 
   // Zero out any padding in the header.
   memset(data_ + kUnalignedHeaderSize, 0, kHeaderSize - kUnalignedHeaderSize);
@@ -68,6 +68,9 @@ class CodeSerializer : public Serializer {
     std::vector<Handle<Script>> scripts;
     std::unique_ptr<PersistentHandles> persistent_handles;
     SerializedCodeSanityCheckResult sanity_check_result;
+    // Set for caches that contain baseline code, which can only be
+    // deserialized on the main thread.
+    bool deserialize_on_main_thread = false;
   };
 
   CodeSerializer(const CodeSerializer&) = delete;
@@ -93,6 +96,7 @@ class CodeSerializer : public Serializer {
                              ScriptOriginOptions origin_options);
 
   uint32_t source_hash() const { return source_hash_; }
+  int baseline_code_size() const { return baseline_code_size_; }
 
  protected:
   CodeSerializer(Isolate* isolate, uint32_t source_hash);
@@ -102,12 +106,21 @@ class CodeSerializer : public Serializer {
   void SerializeGeneric(Handle<HeapObject> heap_object);
 
  private:
+  // Deserializes without going through a background thread, even under
+  // --stress-background-compile.
+  static MaybeHandle<SharedFunctionInfo> DeserializeOnMainThread(
+      Isolate* isolate, AlignedCachedData* cached_data, Handle<String> source,
+      ScriptOriginOptions origin_options);
+
   void SerializeObjectImpl(Handle<HeapObject> o) override;
+  bool CanSerializeBaselineCode(Code code) override;
 
   bool SerializeReadOnlyObject(Handle<HeapObject> obj);
 
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
+  // Size of the baseline code included in the cache.
+  int baseline_code_size_ = 0;
 };
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
@@ -119,13 +132,16 @@ class SerializedCodeData : public SerializedData {
   // [2] source hash
   // [3] flag hash
   // [4] payload length
-  // [5] payload checksum
+  // [5] size of the baseline code in the payload
+  // [6] payload checksum
   // ...  serialized payload
   static const uint32_t kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
   static const uint32_t kSourceHashOffset = kVersionHashOffset + kUInt32Size;
   static const uint32_t kFlagHashOffset = kSourceHashOffset + kUInt32Size;
   static const uint32_t kPayloadLengthOffset = kFlagHashOffset + kUInt32Size;
-  static const uint32_t kChecksumOffset = kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kBaselineCodeSizeOffset =
+      kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kChecksumOffset = kBaselineCodeSizeOffset + kUInt32Size;
   static const uint32_t kUnalignedHeaderSize = kChecksumOffset + kUInt32Size;
   static const uint32_t kHeaderSize = POINTER_SIZE_ALIGN(kUnalignedHeaderSize);
 
@@ -154,6 +170,12 @@ class SerializedCodeData : public SerializedData {
 
   base::Vector<const byte> Payload() const;
 
+  // Whether the payload contains baseline code, which has to be deserialized
+  // on the main thread. See --cache-baseline-code.
+  bool HasBaselineCode() const {
+    return GetHeaderValue(kBaselineCodeSizeOffset) != 0;
+  }
+
   static uint32_t SourceHash(Handle<String> source,
                              ScriptOriginOptions origin_options);
 
@@ -4,10 +4,13 @@
 
 #include "src/snapshot/object-deserializer.h"
 
+#include "src/base/optional.h"
 #include "src/codegen/assembler-inl.h"
+#include "src/codegen/flush-instruction-cache.h"
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/logging/counters.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects.h"
@@ -20,7 +23,8 @@ namespace internal {
 ObjectDeserializer::ObjectDeserializer(Isolate* isolate,
                                        const SerializedCodeData* data)
     : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), true,
-                   false) {}
+                   false),
+      has_baseline_code_(data->HasBaselineCode()) {}
 
 MaybeHandle<SharedFunctionInfo>
 ObjectDeserializer::DeserializeSharedFunctionInfo(
@@ -40,9 +44,14 @@ MaybeHandle<HeapObject> ObjectDeserializer::Deserialize() {
   HandleScope scope(isolate());
   Handle<HeapObject> result;
   {
+    // Only caches with baseline code allocate code, see
+    // CodeSerializer::CanSerializeBaselineCode.
+    base::Optional<CodePageCollectionMemoryModificationScope> code_allocation;
+    if (has_baseline_code_) code_allocation.emplace(isolate()->heap());
     result = ReadObject();
     DeserializeDeferredObjects();
-    CHECK(new_code_objects().empty());
+    CHECK_IMPLIES(!new_code_objects().empty(), has_baseline_code_);
+    FlushICache();
     LinkAllocationSites();
     CHECK(new_maps().empty());
     WeakenDescriptorArrays();
@@ -76,6 +85,16 @@ void ObjectDeserializer::CommitPostProcessedObjects() {
   }
 }
 
+void ObjectDeserializer::FlushICache() {
+  for (Handle<Code> code : new_code_objects()) {
+    DCHECK_EQ(code->kind(), CodeKind::BASELINE);
+    FlushInstructionCache(code->raw_instruction_start(),
+                          code->raw_instruction_size());
+    isolate()->counters()->total_baseline_code_size_deserialized()->Increment(
+        code->Size());
+  }
+}
+
 void ObjectDeserializer::LinkAllocationSites() {
   DisallowGarbageCollection no_gc;
   Heap* heap = isolate()->heap();
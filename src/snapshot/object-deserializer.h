@@ -25,8 +25,11 @@ class ObjectDeserializer final : public Deserializer<Isolate> {
   // Deserialize an object graph. Fail gracefully.
   MaybeHandle<HeapObject> Deserialize();
 
+  void FlushICache();
   void LinkAllocationSites();
   void CommitPostProcessedObjects();
+
+  const bool has_baseline_code_;
 };
 
 // Deserializes the object graph rooted at a given object.
@@ -132,10 +132,9 @@ void Serializer::SerializeObject(Handle<HeapObject> obj) {
     obj = handle(ThinString::cast(*obj).actual(isolate()), isolate());
   } else if (obj->IsCodeT(isolate())) {
     Code code = FromCodeT(CodeT::cast(*obj));
-    if (code.kind() == CodeKind::BASELINE) {
-      // For now just serialize the BytecodeArray instead of baseline code.
-      // TODO(v8:11429,pthier): Handle Baseline code in cases we want to
-      // serialize it.
+    if (code.kind() == CodeKind::BASELINE && !CanSerializeBaselineCode(code)) {
+      // Serialize the BytecodeArray instead of baseline code, which will be
+      // compiled again when needed.
       obj = handle(code.bytecode_or_interpreter_data(isolate()), isolate());
     }
   }
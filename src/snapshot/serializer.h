@@ -227,6 +227,10 @@ class Serializer : public SerializerDeserializer {
 
   virtual bool MustBeDeferred(HeapObject object);
 
+  // Whether the given Sparkplug code is serialized as is. Otherwise its
+  // BytecodeArray is serialized in its place.
+  virtual bool CanSerializeBaselineCode(Code code) { return false; }
+
   void VisitRootPointers(Root root, const char* description,
                          FullObjectSlot start, FullObjectSlot end) override;
   void SerializeRootObject(FullObjectSlot slot);
@@ -10,6 +10,7 @@
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/base/platform/wrappers.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -67,7 +68,8 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
 }  // namespace
 
 AccountingAllocator::AccountingAllocator()
-    : zone_backing_malloc_(
+    : max_pooled_memory_(FLAG_zone_segment_pool_size),
+      zone_backing_malloc_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetMallocFn()),
       zone_backing_free_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetFreeFn()) {
@@ -80,7 +82,15 @@ AccountingAllocator::AccountingAllocator()
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
+
+// static
+int AccountingAllocator::SizeClassFor(size_t bytes) {
+  if (bytes > (size_t{1} << kMaxSegmentSizePower)) return -1;
+  int power = kMinSegmentSizePower;
+  while ((size_t{1} << power) < bytes) power++;
+  return power - kMinSegmentSizePower;
+}
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -91,19 +101,38 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
   } else {
+    int size_class = max_pooled_memory_ > 0 ? SizeClassFor(bytes) : -1;
+    if (size_class >= 0) {
+      Segment* segment = AllocateSegmentFromPool(size_class);
+      if (segment != nullptr) {
+        segment_pool_hits_.fetch_add(1, std::memory_order_relaxed);
+        size_t size = segment->total_size();
+        UpdateMaxMemoryUsage(
+            current_memory_usage_.fetch_add(size, std::memory_order_relaxed) +
+            size);
+        return segment;
+      }
+      segment_pool_misses_.fetch_add(1, std::memory_order_relaxed);
+      // Round up to the size class, so that the segment can be pooled later.
+      bytes = size_t{1} << (size_class + kMinSegmentSizePower);
+    }
     memory = AllocWithRetry(bytes, zone_backing_malloc_);
   }
   if (memory == nullptr) return nullptr;
 
-  size_t current =
-      current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  UpdateMaxMemoryUsage(
+      current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) +
+      bytes);
+  DCHECK_LE(sizeof(Segment), bytes);
+  return new (memory) Segment(bytes);
+}
+
+void AccountingAllocator::UpdateMaxMemoryUsage(size_t current) {
   size_t max = max_memory_usage_.load(std::memory_order_relaxed);
   while (current > max && !max_memory_usage_.compare_exchange_weak(
                               max, current, std::memory_order_relaxed)) {
     // {max} was updated by {compare_exchange_weak}; retry.
   }
-  DCHECK_LE(sizeof(Segment), bytes);
-  return new (memory) Segment(bytes);
 }
 
 void AccountingAllocator::ReturnSegment(Segment* segment,
@@ -111,11 +140,63 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
-  } else {
-    zone_backing_free_(segment);
+    return;
+  }
+  if (ReturnSegmentToPool(segment)) return;
+  segment->ZapHeader();
+  zone_backing_free_(segment);
+}
+
+Segment* AccountingAllocator::AllocateSegmentFromPool(int size_class) {
+  base::MutexGuard guard(&segment_pool_mutex_);
+  Segment* segment = segment_pool_[size_class];
+  if (segment == nullptr) return nullptr;
+  segment_pool_[size_class] = segment->next();
+  segment->set_next(nullptr);
+  pooled_memory_usage_.fetch_sub(segment->total_size(),
+                                 std::memory_order_relaxed);
+  return segment;
+}
+
+bool AccountingAllocator::ReturnSegmentToPool(Segment* segment) {
+  size_t segment_size = segment->total_size();
+  int size_class = SizeClassFor(segment_size);
+  // Only segments that were rounded up to their size class can be handed out
+  // again for any request of that class.
+  if (size_class < 0 ||
+      segment_size != size_t{1} << (size_class + kMinSegmentSizePower)) {
+    return false;
+  }
+  base::MutexGuard guard(&segment_pool_mutex_);
+  size_t pooled = pooled_memory_usage_.load(std::memory_order_relaxed);
+  if (pooled + segment_size > max_pooled_memory_) return false;
+  pooled_memory_usage_.store(pooled + segment_size, std::memory_order_relaxed);
+  segment->set_zone(nullptr);
+  segment->set_next(segment_pool_[size_class]);
+  segment_pool_[size_class] = segment;
+  return true;
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  Segment* pooled_segments[kNumberOfSizeClasses];
+  {
+    base::MutexGuard guard(&segment_pool_mutex_);
+    for (int i = 0; i < kNumberOfSizeClasses; i++) {
+      pooled_segments[i] = segment_pool_[i];
+      segment_pool_[i] = nullptr;
+    }
+    pooled_memory_usage_.store(0, std::memory_order_relaxed);
+  }
+  for (Segment* segment : pooled_segments) {
+    while (segment != nullptr) {
+      Segment* next = segment->next();
+      segment->ZapHeader();
+      zone_backing_free_(segment);
+      segment = next;
+    }
   }
 }
 
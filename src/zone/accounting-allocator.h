@@ -10,6 +10,7 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -35,9 +36,12 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   Segment* AllocateSegment(size_t bytes, bool supports_compression);
 
   // Return unneeded segments to either insert them into the pool or release
-  // them if the pool is already full or memory pressure is high.
+  // them if the pool is already full.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
+  // Releases all pooled segments, e.g. on memory pressure.
+  void ReleasePooledSegments();
+
   size_t GetCurrentMemoryUsage() const {
     return current_memory_usage_.load(std::memory_order_relaxed);
   }
@@ -46,6 +50,21 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Memory held by pooled segments, which is not part of the current memory
+  // usage.
+  size_t GetPooledMemoryUsage() const {
+    return pooled_memory_usage_.load(std::memory_order_relaxed);
+  }
+
+  // Number of segment allocations that could and could not be served from the
+  // pool, respectively. Allocations that are never pooled are not counted.
+  size_t GetSegmentPoolHits() const {
+    return segment_pool_hits_.load(std::memory_order_relaxed);
+  }
+  size_t GetSegmentPoolMisses() const {
+    return segment_pool_misses_.load(std::memory_order_relaxed);
+  }
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,8 +86,34 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Segments are pooled in power-of-two size classes from 8KB, the minimum
+  // segment size of a Zone, up to 64KB. Larger segments are rare one-off
+  // allocations and are always released.
+  static constexpr int kMinSegmentSizePower = 13;
+  static constexpr int kMaxSegmentSizePower = 16;
+  static constexpr int kNumberOfSizeClasses =
+      kMaxSegmentSizePower - kMinSegmentSizePower + 1;
+
+  // Returns the size class for a segment of the given size, or -1 if segments
+  // of that size are not pooled.
+  static int SizeClassFor(size_t bytes);
+
+  Segment* AllocateSegmentFromPool(int size_class);
+  bool ReturnSegmentToPool(Segment* segment);
+
+  void UpdateMaxMemoryUsage(size_t current);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
+  std::atomic<size_t> pooled_memory_usage_{0};
+  std::atomic<size_t> segment_pool_hits_{0};
+  std::atomic<size_t> segment_pool_misses_{0};
+
+  // Singly linked lists of unused segments per size class. Zones of all
+  // threads share the pool, but the lock is only taken once per segment.
+  base::Mutex segment_pool_mutex_;
+  Segment* segment_pool_[kNumberOfSizeClasses] = {};
+  const size_t max_pooled_memory_;
 
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
@@ -0,0 +1,64 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/benchmarks/cpp/benchmark_utils.h"
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-initialization.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+
+namespace v8 {
+namespace benchmarking {
+
+// static
+std::unique_ptr<v8::Platform> BenchmarkWithIsolate::platform_;
+
+// static
+void BenchmarkWithIsolate::InitializeProcess(const char* executable_path) {
+  v8::V8::InitializeICUDefaultLocation(executable_path);
+  v8::V8::InitializeExternalStartupData(executable_path);
+  platform_ = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform_.get());
+  v8::V8::Initialize();
+}
+
+// static
+void BenchmarkWithIsolate::ShutdownProcess() {
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  platform_.reset();
+}
+
+void BenchmarkWithIsolate::SetUp(::benchmark::State& state) {
+  allocator_.reset(v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator_.get();
+  isolate_ = v8::Isolate::New(create_params);
+  v8::Isolate::Scope isolate_scope(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+  context_.Reset(isolate_, v8::Context::New(isolate_));
+}
+
+void BenchmarkWithIsolate::TearDown(::benchmark::State& state) {
+  context_.Reset();
+  isolate_->Dispose();
+  isolate_ = nullptr;
+  allocator_.reset();
+}
+
+// static
+v8::Local<v8::Value> BenchmarkWithIsolate::Run(v8::Local<v8::Context> context,
+                                               const char* source) {
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::Local<v8::String> source_string =
+      v8::String::NewFromUtf8(isolate, source).ToLocalChecked();
+  return v8::Script::Compile(context, source_string)
+      .ToLocalChecked()
+      ->Run(context)
+      .ToLocalChecked();
+}
+
+}  // namespace benchmarking
+}  // namespace v8
@@ -0,0 +1,50 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
+#define TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
+
+#include <memory>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-platform.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace benchmarking {
+
+// Runs each benchmark in a fresh isolate with a single context.
+class BenchmarkWithIsolate : public benchmark::Fixture {
+ public:
+  static void InitializeProcess(const char* executable_path);
+  static void ShutdownProcess();
+
+ protected:
+  void SetUp(::benchmark::State& state) override;
+  void TearDown(::benchmark::State& state) override;
+
+  v8::Isolate* isolate() const { return isolate_; }
+  // Requires a HandleScope.
+  v8::Local<v8::Context> context() const { return context_.Get(isolate_); }
+
+  // Compiles and runs |source| in |context|.
+  static v8::Local<v8::Value> Run(v8::Local<v8::Context> context,
+                                  const char* source);
+
+ private:
+  static std::unique_ptr<v8::Platform> platform_;
+
+  v8::Isolate* isolate_ = nullptr;
+  v8::Global<v8::Context> context_;
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+};
+
+}  // namespace benchmarking
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
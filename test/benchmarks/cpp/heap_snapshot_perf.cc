@@ -0,0 +1,111 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the time it takes to take a heap snapshot and to serialize it to
+// JSON, depending on the number of objects on the heap. Serialization writes
+// into a stream that drops the data so that only V8's work is measured.
+
+#include <string>
+
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-profiler.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Every entry of the retained array is an object with a few properties of
+// different kinds, so that the snapshot has several edges per node.
+constexpr char kSetUpSource[] = R"(
+  var retained = [];
+  function populate(count) {
+    for (let i = 0; i < count; i++) {
+      retained.push({index: i, name: 'object' + i, next: null, values: [i]});
+      if (i > 0) retained[i - 1].next = retained[i];
+    }
+  }
+)";
+
+class NullOutputStream final : public v8::OutputStream {
+ public:
+  void EndOfStream() final {}
+  WriteResult WriteAsciiChunk(char* data, int size) final {
+    bytes_written_ += size;
+    return kContinue;
+  }
+
+  size_t bytes_written() const { return bytes_written_; }
+
+ private:
+  size_t bytes_written_ = 0;
+};
+
+class HeapSnapshotFixture : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(benchmark::State& state) override {
+    BenchmarkWithIsolate::SetUp(state);
+    v8::Isolate::Scope isolate_scope(isolate());
+    v8::HandleScope handle_scope(isolate());
+    v8::Local<v8::Context> context = this->context();
+    v8::Context::Scope context_scope(context);
+    Run(context, kSetUpSource);
+    const std::string populate =
+        "populate(" + std::to_string(state.range(0)) + ");";
+    Run(context, populate.c_str());
+  }
+
+  void TearDown(benchmark::State& state) override {
+    isolate()->GetHeapProfiler()->DeleteAllHeapSnapshots();
+    BenchmarkWithIsolate::TearDown(state);
+  }
+};
+
+BENCHMARK_DEFINE_F(HeapSnapshotFixture, TakeSnapshot)
+(benchmark::State& state) {
+  v8::Isolate::Scope isolate_scope(isolate());
+  v8::HandleScope handle_scope(isolate());
+  v8::Context::Scope context_scope(context());
+  v8::HeapProfiler* heap_profiler = isolate()->GetHeapProfiler();
+  for (auto _ : state) {
+    USE(_);
+    const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+    state.PauseTiming();
+    state.counters["nodes"] = snapshot->GetNodesCount();
+    const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+    state.ResumeTiming();
+  }
+}
+
+BENCHMARK_DEFINE_F(HeapSnapshotFixture, SerializeSnapshot)
+(benchmark::State& state) {
+  v8::Isolate::Scope isolate_scope(isolate());
+  v8::HandleScope handle_scope(isolate());
+  v8::Context::Scope context_scope(context());
+  const v8::HeapSnapshot* snapshot =
+      isolate()->GetHeapProfiler()->TakeHeapSnapshot();
+  size_t bytes_written = 0;
+  for (auto _ : state) {
+    USE(_);
+    NullOutputStream stream;
+    snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
+    bytes_written = stream.bytes_written();
+  }
+  state.SetBytesProcessed(state.iterations() * bytes_written);
+  state.counters["nodes"] = snapshot->GetNodesCount();
+}
+
+// Argument: number of retained JS objects.
+BENCHMARK_REGISTER_F(HeapSnapshotFixture, TakeSnapshot)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(1 << 12, 1 << 20);
+BENCHMARK_REGISTER_F(HeapSnapshotFixture, SerializeSnapshot)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(1 << 12, 1 << 20);
+
+}  // namespace
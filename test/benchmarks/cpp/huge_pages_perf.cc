@@ -0,0 +1,102 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Chases pointers through a randomly linked list of objects living in old
+// space. The list is much larger than the reach of the data TLB when it is
+// backed by 4KB pages, so the benchmark is dominated by dTLB misses unless
+// --huge-pages-for-old-and-code-space is in effect. The miss counts can be
+// observed with --benchmark_perf_counters=DTLB-LOAD-MISSES when the benchmark
+// library is built with libpfm.
+
+#include <string>
+
+#include "include/v8-context.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Builds a ring of |size| objects that are linked in a pseudo-random order,
+// so that consecutive steps of the chase touch unrelated pages.
+constexpr char kSetUpSource[] = R"(
+  function build(size) {
+    const nodes = new Array(size);
+    for (let i = 0; i < size; i++) nodes[i] = {next: null, value: i};
+    let seed = 42;
+    for (let i = size - 1; i > 0; i--) {
+      seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+      const j = seed % (i + 1);
+      const tmp = nodes[i];
+      nodes[i] = nodes[j];
+      nodes[j] = tmp;
+    }
+    for (let i = 0; i < size; i++) nodes[i].next = nodes[(i + 1) % size];
+    return nodes[0];
+  }
+  function chase(node, steps) {
+    for (let i = 0; i < steps; i++) node = node.next;
+    return node;
+  }
+  var head;
+)";
+
+constexpr int kStepsPerIteration = 1 << 20;
+
+class HugePagesFixture : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(benchmark::State& state) override {
+    // The flag is read when pages are allocated, so toggling it between
+    // isolates is enough for old space.
+    if (state.range(0)) {
+      v8::V8::SetFlagsFromString("--huge-pages-for-old-and-code-space");
+    } else {
+      v8::V8::SetFlagsFromString("--no-huge-pages-for-old-and-code-space");
+    }
+    BenchmarkWithIsolate::SetUp(state);
+    v8::Isolate::Scope isolate_scope(isolate());
+    v8::HandleScope handle_scope(isolate());
+    v8::Local<v8::Context> context = this->context();
+    v8::Context::Scope context_scope(context);
+    Run(context, kSetUpSource);
+    const int size = static_cast<int>(state.range(1));
+    Run(context, ("head = build(" + std::to_string(size) + ");").c_str());
+    // Full GCs promote the list into old space.
+    isolate()->LowMemoryNotification();
+  }
+};
+
+BENCHMARK_DEFINE_F(HugePagesFixture, OldSpacePointerChase)
+(benchmark::State& state) {
+  v8::Isolate::Scope isolate_scope(isolate());
+  v8::HandleScope handle_scope(isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Context::Scope context_scope(context);
+  const std::string source =
+      "head = chase(head, " + std::to_string(kStepsPerIteration) + ");";
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(
+          context, v8::String::NewFromUtf8(isolate(), source.c_str())
+                       .ToLocalChecked())
+          .ToLocalChecked();
+  for (auto _ : state) {
+    USE(_);
+    benchmark::DoNotOptimize(script->Run(context).ToLocalChecked());
+  }
+  state.SetItemsProcessed(state.iterations() * kStepsPerIteration);
+}
+
+// Arguments: huge pages disabled/enabled, number of list nodes.
+BENCHMARK_REGISTER_F(HugePagesFixture, OldSpacePointerChase)
+    ->Args({0, 1 << 18})
+    ->Args({1, 1 << 18})
+    ->Args({0, 1 << 22})
+    ->Args({1, 1 << 22});
+
+}  // namespace
@@ -6,6 +6,7 @@
 #include "src/compiler/backend/instruction-selector-impl.h"
 #include "src/compiler/backend/instruction.h"
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -39,6 +40,13 @@ class InstructionSchedulerTester {
     CHECK(scheduler_.HasSideEffect(instr));
   }
   void CheckIsDeopt(Instruction* instr) { CHECK(instr->IsDeoptimizeCall()); }
+  void CheckNotInGraph(Instruction* instr) { CHECK_NULL(GetNode(instr)); }
+  void CheckEmittedAt(Instruction* instr, int index) {
+    CHECK_EQ(instr, sequence_.InstructionAt(index));
+  }
+  int GetLatency(Instruction* instr) {
+    return InstructionScheduler::GetInstructionLatency(instr);
+  }
 
   void CheckInSuccessors(Instruction* instr, Instruction* successor) {
     InstructionScheduler::ScheduleGraphNode* node = GetNode(instr);
@@ -107,6 +115,78 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+TEST(LoopSchedulingSkipsBlocksOutsideLoops) {
+  FLAG_SCOPE(turbo_loop_instruction_scheduling);
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  // The only block is not in a loop, so its instructions are emitted in
+  // their original order without building a scheduling graph.
+  tester.StartBlock();
+  Instruction* side_effect_inst = Instruction::New(zone, kArchPrepareTailCall);
+  tester.AddInstruction(side_effect_inst);
+  Instruction* nop_inst = Instruction::New(zone, kArchNop);
+  tester.AddInstruction(nop_inst);
+  Instruction* ret_inst = Instruction::New(zone, kArchRet);
+  tester.AddTerminator(ret_inst);
+  tester.CheckNotInGraph(side_effect_inst);
+  tester.CheckNotInGraph(nop_inst);
+  tester.CheckNotInGraph(ret_inst);
+  tester.EndBlock();
+
+  tester.CheckEmittedAt(side_effect_inst, 0);
+  tester.CheckEmittedAt(nop_inst, 1);
+  tester.CheckEmittedAt(ret_inst, 2);
+}
+
+#if V8_TARGET_ARCH_X64
+TEST(X64LatencyModel) {
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+  auto latency = [&](InstructionCode opcode) {
+    return tester.GetLatency(Instruction::New(zone, opcode));
+  };
+
+  // AVX instructions cost the same as their SSE counterparts.
+  CHECK_EQ(latency(kSSEFloat32Mul), latency(kAVXFloat32Mul));
+  CHECK_EQ(latency(kSSEFloat64Mul), latency(kAVXFloat64Mul));
+  CHECK_EQ(latency(kSSEFloat32Div), latency(kAVXFloat32Div));
+  CHECK_EQ(latency(kSSEFloat64Div), latency(kAVXFloat64Div));
+
+  // Whichever model is picked for the current CPU, division is slower than
+  // multiplication, and wider division isn't faster.
+  CHECK_LT(latency(kX64Imul32), latency(kX64Idiv32));
+  CHECK_LE(latency(kX64Idiv32), latency(kX64Idiv));
+  CHECK_LE(latency(kX64Udiv32), latency(kX64Udiv));
+  CHECK_LT(latency(kSSEFloat64Mul), latency(kSSEFloat64Div));
+}
+
+TEST(X64LatencyOfMemoryLoads) {
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+  InstructionOperand output =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+  InstructionOperand input =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1);
+  auto latency = [&](ArchOpcode opcode, AddressingMode mode,
+                     size_t output_count) {
+    InstructionCode code = opcode | AddressingModeField::encode(mode);
+    return tester.GetLatency(
+        Instruction::New(zone, code, output_count, &output, 1, &input, 0,
+                         nullptr));
+  };
+
+  int reg_latency = latency(kX64Movl, kMode_None, 1);
+  // Reading a memory operand adds the load-to-use latency.
+  CHECK_LT(reg_latency, latency(kX64Movl, kMode_MR, 1));
+  CHECK_LT(latency(kX64Add32, kMode_None, 1), latency(kX64Add32, kMode_MR, 1));
+  // Stores and address computations don't read memory.
+  CHECK_EQ(reg_latency, latency(kX64Movl, kMode_MR, 0));
+  CHECK_EQ(latency(kX64Lea, kMode_None, 1), latency(kX64Lea, kMode_MR, 1));
+  CHECK_EQ(latency(kX64Lea32, kMode_None, 1), latency(kX64Lea32, kMode_MR, 1));
+}
+#endif  // V8_TARGET_ARCH_X64
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
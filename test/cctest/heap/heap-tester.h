@@ -63,6 +63,8 @@
   V(WriteBarrier_MarkingExtension)                          \
   V(WriteBarriersInCopyJSObject)                            \
   V(DoNotEvacuatePinnedPages)                               \
+  V(ConcurrentSweepingAllocationStalls)                     \
+  V(SweepingQueueEnsurePageIsSwept)                         \
   V(ObjectStartBitmap)
 
 #define HEAP_TEST(Name)                                                   \
@@ -4,6 +4,7 @@
 
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/memory-chunk.h"
@@ -491,6 +492,66 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithRememberedSetEntries) {
   heap->RemoveNearHeapLimitCallback(reset_oom, 0u);
 }
 
+TEST(CompactionPauseBudgetDefersCandidates) {
+  if (!FLAG_compact) return;
+  // Test that evacuation candidates that do not fit into the pause budget
+  // are left in place, and evacuated by the next GC that selects them.
+  ManualGCScope manual_gc_scope;
+  FLAG_manual_evacuation_candidates_selection = true;
+  FLAG_compaction_pause_budget_ms = 1;
+
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  {
+    HandleScope scope1(isolate);
+
+    heap::SealCurrentObjects(heap);
+
+    {
+      HandleScope scope2(isolate);
+      CHECK(heap->old_space()->Expand());
+      auto compaction_page_handles = heap::CreatePadding(
+          heap,
+          static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+          AllocationType::kOld);
+      Page* deferred_page =
+          Page::FromHeapObject(*compaction_page_handles.front());
+      deferred_page->SetFlag(
+          MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+      CheckAllObjectsOnPage(compaction_page_handles, deferred_page);
+
+      // Pretend that evacuating a single byte takes a millisecond. The
+      // samples replace all the ones traced for earlier GCs.
+      for (int i = 0; i < base::RingBuffer<double>::kSize; i++) {
+        heap->tracer()->AddCompactionEvent(1000, 1);
+      }
+
+      CcTest::CollectAllGarbage();
+      heap->mark_compact_collector()->EnsureSweepingCompleted();
+
+      CheckAllObjectsOnPage(compaction_page_handles, deferred_page);
+      CheckInvariantsOfAbortedPage(deferred_page);
+      CHECK(deferred_page->IsFlagSet(Page::EVACUATION_DEFERRED));
+
+      // The deferred page goes first next time, even though it exceeds the
+      // budget on its own.
+      deferred_page->SetFlag(
+          MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+      for (int i = 0; i < base::RingBuffer<double>::kSize; i++) {
+        heap->tracer()->AddCompactionEvent(1000, 1);
+      }
+
+      CcTest::CollectAllGarbage();
+      heap->mark_compact_collector()->EnsureSweepingCompleted();
+
+      for (Handle<FixedArray> object : compaction_page_handles) {
+        CHECK_NE(deferred_page, Page::FromHeapObject(*object));
+      }
+    }
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -51,6 +51,7 @@
 #include "src/heap/memory-chunk.h"
 #include "src/heap/memory-reducer.h"
 #include "src/heap/parked-scope.h"
+#include "src/heap/pretenuring-sampler.h"
 #include "src/heap/remembered-set-inl.h"
 #include "src/heap/safepoint.h"
 #include "src/ic/ic.h"
@@ -6873,6 +6874,30 @@ HEAP_TEST(MemoryReducerActivationForSmallHeaps) {
   CHECK_EQ(heap->memory_reducer()->state_.action, MemoryReducer::Action::kWait);
 }
 
+HEAP_TEST(MemoryReducerBudget) {
+  if (!FLAG_incremental_marking) return;
+  ManualGCScope manual_gc_scope;
+  LocalContext env;
+  Heap* heap = CcTest::heap();
+  MemoryReducer* memory_reducer = heap->memory_reducer();
+  CHECK(heap->incremental_marking()->IsStopped());
+  // Every heap exceeds a budget of one byte, so marking starts right away.
+  memory_reducer->SetMemoryBudget(1);
+  CHECK(!heap->incremental_marking()->IsStopped());
+  CcTest::CollectAllGarbage();
+  CHECK(heap->incremental_marking()->IsStopped());
+  // The heap did not grow since the last full GC, so another GC would not
+  // help, not even in idle time.
+  double time_ms = heap->MonotonicallyIncreasingTimeInMs();
+  while (heap->MonotonicallyIncreasingTimeInMs() == time_ms) {
+  }
+  memory_reducer->NotifyIdleWindow(heap->MonotonicallyIncreasingTimeInMs() +
+                                   1000);
+  CHECK(heap->incremental_marking()->IsStopped());
+  CHECK_LT(0, memory_reducer->time_over_budget_ms());
+  memory_reducer->SetMemoryBudget(0);
+}
+
 TEST(AllocateExternalBackingStore) {
   ManualGCScope manual_gc_scope;
   LocalContext env;
@@ -7326,6 +7351,217 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+TEST(MinorMCIncrementalMarkingWriteBarrier) {
+  if (FLAG_single_generation) return;
+  FLAG_minor_mc = true;
+  FLAG_minor_mc_incremental_marking = true;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  MinorMarkCompactCollector* collector = heap->minor_mark_compact_collector();
+  HandleScope scope(isolate);
+
+  Handle<FixedArray> host = isolate->factory()->NewFixedArray(1);
+  CHECK(Heap::InYoungGeneration(*host));
+
+  collector->StartMarking();
+  CHECK(collector->IsMarking());
+  CHECK(heap->IsMarkingYoungGeneration());
+  CHECK(MemoryChunk::FromHeapObject(*host)->IsFlagSet(
+      MemoryChunk::INCREMENTAL_MARKING));
+
+  // The young value is allocated white and marked by the write barrier.
+  Handle<HeapNumber> value = isolate->factory()->NewHeapNumber(1.5);
+  CHECK(collector->marking_state()->IsWhite(*value));
+  host->set(0, *value);
+  CHECK(collector->marking_state()->IsGrey(*value));
+
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK(!collector->IsMarking());
+  CHECK(!heap->IsMarkingYoungGeneration());
+  CHECK_EQ(*value, host->get(0));
+  CHECK_EQ(1.5, value->value());
+}
+
+TEST(MinorMCIncrementalMarkingAbortedByFullGC) {
+  if (FLAG_single_generation) return;
+  FLAG_minor_mc = true;
+  FLAG_minor_mc_incremental_marking = true;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  MinorMarkCompactCollector* collector = heap->minor_mark_compact_collector();
+  HandleScope scope(isolate);
+
+  Handle<FixedArray> host = isolate->factory()->NewFixedArray(1);
+  collector->StartMarking();
+  host->set(0, *isolate->factory()->NewHeapNumber(1.5));
+  CHECK(collector->IsMarking());
+
+  CcTest::CollectAllGarbage();
+  CHECK(!collector->IsMarking());
+  CHECK(!heap->IsMarkingYoungGeneration());
+  CHECK_EQ(1.5, HeapNumber::cast(host->get(0)).value());
+}
+
+namespace {
+
+// Fills old space with arrays of which only every fourth one stays alive, so
+// that the following full GC leaves many pages for the sweeper.
+Handle<FixedArray> FillOldSpaceWithSparselyLiveArrays(Isolate* isolate,
+                                                      int pages) {
+  const int kArrayLength = 1024;
+  const int arrays_per_page = static_cast<int>(
+      MemoryChunkLayout::AllocatableMemoryInDataPage() /
+      FixedArray::SizeFor(kArrayLength));
+  const int arrays = pages * arrays_per_page;
+  Handle<FixedArray> holder =
+      isolate->factory()->NewFixedArray(arrays / 4 + 1, AllocationType::kOld);
+  for (int i = 0; i < arrays; i++) {
+    HandleScope scope(isolate);
+    Handle<FixedArray> array =
+        isolate->factory()->NewFixedArray(kArrayLength, AllocationType::kOld);
+    if (i % 4 == 0) holder->set(i / 4, *array);
+  }
+  return holder;
+}
+
+}  // namespace
+
+HEAP_TEST(SweepingQueueEnsurePageIsSwept) {
+  if (!FLAG_concurrent_sweeping) return;
+  ManualGCScope manual_gc_scope;
+  FLAG_concurrent_sweeping = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  HandleScope scope(isolate);
+
+  Handle<FixedArray> holder = FillOldSpaceWithSparselyLiveArrays(isolate, 8);
+  // Keep the pages in the sweeping queue until they are claimed below.
+  heap->delay_sweeper_tasks_for_testing_ = true;
+  CcTest::CollectAllGarbage();
+  CHECK(collector->sweeping_in_progress());
+
+  // Claim every other page on the main thread. The remaining pages are
+  // handed out by the queue, which has to skip the claimed ones.
+  int index = 0;
+  for (Page* page : *heap->old_space()) {
+    if (index++ % 2 == 0) {
+      collector->EnsurePageIsSwept(page);
+      CHECK(page->SweepingDone());
+    }
+  }
+  heap->delay_sweeper_tasks_for_testing_ = false;
+  collector->sweeper()->StartSweeperTasks();
+  collector->EnsureSweepingCompleted();
+  for (Page* page : *heap->old_space()) {
+    CHECK(page->SweepingDone());
+  }
+  CHECK(holder->get(0).IsFixedArray());
+}
+
+HEAP_TEST(ConcurrentSweepingAllocationStalls) {
+  if (!FLAG_concurrent_sweeping) return;
+  ManualGCScope manual_gc_scope;
+  FLAG_concurrent_sweeping = true;
+  // Keep the sparse pages around instead of compacting them away.
+  FLAG_manual_evacuation_candidates_selection = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  Sweeper* sweeper = collector->sweeper();
+  HandleScope scope(isolate);
+
+  const int kPages = 32;
+  Handle<FixedArray> holder =
+      FillOldSpaceWithSparselyLiveArrays(isolate, kPages);
+  heap->delay_sweeper_tasks_for_testing_ = true;
+  CcTest::CollectAllGarbage();
+  CHECK(collector->sweeping_in_progress());
+  const int pages_before = heap->old_space()->CountTotalPages();
+
+  // Let the sweeper tasks drain the sweeping queues.
+  heap->delay_sweeper_tasks_for_testing_ = false;
+  sweeper->StartSweeperTasks();
+  while (sweeper->AreSweeperTasksRunning()) {
+    base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+  }
+  CHECK(collector->sweeping_in_progress());
+
+  // The first allocation that misses the free list takes all pages swept by
+  // the tasks in bulk. Every further allocation is served from that memory
+  // without sweeping on the main thread or growing the space.
+  const int kArrayLength = 128;
+  const int kAllocations = kPages * 64;
+  base::TimeDelta longest_stall;
+  base::TimeDelta total;
+  for (int i = 0; i < kAllocations; i++) {
+    HandleScope inner_scope(isolate);
+    const base::TimeTicks start = base::TimeTicks::Now();
+    Handle<FixedArray> array =
+        isolate->factory()->NewFixedArray(kArrayLength, AllocationType::kOld);
+    const base::TimeDelta stall = base::TimeTicks::Now() - start;
+    CHECK_EQ(kArrayLength, array->length());
+    CHECK(!sweeper->HasSweptPagesSafe(heap->old_space()));
+    longest_stall = std::max(longest_stall, stall);
+    total += stall;
+  }
+  CHECK_EQ(pages_before, heap->old_space()->CountTotalPages());
+  if (FLAG_trace_gc) {
+    PrintF("Old space allocations during sweeping: %d, total %.3f ms, "
+           "longest stall %.3f ms\n",
+           kAllocations, total.InMillisecondsF(),
+           longest_stall.InMillisecondsF());
+  }
+
+  collector->EnsureSweepingCompleted();
+  CHECK(!collector->sweeping_in_progress());
+  CHECK(holder->get(0).IsFixedArray());
+#ifdef VERIFY_HEAP
+  heap->Verify();
+#endif
+}
+
+TEST(LifetimeSamplingPretenuringJsonStrings) {
+  if (FLAG_single_generation) return;
+  FLAG_lifetime_sampling_pretenuring = true;
+  // Sample every young generation allocation.
+  FLAG_lifetime_sampling_pretenuring_rate = kTaggedSize;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  v8::HandleScope scope(CcTest::isolate());
+  PretenuringSampler* sampler = heap->pretenuring_sampler();
+  CHECK_NOT_NULL(sampler);
+  CHECK_EQ(AllocationType::kYoung,
+           sampler->AllocationTypeFor(RuntimeAllocationSite::kJsonString));
+
+  // All parsed strings stay alive until they are promoted.
+  CompileRun(
+      "var retained = [];"
+      "var s = 'x'.repeat(100);"
+      "for (var i = 0; i < 256; i++) {"
+      "  retained.push(JSON.parse('[\"' + s + i + '\"]'));"
+      "}");
+  CcTest::CollectGarbage(NEW_SPACE);
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK_EQ(AllocationType::kOld,
+           sampler->AllocationTypeFor(RuntimeAllocationSite::kJsonString));
+
+  Handle<Object> result = v8::Utils::OpenHandle(*CompileRun(
+      "JSON.parse('\"' + s + '\"')"));
+  CHECK(result->IsString());
+  CHECK(!Heap::InYoungGeneration(*result));
+  StatsCounter* counter =
+      CcTest::i_isolate()->counters()->pretenured_runtime_bytes();
+  if (counter->Enabled()) CHECK_LT(0, counter->GetInternalPointer()->load());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
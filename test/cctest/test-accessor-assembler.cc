@@ -11,6 +11,7 @@
 #include "src/objects/smi.h"
 #include "test/cctest/compiler/code-assembler-tester.h"
 #include "test/cctest/compiler/function-tester.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -26,18 +27,19 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, map);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name, map);
     }
     m.Return(m.SmiTag(result));
   }
@@ -79,11 +81,11 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
-          expected_result = StubCache::SecondaryOffsetForTesting(*name, *map);
+          expected_result = stub_cache->SecondaryOffsetForTesting(*name, *map);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -257,5 +259,86 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(TryProbeGrowingStubCache) {
+  using Label = CodeStubAssembler::Label;
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  FLAG_SCOPE(adaptive_stub_cache);
+  FLAG_VALUE_SCOPE(stub_cache_primary_table_bits, 4);
+  FLAG_VALUE_SCOPE(stub_cache_secondary_table_bits, 2);
+  FLAG_VALUE_SCOPE(stub_cache_max_primary_table_bits, 6);
+  const int kNumParams = 3;
+  CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
+  AccessorAssembler m(data.state());
+
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+  CHECK_EQ(1 << 4, stub_cache.table_size(StubCache::kPrimary));
+  CHECK_EQ(1 << 2, stub_cache.table_size(StubCache::kSecondary));
+
+  {
+    auto receiver = m.Parameter<Object>(1);
+    auto name = m.Parameter<Name>(2);
+    TNode<MaybeObject> expected_handler = m.UncheckedParameter<MaybeObject>(3);
+
+    Label passed(&m), failed(&m);
+
+    CodeStubAssembler::TVariable<MaybeObject> var_handler(&m);
+    Label if_handler(&m), if_miss(&m);
+
+    m.TryProbeStubCache(&stub_cache, receiver, name, &if_handler, &var_handler,
+                        &if_miss);
+    m.BIND(&if_handler);
+    m.Branch(m.TaggedEqual(expected_handler, var_handler.value()), &passed,
+             &failed);
+
+    m.BIND(&if_miss);
+    m.Branch(m.TaggedEqual(expected_handler, m.SmiConstant(0)), &passed,
+             &failed);
+
+    m.BIND(&passed);
+    m.Return(m.BooleanConstant(true));
+
+    m.BIND(&failed);
+    m.Return(m.BooleanConstant(false));
+  }
+
+  Handle<Code> code = data.GenerateCode();
+  FunctionTester ft(code, kNumParams);
+
+  Factory* factory = isolate->factory();
+  std::vector<Handle<Name>> names;
+  for (int i = 0; i < 32; i++) names.push_back(factory->NewSymbol());
+  std::vector<Handle<JSObject>> receivers;
+  for (int i = 0; i < 16; i++) {
+    receivers.push_back(factory->NewJSObjectFromMap(Map::Create(isolate, 0)));
+  }
+  Handle<Code> handler = CreateCodeOfKind(CodeKind::FOR_TESTING);
+
+  DisallowGarbageCollection no_gc;
+
+  // Fill the stub cache with far more entries than it can hold, so that it
+  // keeps evicting entries until it has reached its maximum size.
+  for (Handle<Name> name : names) {
+    for (Handle<JSObject> receiver : receivers) {
+      stub_cache.Set(*name, receiver->map(),
+                     MaybeObject::FromObject(ToCodeT(*handler)));
+    }
+  }
+  CHECK_EQ(1 << 6, stub_cache.table_size(StubCache::kPrimary));
+  CHECK_EQ(1 << 4, stub_cache.table_size(StubCache::kSecondary));
+
+  // The generated code has to find the entries in the grown tables.
+  bool queried_existing = false;
+  for (Handle<Name> name : names) {
+    for (Handle<JSObject> receiver : receivers) {
+      MaybeObject cached = stub_cache.Get(*name, receiver->map());
+      if (cached.ptr() != kNullAddress) queried_existing = true;
+      Handle<Object> expected_handler(cached->GetHeapObjectOrSmi(), isolate);
+      ft.CheckTrue(receiver, name, expected_handler);
+    }
+  }
+  CHECK(queried_existing);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -30,6 +30,8 @@
 #include <ctype.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "include/v8-function.h"
 #include "include/v8-profiler.h"
@@ -1230,6 +1232,130 @@ TEST(HeapSnapshotJSONSerializationAborting) {
   CHECK_EQ(0, stream.eos_signaled());
 }
 
+TEST(HeapSnapshotJSONSerializationInParallel) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  // Enough nodes and edges for several serialization batches.
+  CompileRun(
+      "var a = [];\n"
+      "for (var i = 0; i < 100000; i++) a.push({x: i});\n");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+  CHECK_GT(snapshot->GetNodesCount(), 64 * 1024);
+
+  bool saved_flag = i::FLAG_heap_snapshot_parallel_serialization;
+  i::FLAG_heap_snapshot_parallel_serialization = false;
+  TestJSONStream sequential_stream;
+  snapshot->Serialize(&sequential_stream, v8::HeapSnapshot::kJSON);
+  i::FLAG_heap_snapshot_parallel_serialization = true;
+  TestJSONStream parallel_stream;
+  snapshot->Serialize(&parallel_stream, v8::HeapSnapshot::kJSON);
+  TestJSONStream aborted_stream(5);
+  snapshot->Serialize(&aborted_stream, v8::HeapSnapshot::kJSON);
+  i::FLAG_heap_snapshot_parallel_serialization = saved_flag;
+
+  CHECK_EQ(1, sequential_stream.eos_signaled());
+  CHECK_EQ(1, parallel_stream.eos_signaled());
+  CHECK_EQ(0, aborted_stream.eos_signaled());
+  CHECK_EQ(sequential_stream.size(), parallel_stream.size());
+  v8::base::ScopedVector<char> sequential(sequential_stream.size());
+  sequential_stream.WriteTo(sequential);
+  v8::base::ScopedVector<char> parallel(parallel_stream.size());
+  parallel_stream.WriteTo(parallel);
+  CHECK_EQ(0,
+           memcmp(sequential.begin(), parallel.begin(), sequential.length()));
+}
+
+namespace {
+
+uint64_t ReadVarint(const v8::base::Vector<char>& data, int* pos) {
+  uint64_t result = 0;
+  int shift = 0;
+  uint8_t byte;
+  do {
+    CHECK_LT(*pos, data.length());
+    byte = static_cast<uint8_t>(data[(*pos)++]);
+    result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  return result;
+}
+
+}  // namespace
+
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; this.self = this; }\n"
+      "var a = [];\n"
+      "for (var i = 0; i < 100; i++) a.push(new A('s' + i));\n");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  TestJSONStream binary_stream;
+  snapshot->Serialize(&binary_stream, v8::HeapSnapshot::kBinary);
+  CHECK_EQ(1, binary_stream.eos_signaled());
+  TestJSONStream json_stream;
+  snapshot->Serialize(&json_stream, v8::HeapSnapshot::kJSON);
+  CHECK_LT(binary_stream.size(), json_stream.size() / 2);
+  TestJSONStream aborted_stream(1);
+  snapshot->Serialize(&aborted_stream, v8::HeapSnapshot::kBinary);
+  CHECK_EQ(0, aborted_stream.eos_signaled());
+
+  v8::base::ScopedVector<char> data(binary_stream.size());
+  binary_stream.WriteTo(data);
+  CHECK_EQ(0, memcmp(data.begin(), "V8HS", 4));
+  int pos = 4;
+  CHECK_EQ(1u, ReadVarint(data, &pos));
+
+  const int node_count = snapshot->GetNodesCount();
+  CHECK_EQ(static_cast<uint64_t>(node_count), ReadVarint(data, &pos));
+  std::vector<uint64_t> name_ids;
+  uint64_t total_edge_count = 0;
+  int64_t id = 0;
+  for (int i = 0; i < node_count; i++) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    CHECK_EQ(static_cast<uint64_t>(node->GetType()), ReadVarint(data, &pos));
+    name_ids.push_back(ReadVarint(data, &pos));
+    uint64_t delta = ReadVarint(data, &pos);
+    id += static_cast<int64_t>(delta >> 1) ^ -static_cast<int64_t>(delta & 1);
+    CHECK_EQ(static_cast<int64_t>(node->GetId()), id);
+    CHECK_EQ(node->GetShallowSize(), ReadVarint(data, &pos));
+    uint64_t edge_count = ReadVarint(data, &pos);
+    CHECK_EQ(static_cast<uint64_t>(node->GetChildrenCount()), edge_count);
+    total_edge_count += edge_count;
+    ReadVarint(data, &pos);  // trace_node_id
+    ReadVarint(data, &pos);  // detachedness
+  }
+  CHECK_EQ(total_edge_count, ReadVarint(data, &pos));
+  for (uint64_t i = 0; i < total_edge_count; i++) {
+    ReadVarint(data, &pos);  // type
+    ReadVarint(data, &pos);  // name_or_index
+    CHECK_LT(ReadVarint(data, &pos), static_cast<uint64_t>(node_count));
+  }
+  uint64_t location_count = ReadVarint(data, &pos);
+  for (uint64_t i = 0; i < location_count * 4; i++) ReadVarint(data, &pos);
+
+  std::vector<std::string> strings;
+  uint64_t string_count = ReadVarint(data, &pos);
+  for (uint64_t i = 0; i < string_count; i++) {
+    uint64_t length = ReadVarint(data, &pos);
+    CHECK_LE(pos + length, static_cast<uint64_t>(data.length()));
+    strings.emplace_back(data.begin() + pos, length);
+    pos += static_cast<int>(length);
+  }
+  CHECK_EQ(data.length(), pos);
+  for (int i = 0; i < node_count; i++) {
+    v8::String::Utf8Value name(env->GetIsolate(),
+                               snapshot->GetNode(i)->GetName());
+    CHECK_LT(name_ids[i], strings.size());
+    CHECK_EQ(0, strcmp(*name, strings[name_ids[i]].c_str()));
+  }
+}
+
 namespace {
 
 class TestStatsStream : public v8::OutputStream {
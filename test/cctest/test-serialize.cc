@@ -1780,6 +1780,108 @@ TEST(CodeSerializerOnePlusOneWithInterpretedFramesNativeStack) {
 }
 #endif
 
+#if ENABLE_SPARKPLUG
+TEST(CodeSerializerBaselineCode) {
+  FLAG_sparkplug = true;
+  FLAG_cache_baseline_code = true;
+  FLAG_stress_background_compile = false;
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()
+      ->DisableScriptAndEval();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* source = "1 + 1";
+  Handle<String> orig_source =
+      isolate->factory()->NewStringFromAsciiChecked(source);
+  Handle<String> copy_source =
+      isolate->factory()->NewStringFromAsciiChecked(source);
+
+  ScriptDetails default_script_details;
+  Handle<SharedFunctionInfo> orig =
+      Compiler::GetSharedFunctionInfoForScript(
+          isolate, orig_source, default_script_details,
+          v8::ScriptCompiler::kNoCompileOptions,
+          ScriptCompiler::kNoCacheNoReason, NOT_NATIVES_CODE)
+          .ToHandleChecked();
+  IsCompiledScope is_compiled_scope(*orig, isolate);
+  CHECK(Compiler::CompileSharedWithBaseline(
+      isolate, orig, Compiler::CLEAR_EXCEPTION, &is_compiled_scope));
+  CHECK(orig->HasBaselineCode());
+
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(orig));
+  AlignedCachedData cache(cached_data->data, cached_data->length);
+
+  StatsCounter* deserialized_size =
+      isolate->counters()->total_baseline_code_size_deserialized();
+  int deserialized_size_before =
+      deserialized_size->GetInternalPointer()->load();
+  Handle<SharedFunctionInfo> copy;
+  {
+    DisallowCompilation no_compile_expected(isolate);
+    copy = CompileScript(isolate, copy_source, default_script_details, &cache,
+                         v8::ScriptCompiler::kConsumeCodeCache);
+  }
+  CHECK(!cache.rejected());
+
+  // Calls through short builtin calls can't be cached.
+  if (!isolate->is_short_builtin_calls_enabled()) {
+    CHECK(copy->HasBaselineCode());
+    if (deserialized_size->Enabled()) {
+      CHECK_LT(deserialized_size_before,
+               deserialized_size->GetInternalPointer()->load());
+    }
+  }
+
+  Handle<JSFunction> copy_fun =
+      Factory::JSFunctionBuilder{isolate, copy, isolate->native_context()}
+          .Build();
+  Handle<JSObject> global(isolate->context().global_object(), isolate);
+  Handle<Object> copy_result =
+      Execution::CallScript(isolate, copy_fun, global,
+                            isolate->factory()->empty_fixed_array())
+          .ToHandleChecked();
+  CHECK_EQ(2, Handle<Smi>::cast(copy_result)->value());
+
+  // The cache must also be usable by a fresh isolate that never compiled the
+  // script itself.
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context2 = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context2);
+    Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+
+    v8::ScriptCompiler::CachedData* cache2 = new v8::ScriptCompiler::CachedData(
+        cached_data->data, cached_data->length);
+    v8::ScriptCompiler::Source source2(v8_str(source), cache2);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile_expected(i_isolate2);
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source2, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache2->rejected);
+
+    if (!isolate->is_short_builtin_calls_enabled() &&
+        !i_isolate2->is_short_builtin_calls_enabled()) {
+      CHECK(v8::Utils::OpenHandle(*script)->HasBaselineCode());
+    }
+
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context2).ToLocalChecked();
+    CHECK_EQ(2, result->Int32Value(context2).FromJust());
+  }
+  isolate2->Dispose();
+}
+#endif  // ENABLE_SPARKPLUG
+
 TEST(CodeSerializerOnePlusOneWithDebugger) {
   v8::HandleScope scope(CcTest::isolate());
   static v8::debug::DebugDelegate dummy_delegate;
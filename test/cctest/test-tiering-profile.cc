@@ -0,0 +1,146 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "src/api/api-inl.h"
+#include "src/codegen/compiler.h"
+#include "src/execution/isolate.h"
+#include "src/execution/tiering-manager.h"
+#include "src/execution/tiering-profile.h"
+#include "src/objects/js-function-inl.h"
+#include "test/cctest/cctest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(TieringProfileRoundTrip) {
+  if (FLAG_always_opt || !FLAG_opt) return;
+  FLAG_allow_natives_syntax = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRunWithOrigin(
+      "function hot(o) { return o.x + 1; }\n"
+      "function cold() { return 0; }\n"
+      "%PrepareFunctionForOptimization(hot);\n"
+      "hot({x: 1});\n"
+      "%OptimizeFunctionOnNextCall(hot);\n"
+      "hot({x: 2});\n"
+      "%PrepareFunctionForOptimization(cold);\n"
+      "cold();\n",
+      "tiering-profile-test.js");
+  Handle<JSFunction> hot = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("hot")));
+  Handle<JSFunction> cold = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("cold")));
+  CHECK(hot->HasAttachedCodeKind(CodeKind::TURBOFAN));
+
+  const char* filename = "tiering-profile-test.txt";
+  TieringProfileFromFile::Write(isolate, filename);
+
+  // Every function of the script with a feedback vector has its own line.
+  std::ifstream file(filename);
+  int lines = 0;
+  for (std::string line; std::getline(file, line);) {
+    if (line.find("tiering-profile-test.js") != std::string::npos) lines++;
+  }
+  CHECK_LE(2, lines);
+
+  // The first lookup reads the file given by the flag.
+  FLAG_tiering_profile_input = filename;
+  const TieringProfileFromFile* hot_profile =
+      TieringProfileFromFile::TryRead(isolate, handle(hot->shared(), isolate));
+  const TieringProfileFromFile* cold_profile =
+      TieringProfileFromFile::TryRead(isolate, handle(cold->shared(), isolate));
+  FLAG_tiering_profile_input = nullptr;
+  std::remove(filename);
+
+  CHECK_NOT_NULL(hot_profile);
+  CHECK_EQ(CodeKind::TURBOFAN, hot_profile->tier());
+  CHECK(hot_profile->has_stable_feedback());
+  CHECK_NOT_NULL(cold_profile);
+  CHECK_LT(cold_profile->tier(), CodeKind::TURBOFAN);
+}
+
+TEST(TieringProfileAppliedOnFirstTick) {
+  if (FLAG_always_opt || !FLAG_opt || FLAG_always_sparkplug) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_lazy_feedback_allocation = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+
+  // The script name needs quoting in the profile.
+  const char* source =
+      "function hot(o) { return o.x + 1; }\n"
+      "function cold() { return 0; }\n";
+  const char* script_name = "tiering-profile-\"apply\",test.js";
+  CompileRunWithOrigin(source, script_name);
+  CompileRun(
+      "%PrepareFunctionForOptimization(hot);\n"
+      "hot({x: 1});\n"
+      "%OptimizeFunctionOnNextCall(hot);\n"
+      "hot({x: 2});\n"
+      "%PrepareFunctionForOptimization(cold);\n"
+      "cold();\n");
+
+  const char* filename = "tiering-profile-apply-test.txt";
+  TieringProfileFromFile::Write(isolate, filename);
+  std::vector<std::string> lines;
+  {
+    std::ifstream file(filename);
+    for (std::string line; std::getline(file, line);) lines.push_back(line);
+  }
+  {
+    // Malformed lines, and lines for a changed function, are skipped.
+    std::ofstream file(filename, std::ios::app);
+    file << "function,1,2\n";
+    file << "function,0,10,0,NotATier,5,1,\"x.js\"\n";
+    file << "function,0,10,0,TURBOFAN,5,1,unquoted.js\n";
+    for (const std::string& line : lines) {
+      if (line.find("apply") == std::string::npos) continue;
+      // Keep the marker and source range, but change the hash and tier.
+      size_t range_end = line.find(',', line.find(',', line.find(',') + 1) + 1);
+      file << line.substr(0, range_end) << ",1,TURBOFAN,5,1,"
+           << line.substr(line.find(",\"") + 1) << "\n";
+    }
+  }
+
+  // Running the script again creates new closures without feedback vectors,
+  // which look up the profile on their first tick.
+  FLAG_tiering_profile_input = filename;
+  CompileRunWithOrigin(source, script_name);
+  Handle<JSFunction> hot = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("hot")));
+  Handle<JSFunction> cold = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("cold")));
+  for (Handle<JSFunction> function : {hot, cold}) {
+    IsCompiledScope is_compiled_scope;
+    CHECK(Compiler::Compile(isolate, function, Compiler::CLEAR_EXCEPTION,
+                            &is_compiled_scope));
+    CHECK(!function->has_feedback_vector());
+  }
+  isolate->tiering_manager()->OnInterruptTick(hot);
+  isolate->tiering_manager()->OnInterruptTick(cold);
+  FLAG_tiering_profile_input = nullptr;
+  std::remove(filename);
+
+  // The function that reached Turbofan with stable feedback tiers up again on
+  // its next tick.
+  const int ticks_for_optimization =
+      FLAG_ticks_before_optimization +
+      hot->shared().GetBytecodeArray(isolate).length() /
+          FLAG_bytecode_size_allowance_per_tick;
+  CHECK_EQ(ticks_for_optimization - 1,
+           hot->feedback_vector().profiler_ticks());
+  CHECK_EQ(0, cold->feedback_vector().profiler_ticks());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the compile time and the quality of the generated code for a big
+// generated function, which is large enough to be handled by the mid-tier
+// register allocator by default. Run with --turbo-force-mid-tier-regalloc or
+// --no-turbo-use-mid-tier-regalloc-for-huge-functions to compare the two
+// register allocators.
+const STATEMENTS = 2000;
+
+let seed = 0;
+
+function CreateHugeFunction() {
+  // Vary the source, so that the function is not found in the eval cache.
+  let body = `let a = x, b = y, c = (x ^ y) + ${seed++};\n`;
+  for (let i = 0; i < STATEMENTS; i++) {
+    body += `a = (a + b * ${i}) | 0; b = (b ^ c) + ${i % 7};\n`;
+    body += `if (a & ${1 << (i % 16)}) c = (c + a) | 0; else c = c - b;\n`;
+  }
+  body += 'return a + b + c;';
+  return new Function('x', 'y', body);
+}
+
+let hugeFunction = CreateHugeFunction();
+%PrepareFunctionForOptimization(hugeFunction);
+hugeFunction(1, 2);
+hugeFunction(3, 4);
+%OptimizeFunctionOnNextCall(hugeFunction);
+hugeFunction(5, 6);
+
+function CompileHugeFunction() {
+  // A fresh function is needed for every compilation, since the optimized
+  // code would otherwise be reused.
+  const f = CreateHugeFunction();
+  %PrepareFunctionForOptimization(f);
+  f(1, 2);
+  %OptimizeFunctionOnNextCall(f);
+  f(3, 4);
+}
+
+function RunHugeFunction() {
+  let result = 0;
+  for (let i = 0; i < 100; i++) result ^= hugeFunction(i, result);
+  return result;
+}
+
+createSuite('CompileHugeFunction', 10, CompileHugeFunction);
+createSuite('RunHugeFunction', 100, RunHugeFunction);
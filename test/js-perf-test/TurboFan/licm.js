@@ -0,0 +1,22 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Run with --turbo-loop-invariant-code-motion to hoist the invariant nodes
+// out of the loop. The map check on {values} and the load of its length are
+// in the loop header. The map check on {point} and the loads of its fields
+// are in the body, and are hoisted behind a guard that checks the loop
+// condition on entry.
+const values = [];
+for (let i = 0; i < 1000; i++) values.push(i);
+const point = {x: 3, y: 4};
+
+function SumInvariantLoads(values, point) {
+  let sum = 0;
+  for (let i = 0; i < values.length; i++) {
+    sum += point.x * point.y;
+  }
+  return sum;
+}
+
+createSuite('LoopInvariantLoads', 1000, () => SumInvariantLoads(values, point));
@@ -8,6 +8,7 @@ d8.file.execute("../base.js");
 const iterations = 100;
 
 d8.file.execute("typedLowering.js");
+d8.file.execute("licm.js");
 
 var success = true;
 
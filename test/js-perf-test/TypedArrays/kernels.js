@@ -0,0 +1,52 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Element-wise kernels over typed arrays, which TurboFan can vectorize with
+// --turbo-loop-vectorization.
+
+const SIZE = 4099;
+let a;
+let b;
+let c;
+
+function CreateSetup(TAConstructor) {
+  return () => {
+    a = new TAConstructor(SIZE);
+    b = new TAConstructor(SIZE);
+    c = new TAConstructor(SIZE);
+    for (let i = 0; i < SIZE; i++) {
+      a[i] = i;
+      b[i] = SIZE - i;
+    }
+  };
+}
+
+// Creates a kernel function that is unpolluted by IC feedback of the other
+// element types.
+function CreateKernel(statement) {
+  return new Function('a', 'b', 'c', `
+    for (let i = 0; i < c.length; i++) ${statement};
+  `);
+}
+
+function TearDown() {
+  a = void 0;
+  b = void 0;
+  c = void 0;
+}
+
+const kernels = {
+  'Add': 'c[i] = a[i] + b[i]',
+  'Scale': 'c[i] = a[i] * 3',
+  'AddInPlace': 'c[i] = c[i] + b[i]',
+};
+
+for (const TAConstructor of [Int32Array, Float32Array, Float64Array]) {
+  for (const [name, statement] of Object.entries(kernels)) {
+    const kernel = CreateKernel(statement);
+    createSuite(
+        `${name}-${TAConstructor.name}`, 1000, () => kernel(a, b, c),
+        CreateSetup(TAConstructor), TearDown);
+  }
+}
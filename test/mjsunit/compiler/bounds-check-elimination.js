@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-bounds-check-elimination
+
+(function TestTypedArrayLoop() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+
+  const a = new Uint8Array([1, 2, 3, 4]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertEquals(0, sum(new Uint8Array(0)));
+})();
+
+(function TestFastArrayLoopWithStores() {
+  function scale(a, k) {
+    for (let i = 0; i < a.length; i++) a[i] = a[i] * k;
+    return a;
+  }
+
+  %PrepareFunctionForOptimization(scale);
+  assertEquals([2, 4, 6], scale([1, 2, 3], 2));
+  %OptimizeFunctionOnNextCall(scale);
+  assertEquals([2, 4, 6], scale([1, 2, 3], 2));
+  assertEquals([3], scale([1], 3));
+})();
+
+(function TestCheckAgainstOtherLengthIsKept() {
+  function copy(a, b) {
+    for (let i = 0; i < a.length; i++) b[i] = a[i];
+    return b;
+  }
+
+  %PrepareFunctionForOptimization(copy);
+  assertEquals([1, 2], copy([1, 2], [0, 0]));
+  %OptimizeFunctionOnNextCall(copy);
+  assertEquals([1, 2], copy([1, 2], [0, 0]));
+  // {b} is shorter than {a}, so its bounds check must still be there.
+  assertEquals([1, 2, 3], copy([1, 2, 3], [0, 0]));
+})();
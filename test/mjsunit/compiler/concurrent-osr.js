@@ -0,0 +1,37 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --concurrent-osr --concurrent-recompilation
+// Flags: --use-osr --opt --no-always-opt
+
+if (!%IsConcurrentRecompilationSupported()) quit();
+
+function isExecutingTurbofan(f) {
+  let status = %GetOptimizationStatus(f);
+  return (status & V8OptimizationStatus.kTopmostFrameIsTurboFanned) !== 0;
+}
+
+function f() {
+  let sum = 0;
+  for (let i = 0; i < 20; i++) {
+    if (i == 2) {
+      %OptimizeOsr();
+    } else if (i > 2 && i < 10) {
+      // The OSR job was queued at the first back edge after arming, and the
+      // loop keeps running unoptimized code until it is finalized.
+      assertFalse(isExecutingTurbofan(f));
+    } else if (i == 10) {
+      %FinalizeOptimization();
+    } else if (i > 10) {
+      // Entered the OSR code at the next back edge.
+      assertTrue(isExecutingTurbofan(f));
+    }
+    sum += i;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(f);
+%DisableOptimizationFinalization();
+assertEquals(190, f());
@@ -0,0 +1,64 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-invariant-code-motion
+
+(function TestHoistedChecksDeoptOnEntry() {
+  function sum(a, o) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) {
+      s += o.x;
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(6, sum([1, 2, 3], {x: 2}));
+  assertEquals(6, sum([1, 2, 3], {x: 2}));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(6, sum([1, 2, 3], {x: 2}));
+  assertEquals(0, sum([], {x: 2}));
+  // A receiver with another map fails the hoisted check before the first
+  // iteration and resumes in the interpreter with the initial loop state.
+  assertEquals(3, sum([1, 2, 3], {y: 0, x: 1}));
+  assertEquals(6, sum([1, 2, 3], {x: 2}));
+})();
+
+(function TestHoistedBodyChecksAreGuarded() {
+  function sum(a, o) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) {
+      s += o.x * o.y;
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(12, sum([1, 2], {x: 2, y: 3}));
+  assertEquals(12, sum([1, 2], {x: 2, y: 3}));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(12, sum([1, 2], {x: 2, y: 3}));
+  // The checks on {o} are hoisted out of the body behind a guard, so they
+  // don't run if the loop doesn't.
+  assertEquals(0, sum([], {y: 3, x: 2}));
+  assertOptimized(sum);
+  // Otherwise they deoptimize before the first iteration.
+  assertEquals(6, sum([1], {y: 3, x: 2}));
+  assertEquals(12, sum([1, 2], {x: 2, y: 3}));
+})();
+
+(function TestLoopWithStoresIsUnchanged() {
+  function fill(a, o) {
+    for (let i = 0; i < a.length; i++) {
+      a[i] = o.x;
+    }
+    return a;
+  }
+
+  %PrepareFunctionForOptimization(fill);
+  assertEquals([1, 1], fill([0, 0], {x: 1}));
+  %OptimizeFunctionOnNextCall(fill);
+  assertEquals([1, 1], fill([0, 0], {x: 1}));
+  assertEquals([2, 2], fill([0, 0], {y: 0, x: 2}));
+})();
@@ -0,0 +1,77 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-vectorization
+
+function add(a, b, c) {
+  for (let i = 0; i < c.length; i++) c[i] = a[i] + b[i];
+  return c;
+}
+
+function check(TAConstructor, length) {
+  const a = new TAConstructor(length);
+  const b = new TAConstructor(length);
+  const expected = new TAConstructor(length);
+  for (let i = 0; i < length; i++) {
+    a[i] = i + 0.5;
+    b[i] = 2 * i;
+    expected[i] = a[i] + b[i];
+  }
+  assertEquals(expected, add(a, b, new TAConstructor(length)));
+}
+
+for (const TAConstructor of [Int32Array, Float32Array, Float64Array]) {
+  %PrepareFunctionForOptimization(add);
+  // Lengths that leave no, some and only scalar iterations.
+  for (const length of [0, 1, 3, 8, 13]) check(TAConstructor, length);
+  %OptimizeFunctionOnNextCall(add);
+  for (const length of [0, 1, 3, 8, 13, 1000]) check(TAConstructor, length);
+  %DeoptimizeFunction(add);
+  %ClearFunctionFeedback(add);
+}
+
+(function TestOverlappingArrays() {
+  function shift(a, c) {
+    for (let i = 0; i < c.length; i++) c[i] = a[i] * 2;
+    return c;
+  }
+
+  const buffer = new Float64Array(16).fill(1).buffer;
+  %PrepareFunctionForOptimization(shift);
+  shift(new Float64Array(8), new Float64Array(8));
+  %OptimizeFunctionOnNextCall(shift);
+  // Each element is read after the previous iteration doubled it.
+  const a = new Float64Array(buffer, 0, 8);
+  const c = new Float64Array(buffer, 8, 8);
+  shift(a, c);
+  assertEquals([1, 2, 4, 8, 16, 32, 64, 128, 256], Array.from(a).concat(c[7]));
+})();
+
+(function TestInPlace() {
+  function double(a) {
+    for (let i = 0; i < a.length; i++) a[i] = a[i] + a[i];
+    return a;
+  }
+
+  %PrepareFunctionForOptimization(double);
+  assertEquals(new Int32Array([2, 4, 6]), double(new Int32Array([1, 2, 3])));
+  %OptimizeFunctionOnNextCall(double);
+  assertEquals(new Int32Array([2, 4, 6, 8, 10]),
+               double(new Int32Array([1, 2, 3, 4, 5])));
+})();
+
+(function TestShorterInput() {
+  function copy(a, c) {
+    for (let i = 0; i < c.length; i++) c[i] = a[i] + 1;
+    return c;
+  }
+
+  %PrepareFunctionForOptimization(copy);
+  copy(new Int32Array(8), new Int32Array(8));
+  %OptimizeFunctionOnNextCall(copy);
+  copy(new Int32Array(8), new Int32Array(8));
+  // Reading past the end of {a} leaves the optimized code.
+  assertEquals(new Int32Array([1, 1, 0, 0, 0, 0]),
+               copy(new Int32Array(2), new Int32Array(6)));
+})();
@@ -0,0 +1,63 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-mid-tier-regalloc-threshold=0
+
+// With a threshold of 0, every JavaScript function is allocated by the
+// mid-tier register allocator.
+
+(function TestDeopt() {
+  function foo(a, b) {
+    const x = a + b;
+    const y = a * b;
+    return x - y;
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(-1, foo(2, 3));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(-1, foo(2, 3));
+  assertOptimized(foo);
+  assertEquals(-0.25, foo(0.5, 1.5));
+  assertUnoptimized(foo);
+})();
+
+(function TestExceptionHandler() {
+  function thrower(x) {
+    if (x > 2) throw x;
+    return x;
+  }
+
+  function foo(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+      try {
+        sum += thrower(i);
+      } catch (e) {
+        sum -= e;
+      }
+    }
+    return sum;
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(-6, foo(5));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(-6, foo(5));
+  assertOptimized(foo);
+})();
+
+(function TestOsr() {
+  function foo() {
+    let a = 0, b = 1;
+    for (let i = 0; i < 10; i++) {
+      if (i == 5) %OptimizeOsr();
+      [a, b] = [b, a + b];
+    }
+    return a;
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(55, foo());
+})();
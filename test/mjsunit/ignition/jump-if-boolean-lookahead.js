@@ -0,0 +1,67 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-always-opt
+
+// Test bytecodes inline a following JumpIfTrue/JumpIfFalse; check both the
+// taken and fall-through paths of each fused pair in the interpreter.
+
+function compare(a, b) {
+  var r = "";
+  if (a == b) r += "eq ";
+  if (a === b) r += "seq ";
+  if (a < b) r += "lt ";
+  if (a > b) r += "gt ";
+  if (a <= b) r += "le ";
+  if (a >= b) r += "ge ";
+  if (!(a < b)) r += "!lt ";
+  return r;
+}
+%NeverOptimizeFunction(compare);
+
+assertEquals("lt le ", compare(1, 2));
+assertEquals("eq seq le ge !lt ", compare(2, 2));
+assertEquals("eq le ge !lt ", compare(2, "2"));
+assertEquals("gt ge !lt ", compare(3, 2));
+assertEquals("!lt ", compare(NaN, 1));
+assertEquals("lt le ", compare("a", "b"));
+
+function tests(o) {
+  var r = "";
+  if (o === null) r += "null ";
+  if (o === undefined) r += "undefined ";
+  if (o == null) r += "undetectable ";
+  if (typeof o === "object") r += "object ";
+  if (typeof o === "function") r += "function ";
+  if (o instanceof Array) r += "array ";
+  if (o != null && typeof o === "object" && "x" in o) r += "x ";
+  return r;
+}
+%NeverOptimizeFunction(tests);
+
+assertEquals("null undetectable object ", tests(null));
+assertEquals("undefined undetectable ", tests(undefined));
+assertEquals("object array ", tests([]));
+assertEquals("object x ", tests({x: 1}));
+assertEquals("function ", tests(function() {}));
+assertEquals("undetectable ", tests(%GetUndetectable()));
+
+// Loop conditions exercise the fused forward exit jump together with the
+// backward JumpLoop, including interrupt budget updates.
+function loop(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    if (i % 3 === 0) continue;
+    sum += i;
+  }
+  while (n > 0) n--;
+  return sum + n;
+}
+%NeverOptimizeFunction(loop);
+
+assertEquals(0, loop(0));
+assertEquals(0, loop(1));
+assertEquals(3, loop(3));
+assertEquals(3267, loop(100));
+for (var i = 0; i < 10; i++) assertEquals(332667, loop(1000));
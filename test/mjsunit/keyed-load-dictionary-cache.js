@@ -0,0 +1,80 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+// Megamorphic keyed loads from dictionary-mode objects go through the
+// dictionary lookup cache; make sure stale entries are never observed.
+
+function makeDictionary(n) {
+  var o = {};
+  for (var i = 0; i < n; i++) o["p" + i] = i;
+  delete o.p0;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+function load(o, key) {
+  return o[key];
+}
+
+var objects = [];
+for (var i = 0; i < 8; i++) objects.push(makeDictionary(10 + i));
+var keys = ["p1", "p2", "p3", "p4", "p5", "p6", "p7", "p8", "p9"];
+
+function check() {
+  for (var o of objects) {
+    for (var k of keys) {
+      assertEquals(k in o ? o[k] : undefined, load(o, k));
+    }
+  }
+}
+
+check();
+check();
+
+// Delete and re-add properties so that entries move within the dictionary.
+for (var o of objects) {
+  delete o.p3;
+  delete o.p5;
+}
+for (var o of objects) {
+  assertEquals(undefined, load(o, "p3"));
+  assertEquals(undefined, load(o, "p5"));
+}
+for (var o of objects) {
+  o.p5 = "five";
+  o.p3 = "three";
+}
+for (var o of objects) {
+  assertEquals("three", load(o, "p3"));
+  assertEquals("five", load(o, "p5"));
+}
+
+// Force the dictionaries to grow and rehash.
+for (var o of objects) {
+  for (var i = 100; i < 200; i++) o["p" + i] = i;
+}
+check();
+for (var o of objects) assertEquals(150, load(o, "p150"));
+
+// Objects with the same dictionary map can keep a name at different indices,
+// or not have it at all.
+var a = Object.create(null);
+var b = Object.create(null);
+for (var i = 0; i < 10; i++) a["p" + i] = b["p" + i] = i;
+for (var i = 100; i < 200; i++) b["p" + i] = i;
+delete b.p2;
+assertFalse(%HasFastProperties(a));
+assertTrue(%HaveSameMap(a, b));
+for (var i = 0; i < 3; i++) {
+  assertEquals(1, load(a, "p1"));
+  assertEquals(1, load(b, "p1"));
+  assertEquals(2, load(a, "p2"));
+  assertEquals(undefined, load(b, "p2"));
+}
+
+// Moving objects must not leave dangling cache entries behind.
+gc();
+check();
@@ -0,0 +1,19 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-opt
+
+// typeof isn't supported by Maglev yet. Compilation bails out and the function
+// keeps running in the lower tiers.
+function f(x) {
+  return typeof x;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals("number", f(1));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals("number", f(1));
+assertUnoptimized(f);
+assertEquals("string", f("a"));
@@ -0,0 +1,43 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-opt
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+function add(a, b) {
+  return a + b;
+}
+
+function f(o) {
+  let p = new Point(o.a, 2);
+  return add(p.x, p.y) + o.g(1) * -o.a;
+}
+
+let o = {a: 3, g(x) { return x + this.a; }};
+
+%PrepareFunctionForOptimization(f);
+assertEquals(-7, f(o));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals(-7, f(o));
+assertOptimized(f);
+assertEquals("ab2NaN", f({a: "ab", g() { return 1; }}));
+
+function g(s, args) {
+  let h = (x) => add(x, 1);
+  let p = new Point(...args);
+  return h(add(...args)) + %StringCharCodeAt(s, p.y);
+}
+
+%PrepareFunctionForOptimization(g);
+assertEquals(103, g("abc", [1, 2]));
+
+%OptimizeMaglevOnNextCall(g);
+assertEquals(103, g("abc", [1, 2]));
+assertOptimized(g);
+assertEquals(123, g("xy", [0, 1]));
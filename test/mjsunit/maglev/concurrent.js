@@ -0,0 +1,24 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --concurrent-recompilation
+// Flags: --no-always-opt
+
+function f(x) {
+  return x + 1;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(2, f(1));
+
+%OptimizeMaglevOnNextCall(f, "concurrent");
+// The call queues the job and keeps running the unoptimized code.
+assertEquals(3, f(2));
+assertUnoptimized(f);
+
+// Installs the code of the finished job.
+%FinalizeOptimization();
+assertEquals(4, f(3));
+assertOptimized(f);
+assertFalse(isTurboFanned(f));
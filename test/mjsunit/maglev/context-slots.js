@@ -0,0 +1,25 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-opt
+
+function outer() {
+  // A let binding would need a hole check, which Maglev doesn't support yet.
+  var counter = 0;
+  function inner() {
+    counter = counter + 1;
+    return counter;
+  }
+  return inner;
+}
+
+let inner = outer();
+%PrepareFunctionForOptimization(inner);
+assertEquals(1, inner());
+assertEquals(2, inner());
+
+%OptimizeMaglevOnNextCall(inner);
+assertEquals(3, inner());
+assertOptimized(inner);
+assertEquals(4, inner());
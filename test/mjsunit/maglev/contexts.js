@@ -0,0 +1,28 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-opt
+
+// Allocates a function context and a block context, and pushes and pops the
+// block context around the inner closure.
+function f(o) {
+  var sum = 0;
+  var get = () => sum;
+  {
+    let k = o.k;
+    let add = (x) => { sum += x + k; };
+    add(o.x);
+    add(k);
+  }
+  return get();
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(31, f({k: 10, x: 1}));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals(31, f({k: 10, x: 1}));
+assertOptimized(f);
+// A new map deopts inside the block, with the block context pushed.
+assertEquals(11, f({x: 2, k: 3}));
@@ -0,0 +1,22 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-opt
+
+function f(o) {
+  let keys = "";
+  for (let k in o) keys += k + o[k];
+  return keys;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals("a1b2", f({a: 1, b: 2}));
+assertEquals("", f(null));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals("a1b2", f({a: 1, b: 2}));
+assertEquals("", f(undefined));
+assertOptimized(f);
+// A receiver whose map differs from the enum cache type takes the slow path.
+assertEquals("c3d4", f({c: 3, d: 4}));
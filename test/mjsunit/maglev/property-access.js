@@ -0,0 +1,46 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-opt
+
+function load(o) {
+  return o.x;
+}
+
+%PrepareFunctionForOptimization(load);
+assertEquals(1, load({x: 1}));
+assertEquals(2, load({y: 0, x: 2}));
+
+%OptimizeMaglevOnNextCall(load);
+assertEquals(1, load({x: 1}));
+assertEquals(2, load({y: 0, x: 2}));
+assertOptimized(load);
+// A map that isn't in the feedback deopts.
+assertEquals(3, load({z: 0, y: 0, x: 3}));
+
+function keyed(o, k, v) {
+  o[k] = v;
+  return o[k];
+}
+
+%PrepareFunctionForOptimization(keyed);
+assertEquals(1, keyed([], 0, 1));
+assertEquals(2, keyed({}, "a", 2));
+
+%OptimizeMaglevOnNextCall(keyed);
+assertEquals(1, keyed([], 0, 1));
+assertEquals(2, keyed({}, "a", 2));
+assertOptimized(keyed);
+
+function store(o, v) {
+  o.y = v;
+  return o;
+}
+
+%PrepareFunctionForOptimization(store);
+assertEquals(1, store({}, 1).y);
+
+%OptimizeMaglevOnNextCall(store);
+assertEquals(2, store({}, 2).y);
+assertOptimized(store);
@@ -4,8 +4,14 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "src/api/api-inl.h"
 #include "src/base/atomic-utils.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/platform/semaphore.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -14,7 +20,9 @@
 #include "src/handles/handles.h"
 #include "src/heap/local-heap.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/parsing/parse-info.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -64,6 +72,101 @@ class BlockingCompilationJob : public OptimizedCompilationJob {
   base::Semaphore semaphore_;
 };
 
+// The jobs that ran, in the order they started, and how many ran at once.
+struct ExecutionLog {
+  base::Mutex mutex;
+  std::vector<int> order;
+  int running = 0;
+  int max_running = 0;
+};
+
+class RecordingCompilationJob : public OptimizedCompilationJob {
+ public:
+  RecordingCompilationJob(Isolate* isolate, Handle<JSFunction> function,
+                          int id, ExecutionLog* log)
+      : OptimizedCompilationJob(&info_, "RecordingCompilationJob",
+                                State::kReadyToExecute),
+        shared_(function->shared(), isolate),
+        zone_(isolate->allocator(), ZONE_NAME),
+        info_(&zone_, isolate, shared_, function, CodeKind::TURBOFAN),
+        id_(id),
+        log_(log) {}
+  ~RecordingCompilationJob() override = default;
+  RecordingCompilationJob(const RecordingCompilationJob&) = delete;
+  RecordingCompilationJob& operator=(const RecordingCompilationJob&) = delete;
+
+  // OptimiziedCompilationJob implementation.
+  Status PrepareJobImpl(Isolate* isolate) override { UNREACHABLE(); }
+
+  Status ExecuteJobImpl(RuntimeCallStats* stats,
+                        LocalIsolate* local_isolate) override {
+    {
+      base::MutexGuard guard(&log_->mutex);
+      log_->order.push_back(id_);
+      log_->max_running = std::max(log_->max_running, ++log_->running);
+    }
+    // Give other workers a chance to overlap with this job.
+    base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+    {
+      base::MutexGuard guard(&log_->mutex);
+      --log_->running;
+    }
+    return SUCCEEDED;
+  }
+
+  Status FinalizeJobImpl(Isolate* isolate) override { return SUCCEEDED; }
+
+ private:
+  Handle<SharedFunctionInfo> shared_;
+  Zone zone_;
+  OptimizedCompilationInfo info_;
+  const int id_;
+  ExecutionLog* const log_;
+};
+
+class OptimizingCompileDispatcherPriorityTest
+    : public OptimizingCompileDispatcherTest {
+ protected:
+  // Creates a function with a feedback vector that has been invoked the given
+  // number of times. All functions have the same bytecode length.
+  Handle<JSFunction> CreateFunction(int invocation_count) {
+    std::string source =
+        "(function f" + std::to_string(function_count_++) + "() {})";
+    Handle<JSFunction> function = RunJS<JSFunction>(source.c_str());
+    IsCompiledScope is_compiled_scope;
+    CHECK(Compiler::Compile(i_isolate(), function, Compiler::CLEAR_EXCEPTION,
+                            &is_compiled_scope));
+    JSFunction::EnsureFeedbackVector(function, &is_compiled_scope);
+    function->feedback_vector().set_invocation_count(invocation_count,
+                                                     kRelaxedStore);
+    return function;
+  }
+
+  // Queues a job that occupies the only worker until it is signalled, so
+  // that the jobs queued after it wait in the input queue.
+  BlockingCompilationJob* QueueBlockingJob(
+      OptimizingCompileDispatcher* dispatcher) {
+    BlockingCompilationJob* job =
+        new BlockingCompilationJob(i_isolate(), CreateFunction(0));
+    dispatcher->QueueForOptimization(job);
+    // Busy-wait for the job to run on a background thread.
+    while (!job->IsBlocking()) {
+    }
+    return job;
+  }
+
+  void QueueJob(OptimizingCompileDispatcher* dispatcher,
+                Handle<JSFunction> function, int id) {
+    dispatcher->QueueForOptimization(
+        new RecordingCompilationJob(i_isolate(), function, id, &log_));
+  }
+
+  ExecutionLog log_;
+
+ private:
+  int function_count_ = 0;
+};
+
 }  // namespace
 
 TEST_F(OptimizingCompileDispatcherTest, Construct) {
@@ -97,5 +200,88 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherPriorityTest, HotterJobsFirst) {
+  FlagScope<unsigned int> max_threads(
+      &FLAG_concurrent_recompilation_max_threads, 1);
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  BlockingCompilationJob* blocker = QueueBlockingJob(&dispatcher);
+
+  QueueJob(&dispatcher, CreateFunction(1), 0);
+  QueueJob(&dispatcher, CreateFunction(10), 1);
+  QueueJob(&dispatcher, CreateFunction(100), 2);
+  // Equal priorities are compiled in the order they were queued.
+  QueueJob(&dispatcher, CreateFunction(10), 3);
+
+  blocker->Signal();
+  dispatcher.AwaitCompileTasks();
+  EXPECT_EQ((std::vector<int>{2, 1, 3, 0}), log_.order);
+  // The jobs only stayed queued behind the blocker because a single worker
+  // was allowed.
+  EXPECT_EQ(1, log_.max_running);
+  dispatcher.Stop();
+}
+
+TEST_F(OptimizingCompileDispatcherPriorityTest, PrioritiesAreUpdated) {
+  FlagScope<unsigned int> max_threads(
+      &FLAG_concurrent_recompilation_max_threads, 1);
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  BlockingCompilationJob* blocker = QueueBlockingJob(&dispatcher);
+
+  Handle<JSFunction> warm = CreateFunction(10);
+  Handle<JSFunction> heating_up = CreateFunction(5);
+  QueueJob(&dispatcher, warm, 0);
+  QueueJob(&dispatcher, heating_up, 1);
+  // The function keeps running while its job waits.
+  heating_up->feedback_vector().set_invocation_count(100, kRelaxedStore);
+  dispatcher.UpdatePriorities();
+
+  blocker->Signal();
+  dispatcher.AwaitCompileTasks();
+  EXPECT_EQ((std::vector<int>{1, 0}), log_.order);
+  dispatcher.Stop();
+}
+
+TEST_F(OptimizingCompileDispatcherPriorityTest, EvictsLeastImportantJob) {
+  FlagScope<unsigned int> max_threads(
+      &FLAG_concurrent_recompilation_max_threads, 1);
+  FlagScope<int> queue_length(&FLAG_concurrent_recompilation_queue_length, 2);
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  BlockingCompilationJob* blocker = QueueBlockingJob(&dispatcher);
+
+  QueueJob(&dispatcher, CreateFunction(10), 0);
+  QueueJob(&dispatcher, CreateFunction(5), 1);
+  EXPECT_FALSE(dispatcher.IsQueueAvailable());
+
+  // A colder function doesn't displace any queued job.
+  EXPECT_FALSE(dispatcher.EnsureQueueAvailable(*CreateFunction(1), false));
+  // A hotter one replaces the coldest job.
+  Handle<JSFunction> hot = CreateFunction(100);
+  EXPECT_TRUE(dispatcher.EnsureQueueAvailable(*hot, false));
+  QueueJob(&dispatcher, hot, 2);
+
+  blocker->Signal();
+  dispatcher.AwaitCompileTasks();
+  EXPECT_EQ((std::vector<int>{2, 0}), log_.order);
+  dispatcher.Stop();
+}
+
+TEST_F(OptimizingCompileDispatcherPriorityTest, CancelsStaleJobs) {
+  FlagScope<unsigned int> max_threads(
+      &FLAG_concurrent_recompilation_max_threads, 1);
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  BlockingCompilationJob* blocker = QueueBlockingJob(&dispatcher);
+
+  Handle<JSFunction> disabled = CreateFunction(100);
+  QueueJob(&dispatcher, disabled, 0);
+  QueueJob(&dispatcher, CreateFunction(10), 1);
+  disabled->shared().DisableOptimization(BailoutReason::kNeverOptimize);
+  dispatcher.CancelStaleJobs();
+
+  blocker->Signal();
+  dispatcher.AwaitCompileTasks();
+  EXPECT_EQ((std::vector<int>{1}), log_.order);
+  dispatcher.Stop();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,173 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+#include "testing/gmock-support.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopInvariantCodeMotionTest : public TypedGraphTest {
+ public:
+  LoopInvariantCodeMotionTest()
+      : TypedGraphTest(3),
+        simplified_(zone()),
+        jsgraph_(isolate(), graph(), common(), nullptr, simplified(), nullptr) {
+    // The typer isn't running, so type the placeholders by hand.
+    NodeProperties::SetType(jsgraph()->ZeroConstant(),
+                            Type::Constant(0.0, zone()));
+    NodeProperties::SetType(jsgraph()->UndefinedConstant(), Type::Undefined());
+    NodeProperties::SetType(jsgraph()->EmptyStringConstant(), Type::String());
+  }
+  ~LoopInvariantCodeMotionTest() override = default;
+
+ protected:
+  // The header of `for (let i = 0; i < array.length; i++) { ... }`.
+  struct Loop {
+    Node* loop;
+    Node* effect_phi;
+    Node* phi;
+    Node* check;
+    Node* length;
+    Node* if_true;
+  };
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  Node* CheckMaps(Node* object, Node* effect, Node* control) {
+    return graph()->NewNode(
+        simplified()->CheckMaps(CheckMapsFlag::kNone, ZoneHandleSet<Map>()),
+        object, effect, control);
+  }
+
+  Node* LoadLength(Node* array, Node* effect, Node* control) {
+    FieldAccess access = AccessBuilder::ForJSArrayLength(PACKED_ELEMENTS);
+    return graph()->NewNode(simplified()->LoadField(access), array, effect,
+                            control);
+  }
+
+  Loop NewLoop(Node* array) {
+    Loop l;
+    l.loop = graph()->NewNode(common()->Loop(2), start(), start());
+    l.effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), l.loop);
+    l.phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                             jsgraph()->ZeroConstant(),
+                             jsgraph()->ZeroConstant(), l.loop);
+    Node* checkpoint = graph()->NewNode(
+        common()->Checkpoint(), EmptyFrameState(), l.effect_phi, l.loop);
+    l.check = CheckMaps(array, checkpoint, l.loop);
+    l.length = LoadLength(array, l.check, l.loop);
+    Node* branch = graph()->NewNode(
+        common()->Branch(),
+        graph()->NewNode(simplified()->NumberLessThan(), l.phi, l.length),
+        l.loop);
+    l.if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    Node* exit = graph()->NewNode(common()->LoopExit(), if_false, l.loop);
+    Node* exit_effect =
+        graph()->NewNode(common()->LoopExitEffect(), l.length, exit);
+    Node* ret = graph()->NewNode(common()->Return(), Int32Constant(0),
+                                 Int32Constant(0), exit_effect, exit);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+    return l;
+  }
+
+  // Closes the loop with the {effect} and increment at the end of the body.
+  void CloseLoop(const Loop& l, Node* effect, Node* increment) {
+    l.loop->ReplaceInput(1, l.if_true);
+    l.effect_phi->ReplaceInput(1, effect);
+    l.phi->ReplaceInput(1, graph()->NewNode(simplified()->NumberAdd(), l.phi,
+                                            increment));
+  }
+
+  void RunLoopInvariantCodeMotion() {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+    LoopInvariantCodeMotion(jsgraph(), loop_tree, zone()).Run();
+  }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  JSGraph jsgraph_;
+};
+
+TEST_F(LoopInvariantCodeMotionTest, HoistsFromHeader) {
+  Node* array = Parameter(Type::Any(), 0);
+  Loop l = NewLoop(array);
+  CloseLoop(l, l.length, jsgraph()->OneConstant());
+
+  RunLoopInvariantCodeMotion();
+
+  // The header runs at least once, so no guard is needed.
+  EXPECT_EQ(start(), l.loop->InputAt(0));
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(l.check));
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(l.length));
+  EXPECT_EQ(IrOpcode::kCheckpoint,
+            NodeProperties::GetEffectInput(l.check)->opcode());
+  EXPECT_EQ(l.length, l.effect_phi->InputAt(0));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, HoistsFromBodyBehindGuard) {
+  Node* array = Parameter(Type::Any(), 0);
+  Node* object = Parameter(Type::Any(), 1);
+  Loop l = NewLoop(array);
+  Node* checkpoint = graph()->NewNode(common()->Checkpoint(),
+                                      EmptyFrameState(), l.length, l.if_true);
+  Node* check = CheckMaps(object, checkpoint, l.if_true);
+  Node* load = LoadLength(object, check, l.if_true);
+  NodeProperties::SetType(load, Type::SignedSmall());
+  CloseLoop(l, load, load);
+  Node* add = l.phi->InputAt(1);
+
+  RunLoopInvariantCodeMotion();
+
+  Matcher<Node*> guard = IsBranch(
+      IsNumberLessThan(jsgraph()->ZeroConstant(), l.length), start());
+  EXPECT_THAT(l.loop->InputAt(0), IsMerge(IsIfTrue(guard), IsIfFalse(guard)));
+  Node* merge = l.loop->InputAt(0);
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(l.length));
+  EXPECT_THAT(NodeProperties::GetControlInput(check), IsIfTrue(guard));
+  EXPECT_THAT(NodeProperties::GetControlInput(load), IsIfTrue(guard));
+  EXPECT_EQ(l.length, NodeProperties::GetEffectInput(check));
+  EXPECT_THAT(l.effect_phi->InputAt(0), IsEffectPhi(load, l.length, merge));
+  // The body never runs if the guard fails, which the placeholder stands in
+  // for.
+  EXPECT_THAT(add->InputAt(1),
+              IsPhi(MachineRepresentation::kTagged, load,
+                    jsgraph()->ZeroConstant(), merge));
+  EXPECT_EQ(checkpoint, l.effect_phi->InputAt(1));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepsLoopsWithStores) {
+  Node* array = Parameter(Type::Any(), 0);
+  Node* object = Parameter(Type::Any(), 1);
+  Loop l = NewLoop(array);
+  FieldAccess access = AccessBuilder::ForJSArrayLength(PACKED_ELEMENTS);
+  Node* store = graph()->NewNode(simplified()->StoreField(access), object,
+                                 l.phi, l.length, l.if_true);
+  CloseLoop(l, store, jsgraph()->OneConstant());
+
+  RunLoopInvariantCodeMotion();
+
+  EXPECT_EQ(start(), l.loop->InputAt(0));
+  EXPECT_EQ(l.loop, NodeProperties::GetControlInput(l.check));
+  EXPECT_EQ(l.loop, NodeProperties::GetControlInput(l.length));
+  EXPECT_EQ(start(), l.effect_phi->InputAt(0));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -147,6 +147,28 @@ TEST_F(UnifiedHeapTest, TracedReferenceRetainsFromStack) {
   EXPECT_TRUE(local->IsObject());
 }
 
+#if defined(CPPGC_YOUNG_GENERATION)
+TEST_F(UnifiedHeapTest, YoungGenerationGCRunsMinorCppGC) {
+  if (!FLAG_cppgc_young_generation) return;
+  v8::HandleScope scope(v8_isolate());
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+  v8::Context::Scope context_scope(context);
+  cppgc::testing::OverrideEmbedderStackStateScope stack_scope(
+      cpp_heap(), cppgc::EmbedderStackState::kNoHeapPointers);
+  uint16_t wrappable_type = WrapperHelper::kTracedEmbedderId;
+  auto* wrapped = cppgc::MakeGarbageCollected<Wrappable>(allocation_handle());
+  v8::Local<v8::Object> api_object =
+      WrapperHelper::CreateWrapper(context, &wrappable_type, wrapped);
+  cppgc::MakeGarbageCollected<Wrappable>(allocation_handle());
+  Wrappable::destructor_callcount = 0;
+  CollectGarbage(NEW_SPACE);
+  cpp_heap().FinishSweepingIfRunning();
+  // Only the object that is not reachable from V8 was reclaimed.
+  EXPECT_EQ(1u, Wrappable::destructor_callcount);
+  EXPECT_FALSE(api_object.IsEmpty());
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+
 TEST_F(UnifiedHeapDetachedTest, AllocationBeforeConfigureHeap) {
   auto heap = v8::CppHeap::Create(
       V8::GetCurrentPlatform(),
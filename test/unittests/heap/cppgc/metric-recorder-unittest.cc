@@ -50,10 +50,10 @@ class MetricRecorderTest : public testing::TestWithHeap {
     stats->SetMetricRecorder(std::make_unique<MetricRecorderImpl>());
   }
 
-  void StartGC() {
+  void StartGC(GarbageCollector::Config::CollectionType collection_type =
+                   GarbageCollector::Config::CollectionType::kMajor) {
     stats->NotifyMarkingStarted(
-        GarbageCollector::Config::CollectionType::kMajor,
-        GarbageCollector::Config::IsForcedGC::kNotForced);
+        collection_type, GarbageCollector::Config::IsForcedGC::kNotForced);
   }
   void EndGC(size_t marked_bytes) {
     stats->NotifyMarkingCompleted(marked_bytes);
@@ -147,6 +147,17 @@ TEST_F(MetricRecorderTest, CycleEndMetricsReportedOnGcEnd) {
   EXPECT_EQ(1u, MetricRecorderImpl::FullCycle_callcount);
 }
 
+TEST_F(MetricRecorderTest, CycleTypeReported) {
+  StartGC(GarbageCollector::Config::CollectionType::kMinor);
+  EndGC(0);
+  EXPECT_EQ(MetricRecorder::FullCycle::Type::kMinor,
+            MetricRecorderImpl::FullCycle_event.type);
+  StartGC(GarbageCollector::Config::CollectionType::kMajor);
+  EndGC(0);
+  EXPECT_EQ(MetricRecorder::FullCycle::Type::kMajor,
+            MetricRecorderImpl::FullCycle_event.type);
+}
+
 TEST_F(MetricRecorderTest, CycleEndHistogramReportsCorrectValues) {
   StartGC();
   {
@@ -13,6 +13,7 @@
 #include "src/handles/handles.h"
 
 #include "src/heap/heap-controller.h"
+#include "src/heap/spaces.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -108,5 +109,51 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
           new_space_capacity, factor, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST(YoungGenerationSizeControllerTest, DesiredCapacity) {
+  const size_t min_capacity = Page::kPageSize;
+  const size_t max_capacity = 64 * MB;
+  const size_t current_capacity = 2 * MB;
+  const double allocation_throughput = MB;
+  const double mu = YoungGenerationSizeController::kTargetMutatorUtilization;
+
+  // Without history the current capacity is kept.
+  EXPECT_EQ(current_capacity,
+            YoungGenerationSizeController::DesiredCapacity(
+                0, 0, allocation_throughput, current_capacity, min_capacity,
+                max_capacity));
+  EXPECT_EQ(current_capacity,
+            YoungGenerationSizeController::DesiredCapacity(
+                1, 0, 0, current_capacity, min_capacity, max_capacity));
+
+  // Nothing survives: the GC cost is amortized over the capacity.
+  const size_t expected = ::RoundUp(
+      static_cast<size_t>(allocation_throughput * mu / (1 - mu)),
+      Page::kPageSize);
+  EXPECT_EQ(expected, YoungGenerationSizeController::DesiredCapacity(
+                          1, 0, allocation_throughput, current_capacity,
+                          min_capacity, max_capacity));
+
+  // Slower GCs need a larger capacity, bounded by the maximum.
+  EXPECT_EQ(max_capacity, YoungGenerationSizeController::DesiredCapacity(
+                              10, 0, allocation_throughput, current_capacity,
+                              min_capacity, max_capacity));
+
+  // Fast GCs or low allocation throughput settle on the minimum.
+  EXPECT_EQ(min_capacity, YoungGenerationSizeController::DesiredCapacity(
+                              0.001, 0, allocation_throughput,
+                              current_capacity, min_capacity, max_capacity));
+
+  // Survivors increase the desired capacity.
+  EXPECT_LT(expected, YoungGenerationSizeController::DesiredCapacity(
+                          1, 0.01, allocation_throughput, current_capacity,
+                          min_capacity, max_capacity));
+
+  // If survivors alone exceed the budget, growing does not help.
+  EXPECT_EQ(current_capacity,
+            YoungGenerationSizeController::DesiredCapacity(
+                1, 0.5, allocation_throughput, current_capacity, min_capacity,
+                max_capacity));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -329,5 +329,52 @@ TEST(MemoryReducer, FromRunToWait) {
   EXPECT_EQ(2000, state1.last_gc_time_ms);
 }
 
+TEST(MemoryReducer, BudgetDisabled) {
+  EXPECT_EQ(MemoryReducer::BudgetAction::kNone,
+            MemoryReducer::ComputeBudgetAction(0, 1000 * MB, 0, true, 0));
+}
+
+TEST(MemoryReducer, BudgetBelowSoftLimit) {
+  const size_t kBudget = 100 * MB;
+  EXPECT_EQ(MemoryReducer::BudgetAction::kNone,
+            MemoryReducer::ComputeBudgetAction(kBudget, 50 * MB, 0, true,
+                                               0));
+}
+
+TEST(MemoryReducer, BudgetAboveSoftLimit) {
+  const size_t kBudget = 100 * MB;
+  const size_t kCommitted = 95 * MB;
+  // Waits for an idle window for a while.
+  EXPECT_EQ(MemoryReducer::BudgetAction::kNone,
+            MemoryReducer::ComputeBudgetAction(kBudget, kCommitted, 0, false,
+                                               0));
+  EXPECT_EQ(MemoryReducer::BudgetAction::kStartGC,
+            MemoryReducer::ComputeBudgetAction(kBudget, kCommitted, 0, true,
+                                               0));
+  EXPECT_EQ(MemoryReducer::BudgetAction::kStartGC,
+            MemoryReducer::ComputeBudgetAction(
+                kBudget, kCommitted, 0, false,
+                MemoryReducer::kBudgetIdleWaitMs));
+}
+
+TEST(MemoryReducer, BudgetExceeded) {
+  const size_t kBudget = 100 * MB;
+  EXPECT_EQ(MemoryReducer::BudgetAction::kStartGC,
+            MemoryReducer::ComputeBudgetAction(kBudget, 120 * MB, 0, false,
+                                               0));
+}
+
+TEST(MemoryReducer, BudgetNoGrowthSinceLastGC) {
+  const size_t kBudget = 100 * MB;
+  // The last full GC could not get below the budget and the heap did not grow
+  // since, so another GC is unlikely to help.
+  EXPECT_EQ(MemoryReducer::BudgetAction::kNone,
+            MemoryReducer::ComputeBudgetAction(kBudget, 120 * MB, 115 * MB,
+                                               true, 0));
+  EXPECT_EQ(MemoryReducer::BudgetAction::kStartGC,
+            MemoryReducer::ComputeBudgetAction(kBudget, 140 * MB, 115 * MB,
+                                               false, 0));
+}
+
 }  // namespace internal
 }  // namespace v8
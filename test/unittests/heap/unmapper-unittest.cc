@@ -365,6 +365,40 @@ TEST_F(SequentialUnmapperTest, UnmapOnTeardown) {
   tracking_page_allocator()->CheckIsFree(page->address(), page_size);
 #endif  // V8_COMPRESS_POINTERS
 }
+
+TEST_F(SequentialUnmapperTest, HugePagesPoolCommittedPages) {
+  if (FLAG_enable_third_party_heap) return;
+  const bool old_flag = FLAG_huge_pages_for_old_and_code_space;
+  FLAG_huge_pages_for_old_and_code_space = true;
+  PagedSpace* old_space = static_cast<PagedSpace*>(heap()->old_space());
+  Page* page = allocator()->AllocatePage(
+      MemoryAllocator::kUsePool,
+      MemoryChunkLayout::AllocatableMemoryInDataPage(), old_space,
+      Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  const Address address = page->address();
+  const size_t page_size = tracking_page_allocator()->AllocatePageSize();
+  allocator()->Free(MemoryAllocator::kConcurrently, page);
+  unmapper()->FreeQueuedChunks();
+  // The page stays committed so that the huge page backing it is not split.
+  tracking_page_allocator()->CheckPagePermissions(address, page_size,
+                                                  PageAllocator::kReadWrite);
+  EXPECT_LT(0u, unmapper()->CommittedBufferedMemory());
+  page = allocator()->AllocatePage(
+      MemoryAllocator::kUsePool,
+      MemoryChunkLayout::AllocatableMemoryInDataPage(), old_space,
+      Executability::NOT_EXECUTABLE);
+  EXPECT_EQ(address, page->address());
+  allocator()->Free(MemoryAllocator::kConcurrently, page);
+  unmapper()->TearDown();
+#ifdef V8_COMPRESS_POINTERS
+  tracking_page_allocator()->CheckPagePermissions(address, page_size,
+                                                  PageAllocator::kNoAccess);
+#else
+  tracking_page_allocator()->CheckIsFree(address, page_size);
+#endif  // V8_COMPRESS_POINTERS
+  FLAG_huge_pages_for_old_and_code_space = old_flag;
+}
 #endif  // !V8_OS_FUCHSIA && !V8_SANDBOX
 
 }  // namespace internal
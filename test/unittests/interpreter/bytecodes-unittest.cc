@@ -319,6 +319,27 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef TEST_BYTECODE
 }
 
+TEST(Bytecodes, IsJumpIfBooleanLookahead) {
+#define TEST_BYTECODE(Name, ...)                                           \
+  if (Bytecodes::IsJumpIfBooleanLookahead(Bytecode::k##Name,               \
+                                          OperandScale::kSingle)) {        \
+    EXPECT_TRUE(Bytecodes::WritesAccumulator(Bytecode::k##Name));          \
+    EXPECT_FALSE(Bytecodes::IsJump(Bytecode::k##Name));                    \
+  }                                                                        \
+  EXPECT_FALSE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::k##Name,      \
+                                                   OperandScale::kDouble)); \
+  EXPECT_FALSE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::k##Name,      \
+                                                   OperandScale::kQuadruple));
+
+  BYTECODE_LIST(TEST_BYTECODE)
+#undef TEST_BYTECODE
+
+  EXPECT_TRUE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kTestLessThan,
+                                                  OperandScale::kSingle));
+  EXPECT_FALSE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kAdd,
+                                                   OperandScale::kSingle));
+}
+
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 
@@ -4,6 +4,7 @@
 
 #include "src/zone/zone.h"
 
+#include "src/flags/flags.h"
 #include "src/zone/accounting-allocator.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -22,5 +23,28 @@ TEST(Zone, 8ByteAlignment) {
   }
 }
 
+TEST(Zone, SegmentPoolReuse) {
+  if (FLAG_zone_segment_pool_size == 0) return;
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTest>(64);
+  }
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_LT(0u, allocator.GetPooledMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetSegmentPoolHits());
+
+  // A second zone of the same size gets the pooled segment.
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTest>(64);
+    EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+  }
+  EXPECT_EQ(1u, allocator.GetSegmentPoolHits());
+
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+}
+
 }  // namespace internal
 }  // namespace v8
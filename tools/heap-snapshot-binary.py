@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+# Copyright 2022 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+"""
+Reads heap snapshots written by v8::HeapSnapshot::Serialize in the kBinary
+format (see HeapSnapshotBinarySerializer in
+src/profiler/heap-snapshot-generator.h).
+
+Convert a snapshot to the JSON format that DevTools loads:
+  $ heap-snapshot-binary.py json in.heapsnapshot.bin > out.heapsnapshot
+
+Print a summary of a snapshot:
+  $ heap-snapshot-binary.py stats in.heapsnapshot.bin
+"""
+
+import argparse
+import json
+import sys
+
+MAGIC = b"V8HS"
+VERSION = 1
+
+NODE_FIELDS = [
+    "type", "name", "id", "self_size", "edge_count", "trace_node_id",
+    "detachedness"
+]
+NODE_TYPES = [
+    "hidden", "array", "string", "object", "code", "closure", "regexp",
+    "number", "native", "synthetic", "concatenated string", "sliced string",
+    "symbol", "bigint"
+]
+EDGE_FIELDS = ["type", "name_or_index", "to_node"]
+EDGE_TYPES = [
+    "context", "element", "property", "internal", "hidden", "shortcut", "weak"
+]
+LOCATION_FIELDS = ["object_index", "script_id", "line", "column"]
+
+ELEMENT_EDGE = EDGE_TYPES.index("element")
+HIDDEN_EDGE = EDGE_TYPES.index("hidden")
+
+
+class Reader(object):
+
+  def __init__(self, data):
+    self.data = data
+    self.pos = 0
+
+  def varint(self):
+    result = 0
+    shift = 0
+    while True:
+      if self.pos >= len(self.data):
+        raise ValueError("truncated snapshot")
+      byte = self.data[self.pos]
+      self.pos += 1
+      result |= (byte & 0x7F) << shift
+      shift += 7
+      if byte < 0x80:
+        return result
+
+  def bytes(self, length):
+    if self.pos + length > len(self.data):
+      raise ValueError("truncated snapshot")
+    result = self.data[self.pos:self.pos + length]
+    self.pos += length
+    return result
+
+
+class Snapshot(object):
+
+  def __init__(self, data):
+    if data[:len(MAGIC)] != MAGIC:
+      raise ValueError("not a binary heap snapshot")
+    reader = Reader(data)
+    reader.pos = len(MAGIC)
+    version = reader.varint()
+    if version != VERSION:
+      raise ValueError("unsupported version %d" % version)
+
+    # Flat arrays laid out like their JSON counterparts.
+    self.nodes = []
+    node_id = 0
+    for _ in range(reader.varint()):
+      node_type = reader.varint()
+      name = reader.varint()
+      delta = reader.varint()
+      node_id += (delta >> 1) ^ -(delta & 1)
+      self.nodes.extend([
+          node_type, name, node_id,
+          reader.varint(),
+          reader.varint(),
+          reader.varint(),
+          reader.varint()
+      ])
+    self.edges = []
+    for _ in range(reader.varint()):
+      self.edges.extend([reader.varint(), reader.varint(), reader.varint()])
+    self.locations = []
+    for _ in range(reader.varint()):
+      self.locations.extend([reader.varint() for _ in LOCATION_FIELDS])
+    self.strings = []
+    for _ in range(reader.varint()):
+      length = reader.varint()
+      self.strings.append(reader.bytes(length).decode("utf-8", "replace"))
+    if reader.pos != len(data):
+      raise ValueError("trailing data after snapshot")
+
+  def node_count(self):
+    return len(self.nodes) // len(NODE_FIELDS)
+
+  def edge_count(self):
+    return len(self.edges) // len(EDGE_FIELDS)
+
+  def to_json(self):
+    # The JSON format references strings with an offset of one, as its
+    # string table starts with a dummy entry, and nodes by their offset into
+    # the node array.
+    node_fields = len(NODE_FIELDS)
+    nodes = list(self.nodes)
+    for i in range(1, len(nodes), node_fields):
+      nodes[i] += 1
+    edges = list(self.edges)
+    for i in range(0, len(edges), len(EDGE_FIELDS)):
+      if edges[i] not in (ELEMENT_EDGE, HIDDEN_EDGE):
+        edges[i + 1] += 1
+      edges[i + 2] *= node_fields
+    locations = list(self.locations)
+    for i in range(0, len(locations), len(LOCATION_FIELDS)):
+      locations[i] *= node_fields
+      # Lines and columns are biased by one so that -1 encodes as 0.
+      locations[i + 2] -= 1
+      locations[i + 3] -= 1
+    number = "number"
+    return {
+        "snapshot": {
+            "meta": {
+                "node_fields":
+                    NODE_FIELDS,
+                "node_types": [NODE_TYPES, "string"] +
+                              [number] * (node_fields - 2),
+                "edge_fields":
+                    EDGE_FIELDS,
+                "edge_types": [EDGE_TYPES, "string_or_number", "node"],
+                "trace_function_info_fields": [
+                    "function_id", "name", "script_name", "script_id",
+                    "line", "column"
+                ],
+                "trace_node_fields": [
+                    "id", "function_info_index", "count", "size", "children"
+                ],
+                "sample_fields": ["timestamp_us", "last_assigned_id"],
+                "location_fields":
+                    LOCATION_FIELDS,
+            },
+            "node_count": self.node_count(),
+            "edge_count": self.edge_count(),
+            "trace_function_count": 0,
+        },
+        "nodes": nodes,
+        "edges": edges,
+        "trace_function_infos": [],
+        "trace_tree": [],
+        "samples": [],
+        "locations": locations,
+        "strings": ["<dummy>"] + self.strings,
+    }
+
+
+def main(argv):
+  parser = argparse.ArgumentParser(
+      description="Reads binary V8 heap snapshots.")
+  parser.add_argument("command", choices=["json", "stats"])
+  parser.add_argument("snapshot", help="binary heap snapshot")
+  args = parser.parse_args(argv)
+
+  with open(args.snapshot, "rb") as f:
+    data = f.read()
+  snapshot = Snapshot(data)
+
+  if args.command == "json":
+    json.dump(snapshot.to_json(), sys.stdout, separators=(",", ":"))
+    sys.stdout.write("\n")
+    return 0
+
+  self_size = sum(snapshot.nodes[3::len(NODE_FIELDS)])
+  print("snapshot size: %d bytes" % len(data))
+  print("nodes:         %d" % snapshot.node_count())
+  print("edges:         %d" % snapshot.edge_count())
+  print("locations:     %d" % (len(snapshot.locations) // 4))
+  print("strings:       %d" % len(snapshot.strings))
+  print("heap size:     %d bytes" % self_size)
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main(sys.argv[1:]))